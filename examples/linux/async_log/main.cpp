@@ -0,0 +1,111 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/debug/logger/async.hpp>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+
+using namespace std::chrono_literals;
+
+// Compares the cost of a log call on the producer side when writing
+// synchronously into a slow device with the asynchronous logger, whose
+// buffer is drained outside of the measurement. Afterwards an error storm
+// is limited to a burst of 10 lines and 100 lines per second.
+
+constexpr uint32_t Calls = 10'000;
+
+static inline uint64_t
+cycles()
+{
+#ifdef __x86_64__
+	return __rdtsc();
+#else
+	return modm::PreciseClock::now().time_since_epoch().count();
+#endif
+}
+
+// Simulates a UART with a full transmit buffer, which blocks for each byte
+class SlowDevice : public modm::IODevice
+{
+public:
+	using IODevice::write;
+
+	void
+	write(char) override
+	{
+		const auto start = modm::PreciseClock::now();
+		while (modm::PreciseClock::now() - start < 1us) ;
+		bytes++;
+	}
+
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+
+	uint32_t bytes{0};
+};
+
+SlowDevice slowDevice;
+modm::log::Logger syncLogger(slowDevice);
+
+uint32_t asyncBuffer[1024];
+modm::log::AsyncBuffer buffer(asyncBuffer);
+modm::log::AsyncDevice asyncDevice(buffer);
+modm::log::Logger asyncLogger(asyncDevice);
+
+modm::log::AsyncDevice errorDevice(buffer, modm::log::RateLimit{100, 10});
+modm::log::Logger errorLogger(errorDevice);
+
+template< class Function >
+static void
+measure(const char* name, Function&& log)
+{
+	uint64_t duration{0};
+	for (uint32_t ii = 0; ii < Calls; ii++)
+	{
+		const uint64_t start = cycles();
+		log(ii);
+		duration += cycles() - start;
+		// On a real target this happens in the idle loop or a low priority fiber
+		buffer.drain(slowDevice);
+	}
+	MODM_LOG_INFO.printf("%-5s: %6lu cycles per call\n", name, (unsigned long)(duration / Calls));
+}
+
+int
+main()
+{
+	measure("sync", [](uint32_t ii)
+	{
+		syncLogger << "motor " << uint8_t(ii % 4) << ": current=" << int32_t(ii) - 5000 << " mA" << modm::endl;
+	});
+	measure("async", [](uint32_t ii)
+	{
+		asyncLogger << "motor " << uint8_t(ii % 4) << ": current=" << int32_t(ii) - 5000 << " mA" << modm::endl;
+	});
+	MODM_LOG_INFO.printf("%lu records dropped, %lu bytes written\n",
+			(unsigned long)buffer.getDropped(), (unsigned long)slowDevice.bytes);
+
+	const auto start = modm::Clock::now();
+	uint32_t lines{0};
+	while (modm::Clock::now() - start < 100ms)
+	{
+		errorLogger << "sensor " << lines++ << " failed" << modm::endl;
+		buffer.drain(slowDevice);
+	}
+	MODM_LOG_INFO.printf("error storm: %lu of %lu lines limited\n",
+			(unsigned long)errorDevice.getLimited(), (unsigned long)lines);
+	return 0;
+}
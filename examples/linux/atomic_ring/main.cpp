@@ -0,0 +1,94 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/driver/atomic.hpp>
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+
+// Measures the throughput of moving bytes through the old modm::atomic::Queue
+// one byte at a time and through the new rings, one byte at a time and in bulk.
+// Producer and consumer alternate in blocks of 128 bytes, like an interrupt
+// filling the buffer and the main loop emptying it.
+
+constexpr uint32_t Bytes = 1 << 26;
+constexpr std::size_t Block = 128;
+
+template< class Producer, class Consumer >
+static void
+measure(const char* name, Producer&& producer, Consumer&& consumer)
+{
+	uint8_t data[Block];
+	uint32_t checksum{0};
+	modm::PreciseClock::duration duration{};
+	for (uint32_t ii = 0; ii < Bytes; ii += Block)
+	{
+		for (std::size_t jj = 0; jj < Block; jj++) data[jj] = uint8_t(ii + jj + ii / 256);
+		const auto start = modm::PreciseClock::now();
+		producer(data);
+		consumer(data);
+		duration += modm::PreciseClock::now() - start;
+		for (const uint8_t value : data) checksum = (checksum ^ value) * 16777619;
+	}
+	MODM_LOG_INFO.printf("%-13s: %5lu MB/s (checksum %08lx)\n", name,
+			(unsigned long)(uint64_t(Bytes) / duration.count()), (unsigned long)checksum);
+}
+
+modm::atomic::Queue<uint8_t, 255> queue;
+modm::atomic::SpscRing<uint8_t, 256> spsc;
+modm::atomic::MpscRing<uint8_t, 256> mpsc;
+
+template< class Ring >
+static void
+measureRing(const char* name, Ring& ring)
+{
+	measure(name, [&ring](const uint8_t (&data)[Block])
+	{
+		for (const uint8_t value : data) ring.push(value);
+	},
+	[&ring](uint8_t (&data)[Block])
+	{
+		for (uint8_t& value : data) ring.pop(value);
+	});
+}
+
+template< class Ring >
+static void
+measureBulk(const char* name, Ring& ring)
+{
+	measure(name, [&ring](const uint8_t (&data)[Block])
+	{
+		ring.push(data);
+	},
+	[&ring](uint8_t (&data)[Block])
+	{
+		ring.pop(data);
+	});
+}
+
+int
+main()
+{
+	measure("atomic::Queue", [](const uint8_t (&data)[Block])
+	{
+		for (const uint8_t value : data) queue.push(value);
+	},
+	[](uint8_t (&data)[Block])
+	{
+		for (uint8_t& value : data)
+		{
+			value = queue.get();
+			queue.pop();
+		}
+	});
+	measureRing("SpscRing", spsc);
+	measureBulk("SpscRing bulk", spsc);
+	measureRing("MpscRing", mpsc);
+	measureBulk("MpscRing bulk", mpsc);
+	return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/debug/binary_logger.hpp>
+#include <cstdio>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+
+// Compares the cost of a log call formatted on the target through
+// StyleWrapper<Prefix> with the binary logger, which only copies the raw
+// arguments. Both write into a device that discards all data.
+// The binary records of the last round are written to `binary.log`, decode
+// them with:
+//
+//   python3 -m modm_tools.binary_log ../../../build/linux/binary_log/scons-release/binary_log.elf binary.log
+
+constexpr uint32_t Calls = 100'000;
+
+class NullDevice : public modm::IODevice
+{
+public:
+	using IODevice::write;
+
+	void
+	write(char) override {}
+
+	void
+	write(std::span<const uint8_t>) override {}
+
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+};
+
+class FileDevice : public modm::IODevice
+{
+	FILE* file;
+public:
+	FileDevice(FILE* file) : file{file} {}
+	using IODevice::write;
+
+	void
+	write(char c) override
+	{ fputc(c, file); }
+
+	void
+	write(std::span<const uint8_t> data) override
+	{ fwrite(data.data(), 1, data.size(), file); }
+
+	void
+	flush() override
+	{ fflush(file); }
+
+	bool
+	read(char&) override
+	{ return false; }
+};
+
+static inline uint64_t
+cycles()
+{
+#ifdef __x86_64__
+	return __rdtsc();
+#else
+	return modm::PreciseClock::now().time_since_epoch().count();
+#endif
+}
+
+NullDevice nullDevice;
+modm::log::StyleWrapper< modm::log::Prefix< char[10] > > styleDevice(
+		modm::log::Prefix< char[10] >("Info   : ", nullDevice));
+modm::log::Logger styleLogger(styleDevice);
+
+template< class Function >
+static void
+measure(const char* name, Function&& log)
+{
+	const uint64_t start = cycles();
+	for (uint32_t ii = 0; ii < Calls; ii++) log(ii);
+	const uint64_t duration = cycles() - start;
+	MODM_LOG_INFO.printf("%-7s: %5lu cycles per call\n", name, (unsigned long)(duration / Calls));
+}
+
+int
+main()
+{
+	measure("stream", [](uint32_t ii)
+	{
+		styleLogger << "motor " << uint8_t(ii % 4) << ": current=" << int32_t(ii) - 5000
+					<< " mA, speed=" << float(ii) * 0.5f << " rpm" << modm::endl;
+	});
+	measure("printf", [](uint32_t ii)
+	{
+		styleLogger.printf("motor %u: current=%ld mA, speed=%f rpm\n",
+						   unsigned(ii % 4), long(ii) - 5000, float(ii) * 0.5f);
+	});
+	measure("binary", [](uint32_t ii)
+	{
+		MODM_BINLOG_INFO("motor %u: current=%ld mA, speed=%f rpm",
+						 uint8_t(ii % 4), int32_t(ii) - 5000, float(ii) * 0.5f);
+		// The ring is drained in the background on a real target
+		if (modm::log::binary.getSize() > 2048) modm::log::binary.drain(nullDevice);
+	});
+	modm::log::binary.drain(nullDevice);
+	MODM_LOG_INFO.printf("%lu binary records dropped\n", (unsigned long)modm::log::binary.getDropped());
+
+	MODM_BINLOG_DEBUG("Binary log of %s", "modm");
+	for (uint32_t ii = 0; ii < 4; ii++)
+	{
+		MODM_BINLOG_INFO("motor %u: current=%ld mA, speed=%f rpm",
+						 uint8_t(ii), int32_t(ii) - 5000, float(ii) * 0.5f);
+	}
+	MODM_BINLOG_WARNING("pointer %p, hex 0x%04x, char '%c'", (void*)&nullDevice, uint16_t(0xbeef), 'x');
+	MODM_BINLOG_ERROR("done");
+
+	if (FILE* file = fopen("binary.log", "wb"))
+	{
+		FileDevice fileDevice(file);
+		modm::log::binary.drain(fileDevice);
+		fclose(file);
+	}
+	return 0;
+}
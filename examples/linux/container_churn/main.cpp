@@ -0,0 +1,81 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/container.hpp>
+#include <modm/debug.hpp>
+#include <list>
+#include <vector>
+
+// Measures insert/erase churn of short-lived small arrays and of lists with
+// a few nodes, like the widget containers of the GUI and the send list of
+// the xpcc CAN connector.
+
+constexpr uint32_t Rounds = 1'000'000;
+
+template< class Function >
+static void
+measure(const char* name, Function&& function)
+{
+	uint32_t checksum{0};
+	const auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Rounds; ii++) checksum += function(ii);
+	const auto duration = modm::PreciseClock::now() - start;
+	MODM_LOG_INFO.printf("%-20s: %4lu ns per round (checksum %lu)\n", name,
+			(unsigned long)(uint64_t(duration.count()) * 1000 / Rounds), (unsigned long)checksum);
+}
+
+template< class Array >
+static uint32_t
+arrayChurn(uint32_t round)
+{
+	Array array;
+	for (uint32_t ii = 0; ii < 6; ii++) array.push_back(round + ii);
+	uint32_t sum{0};
+	for (const uint32_t value : array) sum += value;
+	return sum;
+}
+
+// Adapts the modm containers to the std interface used above
+template< class Container >
+struct Adapter : Container
+{
+	void push_back(const uint32_t& value) { this->append(value); }
+	void pop_front() { this->removeFront(); }
+	uint32_t& front() { return this->getFront(); }
+};
+
+template< class List >
+static uint32_t
+listChurn(uint32_t round)
+{
+	static List list;
+	list.push_back(round);
+	if (round >= 8)
+	{
+		const uint32_t value = list.front();
+		list.pop_front();
+		return value;
+	}
+	return 0;
+}
+
+int
+main()
+{
+	measure("std::vector", arrayChurn< std::vector<uint32_t> >);
+	measure("DynamicArray", arrayChurn< Adapter< modm::DynamicArray<uint32_t> > >);
+	measure("SmallDynamicArray<8>", arrayChurn< Adapter< modm::SmallDynamicArray<uint32_t, 8> > >);
+
+	measure("std::list", listChurn< std::list<uint32_t> >);
+	measure("LinkedList", listChurn< Adapter< modm::LinkedList<uint32_t> > >);
+	measure("LinkedList<Pool<16>>", listChurn< Adapter< modm::LinkedList<uint32_t,
+			modm::PoolAllocator<uint32_t, 16>> > >);
+	return 0;
+}
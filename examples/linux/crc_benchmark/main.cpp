@@ -0,0 +1,61 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/math/utils/crc.hpp>
+#include <vector>
+
+// Measures the throughput of the CRC policies for buffers from 1 KiB to 1 MiB.
+
+using modm::math::CrcPolicy;
+
+constexpr size_t MinSize = 1024;
+constexpr size_t MaxSize = 1024 * 1024;
+// Process roughly the same amount of data for every buffer size
+constexpr size_t TotalBytes = 16 * MaxSize;
+
+std::vector<uint8_t> buffer(MaxSize);
+volatile uint32_t result;
+
+template< class Function >
+static void
+measure(const char* name, size_t size, Function&& crc)
+{
+	const size_t iterations = std::max<size_t>(TotalBytes / size / 16, 1);
+	const auto start = modm::PreciseClock::now();
+	for (size_t ii = 0; ii < iterations; ii++)
+		result = crc(buffer.data(), size);
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t rate = uint64_t(iterations) * size / std::max(duration.count(), 1u);
+	MODM_LOG_INFO.printf("%-16s %8zu B: %6llu MB/s\n", name, size, (unsigned long long)rate);
+}
+
+int
+main()
+{
+	for (size_t ii = 0; ii < buffer.size(); ii++) buffer[ii] = ii * 131 + (ii >> 8);
+
+	for (size_t size = MinSize; size <= MaxSize; size *= 4)
+	{
+		measure("crc8 Bitwise", size, modm::math::crc8_ccitt<CrcPolicy::Bitwise>);
+		measure("crc8 Table", size, modm::math::crc8_ccitt<CrcPolicy::Table>);
+		measure("crc8 Slice8", size, modm::math::crc8_ccitt<CrcPolicy::Slice8>);
+		measure("crc16 Bitwise", size, modm::math::crc16_ccitt<CrcPolicy::Bitwise>);
+		measure("crc16 Table", size, modm::math::crc16_ccitt<CrcPolicy::Table>);
+		measure("crc16 Slice8", size, modm::math::crc16_ccitt<CrcPolicy::Slice8>);
+		measure("crc32 Bitwise", size, modm::math::crc32<CrcPolicy::Bitwise>);
+		measure("crc32 Table", size, modm::math::crc32<CrcPolicy::Table>);
+		measure("crc32 Slice8", size, modm::math::crc32<CrcPolicy::Slice8>);
+		measure("crc32 Hardware", size, modm::math::crc32<CrcPolicy::Hardware>);
+		MODM_LOG_INFO << modm::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/container/queue.hpp>
+#include <modm/debug.hpp>
+#include <cstring>
+
+// Measures moving bytes through a BoundedQueue into a transmit buffer, as a
+// UART or SPI driver would before starting a DMA transfer: element by element,
+// and in bulk with the contiguous front handed directly to the "DMA".
+
+constexpr uint32_t Bytes = 1 << 26;
+constexpr std::size_t Block = 100;
+
+modm::BoundedQueue<uint8_t, 256> queue;
+uint8_t dma[256];
+
+template< class Function >
+static void
+measure(const char* name, Function&& transfer)
+{
+	uint8_t data[Block];
+	uint32_t checksum{0};
+	modm::PreciseClock::duration duration{};
+	for (uint32_t ii = 0; ii < Bytes; ii += Block)
+	{
+		for (std::size_t jj = 0; jj < Block; jj++) data[jj] = uint8_t(ii + jj);
+		const auto start = modm::PreciseClock::now();
+		const std::size_t length = transfer(data);
+		duration += modm::PreciseClock::now() - start;
+		for (std::size_t jj = 0; jj < length; jj++) checksum = (checksum ^ dma[jj]) * 16777619;
+	}
+	MODM_LOG_INFO.printf("%-11s: %5lu MB/s (checksum %08lx)\n", name,
+			(unsigned long)(uint64_t(Bytes) / duration.count()), (unsigned long)checksum);
+}
+
+int
+main()
+{
+	measure("elementwise", [](const uint8_t (&data)[Block])
+	{
+		for (const uint8_t value : data) queue.push(value);
+		std::size_t length{0};
+		while (not queue.isEmpty())
+		{
+			dma[length++] = queue.get();
+			queue.pop();
+		}
+		return length;
+	});
+	measure("bulk", [](const uint8_t (&data)[Block])
+	{
+		queue.push(data);
+		std::size_t length{0};
+		while (not queue.isEmpty())
+		{
+			// The DMA reads the contiguous front in place
+			const auto front = queue.getContiguousFront();
+			std::memcpy(dma + length, front.data(), front.size());
+			length += front.size();
+			queue.consume(front.size());
+		}
+		return length;
+	});
+	return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug.hpp>
+#include <modm/ui/display/font.hpp>
+#include <modm/ui/display/monochrome_graphic_display_vertical.hpp>
+
+// Counts the bytes a 128x64 SSD1306 receives via I2C per frame of a typical
+// UI, which only updates a clock and a progress bar once per second, when
+// sending the whole buffer compared to sending only the dirty window.
+
+class CountingDisplay : public modm::MonochromeGraphicDisplayVertical<128, 64>
+{
+public:
+	void
+	update() override
+	{
+		const DirtyArea area = takeDirtyArea();
+		// Control byte and the whole buffer
+		fullBytes += 1 + sizeof(buffer);
+		if (area.isEmpty()) return;
+		// Control byte and column and page address window
+		dirtyBytes += 7;
+		if (area.x0 == 0 and area.x1 == 128)
+		{
+			dirtyBytes += 1 + (area.y1 - area.y0) * 128;
+		} else
+		{
+			// One transaction with control byte per page
+			dirtyBytes += (area.y1 - area.y0) * (1 + area.x1 - area.x0);
+		}
+	}
+
+	uint32_t fullBytes{0};
+	uint32_t dirtyBytes{0};
+};
+
+int
+main()
+{
+	CountingDisplay display;
+
+	// Static content is only drawn once
+	display.clear();
+	display.setFont(modm::font::FixedWidth5x8);
+	display.setCursor(0, 0);
+	display << "Status";
+	display.drawRectangle({0, 48}, 128, 16);
+	display.update();
+	MODM_LOG_INFO.printf("first frame: %4lu bytes full, %4lu bytes dirty\n",
+			(unsigned long)display.fullBytes, (unsigned long)display.dirtyBytes);
+
+	constexpr uint32_t Frames = 120;
+	display.fullBytes = display.dirtyBytes = 0;
+	for (uint32_t second = 0; second < Frames; second++)
+	{
+		// Text overwrites its background, so only the changed glyphs are redrawn
+		display.setCursor(40, 24);
+		display.printf("%02lu:%02lu", (unsigned long)(second / 60), (unsigned long)(second % 60));
+		display.drawLine(2 + second, 50, 2 + second, 61);
+		display.update();
+	}
+	MODM_LOG_INFO.printf("per frame:   %4lu bytes full, %4lu bytes dirty\n",
+			(unsigned long)(display.fullBytes / Frames), (unsigned long)(display.dirtyBytes / Frames));
+
+	return 0;
+}
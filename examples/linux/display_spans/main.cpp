@@ -0,0 +1,100 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug.hpp>
+#include <modm/ui/display/color_graphic_display.hpp>
+
+// Counts the bus transactions of a reference scene on a 240x320 TFT like the
+// ILI9341, where every address window costs two command transactions and
+// every burst of pixels one data transaction. A driver only implementing
+// setPixel() is compared to one also implementing the span and blit hooks.
+
+class CountingDisplay : public modm::ColorGraphicDisplay
+{
+public:
+	CountingDisplay(bool spans) : spans{spans} {}
+
+	uint16_t getWidth() const final { return 240; }
+	uint16_t getHeight() const final { return 320; }
+	std::size_t getBufferWidth() const final { return 240; }
+	std::size_t getBufferHeight() const final { return 320; }
+
+	void setPixel(int16_t, int16_t) final { write(1); }
+	void clearPixel(int16_t, int16_t) final { write(1); }
+	modm::color::Rgb565 getPixel(int16_t, int16_t) const final { return modm::color::html::Black; }
+
+	void clear() final { write(240 * 320); }
+	void update() final {}
+
+	void
+	drawImageRaw(modm::glcd::Point start, uint16_t width, uint16_t height,
+				 modm::accessor::Flash<uint8_t> data) final
+	{
+		if (spans) write(width * height);
+		else GraphicDisplay::drawImageRaw(start, width, height, data);
+	}
+
+	uint32_t transactions{0};
+	uint32_t bytes{0};
+
+protected:
+	void
+	drawHorizontalLine(modm::glcd::Point start, uint16_t length) final
+	{
+		if (spans) write(length);
+		else GraphicDisplay::drawHorizontalLine(start, length);
+	}
+
+	void
+	drawVerticalLine(modm::glcd::Point start, uint16_t length) final
+	{
+		if (spans) write(length);
+		else GraphicDisplay::drawVerticalLine(start, length);
+	}
+
+	// Column and page address commands, then the pixel data
+	void
+	write(uint32_t pixels)
+	{
+		transactions += 3;
+		bytes += 2 * 5 + 1 + pixels * 2;
+	}
+
+	const bool spans;
+};
+
+static void
+scene(CountingDisplay& display)
+{
+	display.drawLine(0, 0, 239, 100);
+	display.drawLine(0, 319, 120, 0);
+	display.drawRectangle({5, 5}, 230, 310);
+	display.drawRoundedRectangle({10, 120}, 100, 60, 8);
+	display.drawCircle({160, 160}, 50);
+	display.fillRectangle({20, 200}, 50, 30);
+	display.fillCircle({180, 250}, 30);
+	display.setCursor(10, 290);
+	display << "Temperature: 21.5 C";
+}
+
+int
+main()
+{
+	CountingDisplay pixels{false};
+	CountingDisplay spans{true};
+	scene(pixels);
+	scene(spans);
+
+	MODM_LOG_INFO.printf("setPixel only: %5lu transactions, %6lu bytes\n",
+			(unsigned long)pixels.transactions, (unsigned long)pixels.bytes);
+	MODM_LOG_INFO.printf("spans + blit:  %5lu transactions, %6lu bytes\n",
+			(unsigned long)spans.transactions, (unsigned long)spans.bytes);
+
+	return 0;
+}
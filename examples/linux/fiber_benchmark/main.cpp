@@ -0,0 +1,90 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug.hpp>
+#include <modm/processing.hpp>
+#include <modm/processing/fiber/mutex.hpp>
+#include <optional>
+
+// Measures the context switches per second between two yielding fibers while
+// a varying number of other fibers is blocked on a mutex. Since blocked fibers
+// are removed from the run ring, the switch rate should remain constant.
+
+constexpr size_t MaxBlocked = 256;
+constexpr uint32_t Yields = 1'000'000;
+
+modm::fiber::Stack<16*1024> stacks[MaxBlocked + 2];
+std::optional<modm::fiber::Task> tasks[MaxBlocked + 2];
+
+modm::fiber::mutex mtx;
+volatile bool done;
+uint32_t total_yields;
+modm::PreciseClock::duration duration;
+
+void
+blocked()
+{
+	mtx.lock();
+	mtx.unlock();
+}
+
+void
+yielder1()
+{
+	mtx.lock();
+	// let all other fibers block on the mutex
+	modm::this_fiber::yield();
+	const auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Yields; ii++)
+	{
+		modm::this_fiber::yield();
+		total_yields++;
+	}
+	duration = modm::PreciseClock::now() - start;
+	done = true;
+	mtx.unlock();
+}
+
+void
+yielder2()
+{
+	while (not done)
+	{
+		modm::this_fiber::yield();
+		total_yields++;
+	}
+}
+
+void
+benchmark(size_t num_blocked)
+{
+	done = false;
+	total_yields = 0;
+	tasks[0].emplace(stacks[0], yielder1);
+	tasks[1].emplace(stacks[1], yielder2);
+	for (size_t ii = 0; ii < num_blocked; ii++)
+		tasks[ii + 2].emplace(stacks[ii + 2], blocked);
+
+	modm::fiber::Scheduler::run();
+
+	const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+	MODM_LOG_INFO << num_blocked << " blocked fibers: " << total_yields << " yields in ";
+	MODM_LOG_INFO << uint32_t(us) << "us, " << uint32_t((total_yields * 1'000'000ull) / us);
+	MODM_LOG_INFO << " switches per second" << modm::endl;
+
+	for (auto& task : tasks) task.reset();
+}
+
+int
+main()
+{
+	MODM_LOG_INFO << "Starting fiber context switch benchmark..." << modm::endl;
+	for (size_t num_blocked : {0, 1, 16, 64, 256}) benchmark(num_blocked);
+	return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug.hpp>
+#include <modm/processing.hpp>
+#include <modm/processing/fiber/mutex.hpp>
+#include <optional>
+
+// Measures how a CPU-bound workload of many yielding fibers scales across the
+// cores of the hosted scheduler. The same fibers are first pinned to core 0,
+// then started unpinned so that idle cores can take them over. All fibers
+// also update a shared counter protected by a fiber mutex.
+
+constexpr size_t Fibers = 64;
+constexpr uint32_t Rounds = 200;
+constexpr uint32_t Work = 20'000;
+
+modm::fiber::Stack<16*1024> stacks[Fibers];
+std::optional<modm::fiber::Task> tasks[Fibers];
+
+modm::fiber::mutex mtx;
+uint32_t counter;
+std::atomic<uint32_t> checksum;
+
+void
+worker()
+{
+	uint32_t hash{2166136261u};
+	for (uint32_t round = 0; round < Rounds; round++)
+	{
+		for (uint32_t ii = 0; ii < Work; ii++)
+			hash = (hash ^ ii) * 16777619u;
+		{
+			std::lock_guard _(mtx);
+			counter++;
+		}
+		modm::this_fiber::yield();
+	}
+	checksum.fetch_xor(hash, std::memory_order_relaxed);
+}
+
+uint32_t
+benchmark(bool pinned)
+{
+	counter = 0;
+	for (size_t ii = 0; ii < Fibers; ii++)
+	{
+		tasks[ii].emplace(stacks[ii], worker, modm::fiber::Start::Later);
+		if (pinned) tasks[ii]->start(0);
+		else tasks[ii]->start();
+	}
+
+	const auto start = modm::PreciseClock::now();
+	modm::fiber::Scheduler::run();
+	const auto duration = modm::PreciseClock::now() - start;
+	const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+	if (pinned) {
+		MODM_LOG_INFO << "pinned to core 0: ";
+	} else {
+		MODM_LOG_INFO << "shared by " << modm::fiber::Scheduler::hardware_concurrency() << " cores: ";
+	}
+	MODM_LOG_INFO << uint32_t(us) << "us, counter " << counter;
+	MODM_LOG_INFO << (counter == Fibers * Rounds ? " ok" : " FAILED") << modm::endl;
+
+	for (auto& task : tasks) task.reset();
+	return us;
+}
+
+int
+main()
+{
+	MODM_LOG_INFO << "Starting fiber scaling benchmark..." << modm::endl;
+	const uint32_t single = benchmark(true);
+	const uint32_t shared = benchmark(false);
+	MODM_LOG_INFO << "speedup: " << (single * 100ul / shared) << "%" << modm::endl;
+	return 0;
+}
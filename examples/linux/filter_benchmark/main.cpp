@@ -0,0 +1,152 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/math/filter.hpp>
+#include <cstdio>
+
+// Measures the throughput of the sample-by-sample Fir against the BlockFir in
+// floating-point and fixed-point and of cascaded biquads, in blocks of 64
+// samples like a DMA buffer of an 8 kHz ADC stream.
+
+constexpr std::size_t BlockSize = 64;
+constexpr uint64_t TotalTaps = 200'000'000;
+
+float inputFloat[BlockSize];
+float outputFloat[BlockSize];
+int16_t inputQ15[BlockSize];
+int16_t outputQ15[BlockSize];
+int32_t inputQ31[BlockSize];
+int32_t outputQ31[BlockSize];
+
+// Hides the buffers from the optimizer, so that every block is computed
+static inline void
+clobber(const void* data)
+{
+	asm volatile("" : : "r"(data) : "memory");
+}
+
+template< class Function >
+static void
+measure(const char* name, std::size_t taps, Function&& function)
+{
+	// Roughly the same number of multiply-adds for every filter length
+	const uint32_t blocks = std::max<uint64_t>(TotalTaps / taps / BlockSize, 1);
+	const auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < blocks; ii++)
+		function();
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t rate = uint64_t(blocks) * BlockSize / std::max(duration.count(), 1u);
+	MODM_LOG_INFO.printf("%-22s %3zu taps: %6llu MSamples/s\n", name, taps, (unsigned long long)rate);
+}
+
+template< std::size_t N >
+static void
+sweep()
+{
+	float coefficients[N];
+	int16_t coefficientsQ15[N];
+	int32_t coefficientsQ31[N];
+	for (std::size_t k = 0; k < N; ++k)
+	{
+		coefficients[k] = 1.f / N;
+		coefficientsQ15[k] = 0x7fff / N;
+		coefficientsQ31[k] = 0x7fff'ffff / N;
+	}
+
+	modm::filter::Fir<float, N, BlockSize> fir(coefficients);
+	measure("Fir float", N, [&]
+	{
+		clobber(inputFloat);
+		for (float sample : inputFloat)
+		{
+			fir.append(sample);
+			fir.update();
+			outputFloat[0] = fir.getValue();
+		}
+		clobber(outputFloat);
+	});
+	modm::filter::Fir<int32_t, N, BlockSize, 0x7fff> firInteger(coefficients);
+	measure("Fir int32_t", N, [&]
+	{
+		clobber(inputQ15);
+		for (int32_t sample : inputQ15)
+		{
+			firInteger.append(sample);
+			firInteger.update();
+			outputQ31[0] = firInteger.getValue();
+		}
+		clobber(outputQ31);
+	});
+
+	modm::filter::BlockFir<float, N, BlockSize> blockFir(coefficients);
+	measure("BlockFir float", N, [&]
+	{
+		clobber(inputFloat);
+		blockFir.process(inputFloat, outputFloat);
+		clobber(outputFloat);
+	});
+	modm::filter::BlockFir<int16_t, N, BlockSize> blockFirQ15(coefficientsQ15);
+	measure("BlockFir Q15", N, [&]
+	{
+		clobber(inputQ15);
+		blockFirQ15.process(inputQ15, outputQ15);
+		clobber(outputQ15);
+	});
+	modm::filter::BlockFir<int32_t, N, BlockSize> blockFirQ31(coefficientsQ31);
+	measure("BlockFir Q31", N, [&]
+	{
+		clobber(inputQ31);
+		blockFirQ31.process(inputQ31, outputQ31);
+		clobber(outputQ31);
+	});
+	MODM_LOG_INFO << modm::endl;
+}
+
+template< std::size_t STAGES >
+static void
+biquad()
+{
+	using Filter = modm::filter::Biquad<float, STAGES>;
+	typename Filter::Coefficients coefficients[STAGES];
+	std::fill_n(coefficients, STAGES, Filter::lowpass(1000, 8000));
+	Filter filter(coefficients);
+
+	char name[32];
+	snprintf(name, sizeof(name), "Biquad %zu stages", STAGES);
+	measure(name, STAGES * 5, [&]
+	{
+		clobber(inputFloat);
+		filter.process(inputFloat, outputFloat);
+		clobber(outputFloat);
+	});
+}
+
+int
+main()
+{
+	for (std::size_t n = 0; n < BlockSize; ++n)
+	{
+		inputFloat[n] = float((n * 37) % 17) / 17 - 0.5f;
+		inputQ15[n] = (n * 1237) % 65536 - 32768;
+		inputQ31[n] = inputQ15[n] << 16;
+	}
+
+	sweep<8>();
+	sweep<31>();
+	sweep<64>();
+	sweep<128>();
+
+	biquad<1>();
+	biquad<2>();
+	biquad<4>();
+	return 0;
+}
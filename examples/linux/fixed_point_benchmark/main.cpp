@@ -0,0 +1,184 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/math/filter.hpp>
+#include <modm/math/fixed_point.hpp>
+#include <algorithm>
+#include <cmath>
+
+// Compares the accuracy and the time per value of float against the Q15.16
+// format for the arithmetic operators, the math functions and the PID and FIR
+// filters. The error is measured against double on the same inputs.
+//
+// Note that float operations are computed by the FPU of the host, while the
+// fixed-point type is meant for targets without FPU, where every float
+// operation is a library call.
+
+using q16 = modm::fixed<15, 16>;
+
+constexpr std::size_t Values = 1024;
+constexpr uint32_t Iterations = 2000;
+
+float floatA[Values];
+float floatB[Values];
+float floatOutput[Values];
+q16 fixedA[Values];
+q16 fixedB[Values];
+q16 fixedOutput[Values];
+
+// Hides the buffers from the optimizer, so that every value is computed
+static inline void
+clobber(const void* data)
+{
+	asm volatile("" : : "r"(data) : "memory");
+}
+
+template< class Function >
+static void
+measure(const char* name, Function&& function)
+{
+	const auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Iterations; ii++)
+		function();
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t ps = uint64_t(duration.count()) * 1'000'000 / (uint64_t(Iterations) * Values);
+	MODM_LOG_INFO.printf("%-32s %4llu.%02llu ns/value\n", name,
+			(unsigned long long)(ps / 1000), (unsigned long long)(ps % 1000 / 10));
+}
+
+template< class Reference >
+static void
+accuracy(Reference&& reference)
+{
+	double floatError = 0;
+	double fixedError = 0;
+	for (std::size_t n = 0; n < Values; ++n)
+	{
+		const double expected = reference(double(fixedA[n]), double(fixedB[n]));
+		floatError = std::max(floatError, std::abs(floatOutput[n] - expected));
+		fixedError = std::max(fixedError, std::abs(double(fixedOutput[n]) - expected));
+	}
+	MODM_LOG_INFO.printf("  max. error float %.2e, fixed %.2e\n", floatError, fixedError);
+}
+
+template< class FloatFunction, class FixedFunction, class Reference >
+static void
+compare(const char* name, FloatFunction&& floatFunction, FixedFunction&& fixedFunction,
+		Reference&& reference)
+{
+	MODM_LOG_INFO << name << modm::endl;
+	measure("  float", [&]
+	{
+		clobber(floatA);
+		clobber(floatB);
+		for (std::size_t n = 0; n < Values; ++n)
+			floatOutput[n] = floatFunction(floatA[n], floatB[n]);
+		clobber(floatOutput);
+	});
+	measure("  fixed<15, 16>", [&]
+	{
+		clobber(fixedA);
+		clobber(fixedB);
+		for (std::size_t n = 0; n < Values; ++n)
+			fixedOutput[n] = fixedFunction(fixedA[n], fixedB[n]);
+		clobber(fixedOutput);
+	});
+	accuracy(reference);
+}
+
+// Runs the filter over the inputs in A
+template< class FloatFilter, class FixedFilter >
+static void
+filter(const char* name, FloatFilter& floatFilter, FixedFilter& fixedFilter)
+{
+	MODM_LOG_INFO << name << modm::endl;
+	measure("  float", [&]
+	{
+		clobber(floatA);
+		for (std::size_t n = 0; n < Values; ++n)
+			floatOutput[n] = floatFilter(floatA[n]);
+		clobber(floatOutput);
+	});
+	measure("  fixed<15, 16>", [&]
+	{
+		clobber(fixedA);
+		for (std::size_t n = 0; n < Values; ++n)
+			fixedOutput[n] = fixedFilter(fixedA[n]);
+		clobber(fixedOutput);
+	});
+	// The float filter is the reference, both have seen the same inputs
+	double error = 0;
+	for (std::size_t n = 0; n < Values; ++n)
+		error = std::max(error, std::abs(double(fixedOutput[n]) - floatOutput[n]));
+	MODM_LOG_INFO.printf("  max. difference %.2e\n", error);
+}
+
+int
+main()
+{
+	uint32_t state = 1;
+	for (std::size_t n = 0; n < Values; ++n)
+	{
+		state = state * 1664525 + 1013904223;
+		fixedA[n] = q16::fromRaw(int32_t(state) >> 8);		// -128 to 128
+		state = state * 1664525 + 1013904223;
+		fixedB[n] = q16::fromRaw((state >> 12) + 16384);	// 0.25 to 16.25
+		if (n % 2) fixedB[n] = -fixedB[n];
+		floatA[n] = float(fixedA[n]);
+		floatB[n] = float(fixedB[n]);
+	}
+
+	compare("a + b",
+			[](float a, float b) { return a + b; },
+			[](q16 a, q16 b) { return a + b; },
+			[](double a, double b) { return a + b; });
+	compare("a * b",
+			[](float a, float b) { return a * b; },
+			[](q16 a, q16 b) { return a * b; },
+			[](double a, double b) { return a * b; });
+	compare("a / b",
+			[](float a, float b) { return a / b; },
+			[](q16 a, q16 b) { return a / b; },
+			[](double a, double b) { return a / b; });
+	compare("sqrt(|a|)",
+			[](float a, float) { return std::sqrt(std::abs(a)); },
+			[](q16 a, q16) { return sqrt(abs(a)); },
+			[](double a, double) { return std::sqrt(std::abs(a)); });
+	compare("sin(a)",
+			[](float a, float) { return std::sin(a); },
+			[](q16 a, q16) { return sin(a); },
+			[](double a, double) { return std::sin(a); });
+	compare("cos(a)",
+			[](float a, float) { return std::cos(a); },
+			[](q16 a, q16) { return cos(a); },
+			[](double a, double) { return std::cos(a); });
+	compare("atan2(a, b)",
+			[](float a, float b) { return std::atan2(a, b); },
+			[](q16 a, q16 b) { return atan2(a, b); },
+			[](double a, double b) { return std::atan2(a, b); });
+
+	modm::Pid<float> floatPid(0.8f, 0.25f, 0.5f, 400, 1000);
+	modm::Pid<q16> fixedPid(0.8f, 0.25f, 0.5f, 400, 1000);
+	auto floatPidUpdate = [&](float input) { floatPid.update(input); return floatPid.getValue(); };
+	auto fixedPidUpdate = [&](q16 input) { fixedPid.update(input); return fixedPid.getValue(); };
+	filter("Pid", floatPidUpdate, fixedPidUpdate);
+
+	constexpr float coefficients[16] = {
+		-0.004f, -0.010f, -0.013f, 0.006f, 0.056f, 0.128f, 0.192f, 0.227f,
+		0.192f, 0.128f, 0.056f, 0.006f, -0.013f, -0.010f, -0.004f, 0.f};
+	modm::filter::Fir<float, 16, 0> floatFir(coefficients);
+	modm::filter::Fir<q16, 16, 0> fixedFir(coefficients);
+	auto floatFirUpdate = [&](float input) { floatFir.append(input); floatFir.update(); return floatFir.getValue(); };
+	auto fixedFirUpdate = [&](q16 input) { fixedFir.append(input); fixedFir.update(); return fixedFir.getValue(); };
+	filter("Fir, 16 taps", floatFirUpdate, fixedFirUpdate);
+	return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/ui/display/font.hpp>
+#include <modm/ui/display/monochrome_graphic_display_horizontal.hpp>
+#include <modm/ui/display/monochrome_graphic_display_vertical.hpp>
+#include <cstring>
+
+// Measures how many glyphs per second are drawn into the RAM buffer of
+// monochrome displays with the FontCreator fonts and their atlas versions,
+// and how fast the width of a string is measured.
+
+template< class Base >
+class Display : public Base
+{
+public:
+	void update() final {}
+};
+
+using HorizontalDisplay = Display<modm::MonochromeGraphicDisplayHorizontal<128, 64>>;
+using VerticalDisplay = Display<modm::MonochromeGraphicDisplayVertical<128, 64>>;
+
+constexpr size_t Iterations = 2000;
+volatile uint16_t result;
+
+template< class Display >
+static void
+measure(const char* name, const uint8_t* font, const char* text)
+{
+	Display display;
+	display.setFont(font);
+	size_t glyphs = 0;
+	const auto start = modm::PreciseClock::now();
+	for (size_t ii = 0; ii < Iterations; ii++)
+	{
+		display.setCursor(ii % 8, 0);
+		display << text;
+		glyphs += strlen(text);
+	}
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t rate = uint64_t(glyphs) * 1'000'000 / std::max(duration.count(), 1u);
+	MODM_LOG_INFO.printf("%-32s %9llu glyphs/s\n", name, (unsigned long long)rate);
+}
+
+static void
+measureWidth(const char* name, const uint8_t* font)
+{
+	const auto flash = modm::accessor::asFlash(font);
+	const char* text = "The quick brown fox jumps over the lazy dog";
+	const auto start = modm::PreciseClock::now();
+	for (size_t ii = 0; ii < Iterations * 10; ii++)
+		result = modm::GraphicDisplay::getStringWidth(text, &flash);
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t rate = uint64_t(Iterations) * 10 * strlen(text) * 1'000'000 / std::max(duration.count(), 1u);
+	MODM_LOG_INFO.printf("%-32s %9llu glyphs/s\n", name, (unsigned long long)rate);
+}
+
+int
+main()
+{
+	using namespace modm::font;
+	const char* text = "Hello World 12:34";
+	const char* numbers = "12";
+
+	measure<HorizontalDisplay>("horizontal 5x8", FixedWidth5x8, text);
+	measure<HorizontalDisplay>("horizontal 5x8 atlas", FixedWidth5x8Atlas, text);
+	measure<VerticalDisplay>("vertical 5x8", FixedWidth5x8, text);
+	measure<VerticalDisplay>("vertical 5x8 atlas", FixedWidth5x8Atlas, text);
+	measure<HorizontalDisplay>("horizontal 46x64", Numbers46x64, numbers);
+	measure<HorizontalDisplay>("horizontal 46x64 atlas rle", Numbers46x64Atlas, numbers);
+	measure<VerticalDisplay>("vertical 46x64", Numbers46x64, numbers);
+	measure<VerticalDisplay>("vertical 46x64 atlas rle", Numbers46x64Atlas, numbers);
+	MODM_LOG_INFO << modm::endl;
+
+	measureWidth("string width 5x8", FixedWidth5x8);
+	measureWidth("string width 5x8 atlas", FixedWidth5x8Atlas);
+	return 0;
+}
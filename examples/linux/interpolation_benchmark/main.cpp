@@ -0,0 +1,178 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/math/interpolation.hpp>
+#include <cmath>
+
+// Measures the time per value of a linear scan over the supporting points
+// against the binary search of Linear and the precomputed LinearTable for a
+// 256 point calibration table, and of Lagrange against LagrangeTable.
+
+constexpr std::size_t Values = 1024;
+constexpr uint32_t Iterations = 2000;
+
+using Point = modm::Pair<uint16_t, float>;
+using IntegerPoint = modm::Pair<int16_t, int16_t>;
+using LagrangePoint = modm::Pair<float, float>;
+
+Point uniformPoints[256];
+Point points[256];
+IntegerPoint integerPoints[256];
+LagrangePoint lagrangePoints[8];
+
+uint16_t input[Values];
+int16_t integerInput[Values];
+float floatInput[Values];
+float output[Values];
+int16_t integerOutput[Values];
+
+// Hides the buffers from the optimizer, so that every value is computed
+static inline void
+clobber(const void* data)
+{
+	asm volatile("" : : "r"(data) : "memory");
+}
+
+// The previous implementation of Linear, which scans the supporting points
+template< typename T >
+static typename T::SecondType
+scan(const T* supportingPoints, uint8_t numberOfPoints, typename T::FirstType value)
+{
+	T current(supportingPoints[0]);
+	if (value <= current.getFirst()) {
+		return current.getSecond();
+	}
+	T last(current);
+	for (uint8_t i = 1; i < numberOfPoints; ++i)
+	{
+		current = supportingPoints[i];
+		if (value <= current.getFirst())
+		{
+			const auto a = value - last.getFirst();
+			const auto b = current.getSecond() - last.getSecond();
+			const auto c = current.getFirst() - last.getFirst();
+			return (a * b) / c + last.getSecond();
+		}
+		last = current;
+	}
+	return current.getSecond();
+}
+
+template< class Function >
+static void
+measure(const char* name, Function&& function)
+{
+	const auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Iterations; ii++)
+		function();
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t ps = uint64_t(duration.count()) * 1'000'000 / (uint64_t(Iterations) * Values);
+	MODM_LOG_INFO.printf("%-32s %4llu.%02llu ns/value\n", name,
+			(unsigned long long)(ps / 1000), (unsigned long long)(ps % 1000 / 10));
+}
+
+template< typename T >
+static void
+linear(const char* name, const T (&table)[256], const typename T::FirstType (&values)[Values],
+	   typename T::SecondType (&results)[Values])
+{
+	MODM_LOG_INFO << name << modm::endl;
+	measure("  linear scan", [&]
+	{
+		clobber(values);
+		for (std::size_t n = 0; n < Values; ++n)
+			results[n] = scan(table, 255, values[n]);
+		clobber(results);
+	});
+	// Only 255 points can be used with the uint8_t count of Linear
+	modm::interpolation::Linear<T> interpolation(table, 255);
+	measure("  Linear", [&]
+	{
+		clobber(values);
+		for (std::size_t n = 0; n < Values; ++n)
+			results[n] = interpolation.interpolate(values[n]);
+		clobber(results);
+	});
+	measure("  Linear block", [&]
+	{
+		clobber(values);
+		interpolation.interpolate(values, results);
+		clobber(results);
+	});
+	const modm::interpolation::LinearTable<T, 255> precomputed(reinterpret_cast<const T(&)[255]>(table));
+	measure(precomputed.isUniform() ? "  LinearTable uniform" : "  LinearTable", [&]
+	{
+		clobber(values);
+		for (std::size_t n = 0; n < Values; ++n)
+			results[n] = precomputed.interpolate(values[n]);
+		clobber(results);
+	});
+	measure(precomputed.isUniform() ? "  LinearTable uniform block" : "  LinearTable block", [&]
+	{
+		clobber(values);
+		precomputed.interpolate(values, results);
+		clobber(results);
+	});
+}
+
+int
+main()
+{
+	for (std::size_t i = 0; i < 256; ++i)
+	{
+		// Thermistor curve from the ADC value to the temperature
+		const float x = i * 256;
+		const float temperature = 1.f / (1.f / 298.15f + std::log((x + 256) / 32768) / 3950.f) - 273.15f;
+		uniformPoints[i] = {uint16_t(i * 256), temperature};
+		// Denser points in the middle of the range
+		const float xi = 32768 + 32000 * std::sin((float(i) / 255 - 0.5f) * 3.14159f);
+		points[i] = {uint16_t(xi + i), temperature};
+		integerPoints[i] = {int16_t(i * 200 - 25600), int16_t(temperature * 100)};
+	}
+	for (std::size_t i = 0; i < 8; ++i) {
+		lagrangePoints[i] = {float(i), std::sqrt(float(i))};
+	}
+	for (std::size_t n = 0; n < Values; ++n)
+	{
+		input[n] = (n * 40503) & 0xffff;
+		integerInput[n] = int16_t(input[n]) * 25600 / 32768;
+		floatInput[n] = float(input[n]) / 65536 * 7;
+	}
+
+	linear("uint16_t to float, uniform", uniformPoints, input, output);
+	linear("uint16_t to float", points, input, output);
+	linear("int16_t to int16_t", integerPoints, integerInput, integerOutput);
+
+	MODM_LOG_INFO << "float, 8 points" << modm::endl;
+	modm::interpolation::Lagrange<LagrangePoint> lagrange(lagrangePoints, 8);
+	measure("  Lagrange", [&]
+	{
+		clobber(floatInput);
+		lagrange.interpolate(floatInput, output);
+		clobber(output);
+	});
+	const modm::interpolation::LagrangeTable lagrangeTable(lagrangePoints);
+	measure("  LagrangeTable", [&]
+	{
+		clobber(floatInput);
+		for (std::size_t n = 0; n < Values; ++n)
+			output[n] = lagrangeTable.interpolate(floatInput[n]);
+		clobber(output);
+	});
+	measure("  LagrangeTable block", [&]
+	{
+		clobber(floatInput);
+		lagrangeTable.interpolate(floatInput, output);
+		clobber(output);
+	});
+	return 0;
+}
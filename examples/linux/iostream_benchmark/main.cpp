@@ -0,0 +1,92 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+
+// Measures how many formatted lines per second an IOStream can write into a
+// device that discards all data, once for a device that only implements the
+// single character write and once for a device that accepts whole blocks.
+
+constexpr uint32_t Lines = 200'000;
+
+/// Only implements the mandatory single character interface
+class CharDevice : public modm::IODevice
+{
+public:
+	using IODevice::write;
+	using IODevice::read;
+
+	void
+	write(char) override
+	{ calls++; bytes++; }
+
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+
+	uint32_t calls{0};
+	uint32_t bytes{0};
+};
+
+/// Additionally accepts blocks of bytes
+class BlockDevice : public CharDevice
+{
+public:
+	using CharDevice::write;
+
+	void
+	write(std::span<const uint8_t> data) override
+	{ calls++; bytes += data.size(); }
+};
+
+template< class Function >
+static void
+measure(const char* name, Function&& format)
+{
+	CharDevice charDevice;
+	BlockDevice blockDevice;
+	modm::IOStream charStream(charDevice);
+	modm::IOStream blockStream(blockDevice);
+
+	auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Lines; ii++) format(charStream, ii);
+	const auto charDuration = modm::PreciseClock::now() - start;
+
+	start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Lines; ii++) format(blockStream, ii);
+	const auto blockDuration = modm::PreciseClock::now() - start;
+
+	MODM_LOG_INFO.printf("%-8s: char %8lu lines/s (%4.1f calls/line), block %8lu lines/s (%4.1f calls/line)\n",
+			name,
+			(unsigned long)(uint64_t(Lines) * 1'000'000 / std::max(charDuration.count(), 1u)),
+			double(charDevice.calls) / Lines,
+			(unsigned long)(uint64_t(Lines) * 1'000'000 / std::max(blockDuration.count(), 1u)),
+			double(blockDevice.calls) / Lines);
+}
+
+int
+main()
+{
+	measure("stream", [](modm::IOStream& stream, uint32_t ii)
+	{
+		stream << "sensor " << uint8_t(ii) << ": " << int32_t(ii * 37) - 4'000'000
+			   << " mV, " << float(ii) * 0.125f << " C, 0x" << modm::hex << ii << modm::ascii << '\n';
+	});
+	measure("printf", [](modm::IOStream& stream, uint32_t ii)
+	{
+		stream.printf("sensor %3u: %8ld mV, %7.3f C, 0x%08lx\n", unsigned(uint8_t(ii)),
+					  long(ii * 37) - 4'000'000, double(ii) * 0.125, (unsigned long)ii);
+	});
+
+	return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/math/matrix.hpp>
+#include <modm/math/lu_decomposition.hpp>
+
+// Measures the matrix kernels for square float and double matrices from 3x3 to
+// 16x16 against the naive triple loop and the separate L, U and P matrices.
+
+constexpr uint32_t TotalOperations = 1'000'000'000;
+
+// Hides the matrices from the optimizer, so that nothing is hoisted out of the loop
+static inline void
+clobber(const void* data)
+{
+	asm volatile("" : : "r"(data) : "memory");
+}
+
+template< typename T, uint8_t N >
+static modm::Matrix<T, N, N>
+naiveMultiply(const modm::Matrix<T, N, N> &a, const modm::Matrix<T, N, N> &b)
+{
+	modm::Matrix<T, N, N> m;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j < N; ++j) {
+			m[i][j] = a[i][0] * b[0][j];
+			for (uint_fast8_t x = 1; x < N; ++x) {
+				m[i][j] += a[i][x] * b[x][j];
+			}
+		}
+	}
+	return m;
+}
+
+template< class Function >
+static void
+measure(const char* type, uint8_t size, const char* name, uint32_t operations, Function&& function)
+{
+	// Roughly the same number of multiply-adds for every size
+	const uint32_t iterations = std::max<uint32_t>(TotalOperations / operations / 64, 1);
+	const auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < iterations; ii++)
+		function();
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t ns = uint64_t(duration.count()) * 1000 / iterations;
+	MODM_LOG_INFO.printf("%-6s %2ux%-2u %-20s %8llu ns\n", type, size, size, name, (unsigned long long)ns);
+}
+
+template< typename T, uint8_t N >
+static void
+sweep(const char* type)
+{
+	using Matrix = modm::Matrix<T, N, N>;
+	Matrix a, b, c, m;
+	for (uint_fast8_t i = 0; i < N; ++i) {
+		for (uint_fast8_t j = 0; j < N; ++j) {
+			a[i][j] = T(((i * 7 + j * 3) % 11) - 5) / 8;
+			b[i][j] = T(((i * 5 + j * 2) % 13) - 6) / 8;
+			c[i][j] = (i == j) ? T(N) : T(0);
+		}
+	}
+	const uint32_t cube = uint32_t(N) * N * N;
+
+	measure(type, N, "naive A*B", cube, [&] { clobber(&a); m = naiveMultiply(a, b); clobber(&m); });
+	measure(type, N, "A*B", cube, [&] { clobber(&a); m = a * b; clobber(&m); });
+	measure(type, N, "A*B + C", cube, [&] { clobber(&a); m = a * b + c; clobber(&m); });
+	measure(type, N, "A.multiplyAdd(B, C)", cube, [&] { clobber(&a); m = a.multiplyAdd(b, c); clobber(&m); });
+	measure(type, N, "A*B^T", cube, [&] { clobber(&a); m = a * b.asTransposed(); clobber(&m); });
+	measure(type, N, "A.multiplyTransposed", cube, [&] { clobber(&a); m = a.multiplyTransposed(b); clobber(&m); });
+
+	// Solve C*X = A, the diagonal of C dominates so that it is well conditioned
+	const Matrix s = c + a;
+	measure(type, N, "LU with L, U, P", cube, [&]
+	{
+		clobber(&s);
+		Matrix l, u, p;
+		modm::LUDecomposition::decompose(s, &l, &u, &p);
+		m = p * a;
+		modm::LUDecomposition::solve(l, u, &m);
+		clobber(&m);
+	});
+	measure(type, N, "LU in place", cube, [&]
+	{
+		clobber(&s);
+		m = a;
+		modm::LUDecomposition::solve(s, &m);
+		clobber(&m);
+	});
+	MODM_LOG_INFO << modm::endl;
+}
+
+template< typename T >
+static void
+sweep(const char* type)
+{
+	sweep<T, 3>(type);
+	sweep<T, 4>(type);
+	sweep<T, 6>(type);
+	sweep<T, 8>(type);
+	sweep<T, 12>(type);
+	sweep<T, 16>(type);
+}
+
+int
+main()
+{
+	sweep<float>("float");
+	sweep<double>("double");
+	return 0;
+}
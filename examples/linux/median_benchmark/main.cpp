@@ -0,0 +1,111 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/math/filter.hpp>
+#include <algorithm>
+
+// Measures the time per sample of the sorting networks of the Median, of
+// sorting a copy of the whole window for every sample and of the
+// OrderStatistic for windows from 9 to 1024 samples.
+
+constexpr uint32_t Samples = 1 << 12;
+constexpr uint64_t TotalOperations = 400'000'000;
+
+uint16_t input[Samples];
+uint16_t output;
+
+// Hides the result from the optimizer, so that every sample is computed
+static inline void
+clobber(const void* data)
+{
+	asm volatile("" : : "r"(data) : "memory");
+}
+
+template< class Function >
+static void
+measure(const char* name, std::size_t size, uint32_t cost, Function&& function)
+{
+	// Roughly the same number of operations for every window size
+	const uint32_t samples = std::clamp<uint64_t>(TotalOperations / cost, Samples, 100'000'000);
+	const auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < samples; ii++)
+	{
+		function(input[ii % Samples]);
+		clobber(&output);
+	}
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint64_t ns = uint64_t(duration.count()) * 1000 / samples;
+	MODM_LOG_INFO.printf("%-16s %4zu samples: %7llu ns/sample\n", name, size, (unsigned long long)ns);
+}
+
+template< std::size_t N >
+static void
+sweep()
+{
+	uint16_t window[N]{};
+	uint16_t sorted[N];
+	std::size_t index = 0;
+	measure("nth_element", N, N, [&](uint16_t sample)
+	{
+		window[index] = sample;
+		index = (index + 1) % N;
+		std::copy_n(window, N, sorted);
+		std::nth_element(sorted, sorted + (N - 1) / 2, sorted + N);
+		output = sorted[(N - 1) / 2];
+	});
+
+	modm::filter::OrderStatistic<uint16_t, N> filter;
+	measure("OrderStatistic", N, std::bit_width(N), [&](uint16_t sample)
+	{
+		filter.update(sample);
+		output = filter.getValue();
+	});
+	MODM_LOG_INFO << modm::endl;
+}
+
+template< int N >
+static void
+median()
+{
+	modm::filter::Median<uint16_t, N> filter;
+	measure("Median", N, N, [&](uint16_t sample)
+	{
+		filter.append(sample);
+		filter.update();
+		output = filter.getValue();
+	});
+}
+
+int
+main()
+{
+	// Noisy range measurements with spikes
+	uint32_t state = 1;
+	for (uint16_t& sample : input)
+	{
+		state = state * 1664525 + 1013904223;
+		sample = 1000 + (state >> 24);
+		if ((state & 0xf00) == 0) sample = 0xffff;
+	}
+
+	median<3>();
+	median<5>();
+	median<7>();
+	median<9>();
+	MODM_LOG_INFO << modm::endl;
+
+	sweep<9>();
+	sweep<64>();
+	sweep<256>();
+	sweep<1024>();
+	return 0;
+}
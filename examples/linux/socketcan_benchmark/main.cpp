@@ -0,0 +1,92 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/platform/can/socketcan.hpp>
+#include <sys/resource.h>
+#include <array>
+#include <algorithm>
+
+// Compares the throughput and CPU time of sending and receiving frames one
+// at a time against the batched sendMessages() and getMessages() functions.
+//
+// Requires a virtual CAN interface, which loops back all sent frames:
+//   sudo modprobe vcan
+//   sudo ip link add dev vcan0 type vcan
+//   sudo ip link set up vcan0
+
+constexpr uint32_t Frames = 1'000'000;
+constexpr size_t Batch = modm::platform::SocketCan::BatchSize;
+
+modm::platform::SocketCan tx;
+modm::platform::SocketCan rx;
+std::array<modm::can::Message, Batch> messages;
+
+static std::chrono::microseconds
+cpuTime()
+{
+	rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return std::chrono::seconds(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+		   std::chrono::microseconds(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+template< class Function >
+static void
+measure(const char* name, Function&& transfer)
+{
+	// Drain any leftover frames from a previous run
+	while (rx.getMessages(messages)) ;
+
+	const auto start = modm::PreciseClock::now();
+	const auto cpuStart = cpuTime();
+	uint32_t received{0};
+	for (uint32_t sent = 0; sent < Frames; sent += Batch)
+		received += transfer();
+	const auto cpu = cpuTime() - cpuStart;
+	const auto duration = modm::PreciseClock::now() - start;
+
+	const uint32_t rate = uint64_t(received) * 1'000'000ull / std::max(duration.count(), 1u);
+	MODM_LOG_INFO.printf("%-10s %7lu frames in %5llums: %7lu frames/s, %5llums CPU\n",
+			name, (unsigned long)received,
+			(unsigned long long)(duration.count() / 1000), (unsigned long)rate,
+			(unsigned long long)(cpu.count() / 1000));
+}
+
+int
+main()
+{
+	if (not tx.open("vcan0") or not rx.open("vcan0"))
+	{
+		MODM_LOG_ERROR << "Could not open vcan0!" << modm::endl;
+		return 1;
+	}
+	for (size_t ii = 0; ii < Batch; ii++)
+	{
+		messages[ii] = modm::can::Message(0x100 + ii, 8);
+		messages[ii].data[0] = ii;
+	}
+
+	measure("single", []
+	{
+		size_t received{0};
+		for (const auto& message : messages) tx.sendMessage(message);
+		for (auto& message : messages) received += rx.getMessage(message);
+		return received;
+	});
+
+	measure("batched", []
+	{
+		tx.sendMessages(messages);
+		return rx.getMessages(messages);
+	});
+
+	return 0;
+}
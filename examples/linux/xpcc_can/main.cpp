@@ -0,0 +1,125 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/can.hpp>
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/communication/xpcc/backend/can.hpp>
+#include <modm/debug.hpp>
+
+// Measures the throughput of fragmenting and reassembling packets in the
+// CanConnector by looping all CAN messages back into the same connector, and
+// of reassembling packets of several sources with interleaved fragments.
+
+constexpr uint32_t Packets = 100'000;
+constexpr uint8_t Sources = 8;
+
+// Mock CAN driver that receives all messages it sends
+class LoopbackCan : public modm::Can
+{
+public:
+	bool
+	isMessageAvailable() const
+	{ return head != tail; }
+
+	bool
+	getMessage(modm::can::Message& message)
+	{
+		if (head == tail) return false;
+		message = buffer[tail++ % Size];
+		return true;
+	}
+
+	bool
+	isReadyToSend() const
+	{ return head - tail < Size; }
+
+	bool
+	sendMessage(const modm::can::Message& message)
+	{
+		if (not isReadyToSend()) return false;
+		buffer[head++ % Size] = message;
+		return true;
+	}
+
+	static BusState
+	getBusState()
+	{ return BusState::Connected; }
+
+private:
+	static constexpr uint32_t Size = 64;
+	modm::can::Message buffer[Size];
+	uint32_t head{0};
+	uint32_t tail{0};
+};
+
+int
+main()
+{
+	LoopbackCan can;
+	xpcc::CanConnector<LoopbackCan> connector(&can);
+	const xpcc::Header header(xpcc::Header::Type::REQUEST, false, 0x12, 0x34, 0x56);
+
+	for (uint8_t size = 8; size <= 48; size += 8)
+	{
+		const modm::SmartPointer payload(size);
+		uint32_t received{0};
+
+		auto start = modm::PreciseClock::now();
+		for (uint32_t ii = 0; ii < Packets; ii++)
+		{
+			connector.sendPacket(header, payload);
+			while (not connector.isPacketAvailable()) connector.update();
+			received += connector.getPacketPayload().getSize() == size;
+			connector.dropPacket();
+		}
+		const auto loopback = modm::PreciseClock::now() - start;
+
+		// All fragments of one packet per source, interleaved by source
+		modm::can::Message frames[Sources * 8];
+		uint8_t count{0};
+		const uint8_t fragments = (size > 8) ? (size + 5) / 6 : 1;
+		for (uint8_t fragment = 0; fragment < fragments; fragment++)
+		{
+			for (uint8_t source = 0; source < Sources; source++)
+			{
+				xpcc::Header sourceHeader = header;
+				sourceHeader.source = 0x20 + source;
+				modm::can::Message& frame = frames[count++];
+				frame.identifier = xpcc::CanConnectorBase::convertToIdentifier(sourceHeader, size > 8);
+				if (size > 8)
+				{
+					frame.length = std::min(size - fragment * 6, 6) + 2;
+					frame.data[0] = fragment;
+					frame.data[1] = size;
+				}
+				else frame.length = size;
+			}
+		}
+
+		start = modm::PreciseClock::now();
+		for (uint32_t ii = 0; ii < Packets / Sources; ii++)
+		{
+			for (uint8_t frame = 0; frame < count; frame++)
+				can.sendMessage(frames[frame]);
+			connector.update();
+			while (connector.isPacketAvailable())
+			{
+				received += connector.getPacketPayload().getSize() == size;
+				connector.dropPacket();
+			}
+		}
+		const auto interleaved = modm::PreciseClock::now() - start;
+
+		MODM_LOG_INFO.printf("%2u bytes: %8lu packets/s loopback, %8lu packets/s from %u sources, %lu of %lu received\n",
+				size, (unsigned long)(uint64_t(Packets) * 1'000'000 / loopback.count()),
+				(unsigned long)(uint64_t(Packets) * 1'000'000 / interleaved.count()), Sources,
+				(unsigned long)received, (unsigned long)(Packets * 2));
+	}
+	return 0;
+}
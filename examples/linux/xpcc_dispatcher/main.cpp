@@ -0,0 +1,114 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <modm/communication/xpcc.hpp>
+#include <modm/communication/xpcc/abstract_component.hpp>
+
+// Measures the cost of matching received acknowledges to pending requests and
+// of an idle dispatcher update, while sweeping the number of outstanding
+// requests. Both should remain constant with the number of requests.
+
+constexpr uint32_t Packets = 100'000;
+constexpr uint32_t Updates = 100'000;
+
+// Receives acknowledges for all pending requests in a round-robin fashion
+class Backend : public xpcc::BackendInterface
+{
+public:
+	void update() override {}
+
+	void
+	sendPacket(const xpcc::Header&, modm::SmartPointer) override
+	{ sent++; }
+
+	bool
+	isPacketAvailable() const override
+	{ return received < available; }
+
+	const xpcc::Header&
+	getPacketHeader() const override
+	{ return header; }
+
+	const modm::SmartPointer
+	getPacketPayload() const override
+	{ return modm::SmartPointer(); }
+
+	void
+	dropPacket() override
+	{
+		received++;
+		const uint16_t index = received % requests;
+		header = xpcc::Header(xpcc::Header::Type::REQUEST, true,
+							  1, 2 + index / 256, index % 256);
+	}
+
+	xpcc::Header header{xpcc::Header::Type::REQUEST, true, 1, 2, 0};
+	uint32_t requests{1};
+	uint32_t available{0};
+	uint32_t received{0};
+	uint32_t sent{0};
+};
+
+class Postman : public xpcc::Postman
+{
+public:
+	DeliverInfo
+	deliverPacket(const xpcc::Header&, const modm::SmartPointer&) override
+	{ return OK; }
+
+	bool
+	isComponentAvailable(uint8_t component) const override
+	{ return component == 1; }
+};
+
+class Component : public xpcc::AbstractComponent
+{
+public:
+	using AbstractComponent::AbstractComponent;
+
+	void
+	response(const xpcc::Header&) {}
+
+	xpcc::ResponseCallback callback{this, &Component::response};
+};
+
+int
+main()
+{
+	for (uint32_t requests = 1; requests <= 4096; requests *= 4)
+	{
+		Backend backend;
+		Postman postman;
+		xpcc::Dispatcher dispatcher(&backend, &postman);
+		Component component(1, dispatcher);
+
+		// All requests wait for their response after the first acknowledge
+		backend.requests = requests;
+		for (uint32_t ii = 0; ii < requests; ii++)
+			component.getCommunicator()->callAction(2 + ii / 256, ii % 256, component.callback);
+		dispatcher.update();
+
+		backend.available = Packets;
+		auto start = modm::PreciseClock::now();
+		dispatcher.update();
+		const auto rx = modm::PreciseClock::now() - start;
+
+		start = modm::PreciseClock::now();
+		for (uint32_t ii = 0; ii < Updates; ii++) dispatcher.update();
+		const auto idle = modm::PreciseClock::now() - start;
+
+		MODM_LOG_INFO.printf("%5lu requests: %5lu ns per received packet, %5lu ns per idle update\n",
+				(unsigned long)requests,
+				(unsigned long)(uint64_t(rx.count()) * 1000 / Packets),
+				(unsigned long)(uint64_t(idle.count()) * 1000 / Updates));
+	}
+	return 0;
+}
@@ -0,0 +1,6 @@
+/*
+ * WARNING: This file is generated automatically by generate.py, do not edit!
+ */
+#pragma once
+#include "../node.hpp"
+namespace component { using Node04 = Node<0x04>; }
@@ -0,0 +1,163 @@
+/*
+ * WARNING: This file is generated automatically by generate.py, do not edit!
+ */
+#include "node.hpp"
+#include "component_node_01/node_01.hpp"
+#include "component_node_02/node_02.hpp"
+#include "component_node_03/node_03.hpp"
+#include "component_node_04/node_04.hpp"
+#include "component_node_05/node_05.hpp"
+#include "component_node_06/node_06.hpp"
+#include "component_node_07/node_07.hpp"
+#include "component_node_08/node_08.hpp"
+#include "component_node_09/node_09.hpp"
+#include "component_node_10/node_10.hpp"
+#include "component_node_11/node_11.hpp"
+#include "component_node_12/node_12.hpp"
+#include "component_node_13/node_13.hpp"
+#include "component_node_14/node_14.hpp"
+#include "component_node_15/node_15.hpp"
+#include "component_node_16/node_16.hpp"
+#include "component_node_17/node_17.hpp"
+#include "component_node_18/node_18.hpp"
+#include "component_node_19/node_19.hpp"
+#include "component_node_20/node_20.hpp"
+#include "component_node_21/node_21.hpp"
+#include "component_node_22/node_22.hpp"
+#include "component_node_23/node_23.hpp"
+#include "component_node_24/node_24.hpp"
+#include "component_node_25/node_25.hpp"
+#include "component_node_26/node_26.hpp"
+#include "component_node_27/node_27.hpp"
+#include "component_node_28/node_28.hpp"
+#include "component_node_29/node_29.hpp"
+#include "component_node_30/node_30.hpp"
+#include "component_node_31/node_31.hpp"
+#include "component_node_32/node_32.hpp"
+#include "component_node_33/node_33.hpp"
+#include "component_node_34/node_34.hpp"
+#include "component_node_35/node_35.hpp"
+#include "component_node_36/node_36.hpp"
+#include "component_node_37/node_37.hpp"
+#include "component_node_38/node_38.hpp"
+#include "component_node_39/node_39.hpp"
+#include "component_node_40/node_40.hpp"
+#include "component_node_41/node_41.hpp"
+#include "component_node_42/node_42.hpp"
+#include "component_node_43/node_43.hpp"
+#include "component_node_44/node_44.hpp"
+#include "component_node_45/node_45.hpp"
+#include "component_node_46/node_46.hpp"
+#include "component_node_47/node_47.hpp"
+#include "component_node_48/node_48.hpp"
+#include "component_node_49/node_49.hpp"
+#include "component_node_50/node_50.hpp"
+
+namespace component
+{
+	Node01 node01;
+	Node02 node02;
+	Node03 node03;
+	Node04 node04;
+	Node05 node05;
+	Node06 node06;
+	Node07 node07;
+	Node08 node08;
+	Node09 node09;
+	Node10 node10;
+	Node11 node11;
+	Node12 node12;
+	Node13 node13;
+	Node14 node14;
+	Node15 node15;
+	Node16 node16;
+	Node17 node17;
+	Node18 node18;
+	Node19 node19;
+	Node20 node20;
+	Node21 node21;
+	Node22 node22;
+	Node23 node23;
+	Node24 node24;
+	Node25 node25;
+	Node26 node26;
+	Node27 node27;
+	Node28 node28;
+	Node29 node29;
+	Node30 node30;
+	Node31 node31;
+	Node32 node32;
+	Node33 node33;
+	Node34 node34;
+	Node35 node35;
+	Node36 node36;
+	Node37 node37;
+	Node38 node38;
+	Node39 node39;
+	Node40 node40;
+	Node41 node41;
+	Node42 node42;
+	Node43 node43;
+	Node44 node44;
+	Node45 node45;
+	Node46 node46;
+	Node47 node47;
+	Node48 node48;
+	Node49 node49;
+	Node50 node50;
+}
+
+void
+registerActions(xpcc::DynamicPostman& postman)
+{
+	registerActions(postman, component::node01);
+	registerActions(postman, component::node02);
+	registerActions(postman, component::node03);
+	registerActions(postman, component::node04);
+	registerActions(postman, component::node05);
+	registerActions(postman, component::node06);
+	registerActions(postman, component::node07);
+	registerActions(postman, component::node08);
+	registerActions(postman, component::node09);
+	registerActions(postman, component::node10);
+	registerActions(postman, component::node11);
+	registerActions(postman, component::node12);
+	registerActions(postman, component::node13);
+	registerActions(postman, component::node14);
+	registerActions(postman, component::node15);
+	registerActions(postman, component::node16);
+	registerActions(postman, component::node17);
+	registerActions(postman, component::node18);
+	registerActions(postman, component::node19);
+	registerActions(postman, component::node20);
+	registerActions(postman, component::node21);
+	registerActions(postman, component::node22);
+	registerActions(postman, component::node23);
+	registerActions(postman, component::node24);
+	registerActions(postman, component::node25);
+	registerActions(postman, component::node26);
+	registerActions(postman, component::node27);
+	registerActions(postman, component::node28);
+	registerActions(postman, component::node29);
+	registerActions(postman, component::node30);
+	registerActions(postman, component::node31);
+	registerActions(postman, component::node32);
+	registerActions(postman, component::node33);
+	registerActions(postman, component::node34);
+	registerActions(postman, component::node35);
+	registerActions(postman, component::node36);
+	registerActions(postman, component::node37);
+	registerActions(postman, component::node38);
+	registerActions(postman, component::node39);
+	registerActions(postman, component::node40);
+	registerActions(postman, component::node41);
+	registerActions(postman, component::node42);
+	registerActions(postman, component::node43);
+	registerActions(postman, component::node44);
+	registerActions(postman, component::node45);
+	registerActions(postman, component::node46);
+	registerActions(postman, component::node47);
+	registerActions(postman, component::node48);
+	registerActions(postman, component::node49);
+	registerActions(postman, component::node50);
+}
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# This file is part of the modm project.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# -----------------------------------------------------------------------------
+
+"""
+Generates the XPCC description and component headers of the benchmark:
+50 components with 8 actions each, i.e. 400 actions in total.
+"""
+
+import os
+
+COMPONENTS = 50
+
+ACTIONS = [
+	("get status", None),
+	("set mode", "uint8_t"),
+	("start", None),
+	("stop", None),
+	("reset", None),
+	("set speed", "int16_t"),
+	("get speed", None),
+	("ping", None),
+]
+
+HEADER = """\
+/*
+ * WARNING: This file is generated automatically by generate.py, do not edit!
+ */
+#pragma once
+#include "../node.hpp"
+namespace component {{ using Node{0:02} = Node<0x{0:02x}>; }}
+"""
+
+SOURCE = """\
+/*
+ * WARNING: This file is generated automatically by generate.py, do not edit!
+ */
+#include "node.hpp"
+{includes}
+
+namespace component
+{{
+{instances}
+}}
+
+void
+registerActions(xpcc::DynamicPostman& postman)
+{{
+{registrations}
+}}
+"""
+
+def actions():
+	for index, (name, parameter) in enumerate(ACTIONS, start=1):
+		parameter = ' parameterType="{}"'.format(parameter) if parameter else ""
+		yield '\t\t<action name="{}" id="0x{:02x}"{} />'.format(name, index, parameter)
+
+def main():
+	xml = ["<?xml version='1.0' encoding='UTF-8' ?>",
+		   '<!DOCTYPE rca SYSTEM "../../xpcc/xml/communication.dtd">',
+		   '<rca version="1.0">',
+		   '<!-- WARNING: This file is generated automatically by generate.py, do not edit! -->',
+		   '<builtin name="uint8_t" size="1" />',
+		   '<builtin name="int16_t" size="2" />',
+		   '',
+		   '<component name="node">',
+		   '\t<actions>', *actions(), '\t</actions>',
+		   '</component>', '']
+	for node in range(1, COMPONENTS + 1):
+		xml.append('<component name="node {0:02}" id="0x{0:02x}" extends="node" />'.format(node))
+	xml += ['', '<container name="benchmark" id="0x10">']
+	for node in range(1, COMPONENTS + 1):
+		xml.append('\t<component name="node {:02}" />'.format(node))
+	xml += ['</container>', '</rca>', '']
+	with open("communication.xml", "w") as xmlfile:
+		xmlfile.write("\n".join(xml))
+
+	nodes = range(1, COMPONENTS + 1)
+	with open("components.cpp", "w") as source:
+		source.write(SOURCE.format(
+			includes="\n".join('#include "component_node_{0:02}/node_{0:02}.hpp"'.format(n) for n in nodes),
+			instances="\n".join("\tNode{0:02} node{0:02};".format(n) for n in nodes),
+			registrations="\n".join("\tregisterActions(postman, component::node{:02});".format(n) for n in nodes)))
+
+	for node in nodes:
+		path = "component_node_{:02}".format(node)
+		os.makedirs(path, exist_ok=True)
+		with open(os.path.join(path, "node_{:02}.hpp".format(node)), "w") as header:
+			header.write(HEADER.format(node))
+
+if __name__ == "__main__":
+	main()
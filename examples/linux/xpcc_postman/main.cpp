@@ -0,0 +1,70 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/debug.hpp>
+#include <postman.hpp>
+#include "node.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Measures the throughput of delivering requests for 50 components with
+// 8 actions each through the generated Postman and the DynamicPostman.
+// Run generate.py to regenerate the XML description and components.
+
+constexpr uint32_t Rounds = 20'000;
+
+void
+benchmark(const char *name, xpcc::Postman& postman, const std::vector<xpcc::Header>& headers)
+{
+	const int16_t value{1};
+	const modm::SmartPointer payload(&value);
+
+	auto start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Rounds; ii++)
+		for (const xpcc::Header& header : headers)
+			postman.deliverPacket(header, payload);
+	const auto deliver = modm::PreciseClock::now() - start;
+
+	uint32_t available{0};
+	start = modm::PreciseClock::now();
+	for (uint32_t ii = 0; ii < Rounds; ii++)
+		for (uint16_t component = 0; component < 256; component++)
+			available += postman.isComponentAvailable(component);
+	const auto lookup = modm::PreciseClock::now() - start;
+
+	MODM_LOG_INFO.printf("%-9s: %9lu deliveries/s, %3lu ns per isComponentAvailable(), %lu available\n",
+			name, (unsigned long)(uint64_t(Rounds) * headers.size() * 1'000'000 / deliver.count()),
+			(unsigned long)(uint64_t(lookup.count()) * 1000 / (Rounds * 256)),
+			(unsigned long)(available / Rounds));
+}
+
+int
+main()
+{
+	// All actions in random order
+	std::vector<xpcc::Header> headers;
+	for (uint8_t node = 0x01; node <= 0x32; node++)
+		for (uint8_t action = 0x01; action <= 0x08; action++)
+			headers.emplace_back(xpcc::Header::Type::REQUEST, false, node, 0x80, action);
+	std::shuffle(headers.begin(), headers.end(), std::mt19937{42});
+
+	Postman postman;
+	benchmark("generated", postman, headers);
+
+	xpcc::DynamicPostman dynamicPostman;
+	registerActions(dynamicPostman);
+	benchmark("dynamic", dynamicPostman, headers);
+
+	MODM_LOG_INFO.printf("%lu action calls\n", (unsigned long)component::calls);
+
+	return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/communication/xpcc/postman/dynamic_postman.hpp>
+#include <identifier.hpp>
+
+namespace component
+{
+
+/// Sum of all action calls, so that the calls cannot be optimized away
+inline uint32_t calls{0};
+
+/// All nodes have the same actions, the generated Postman uses the pointer
+/// overloads, the DynamicPostman the reference overloads.
+template< uint8_t Id >
+class Node
+{
+public:
+	void actionGetStatus(const xpcc::ResponseHandle&) { calls += 1; }
+	void actionSetMode(const xpcc::ResponseHandle&, const uint8_t *mode) { calls += *mode; }
+	void actionSetMode(const xpcc::ResponseHandle&, const uint8_t& mode) { calls += mode; }
+	void actionStart(const xpcc::ResponseHandle&) { calls += 2; }
+	void actionStop(const xpcc::ResponseHandle&) { calls += 3; }
+	void actionReset(const xpcc::ResponseHandle&) { calls += 4; }
+	void actionSetSpeed(const xpcc::ResponseHandle&, const int16_t *speed) { calls += *speed; }
+	void actionSetSpeed(const xpcc::ResponseHandle&, const int16_t& speed) { calls += speed; }
+	void actionGetSpeed(const xpcc::ResponseHandle&) { calls += 5; }
+	void actionPing(const xpcc::ResponseHandle&) { calls += Id; }
+};
+
+}	// namespace component
+
+template< uint8_t Id >
+void
+registerActions(xpcc::DynamicPostman& postman, component::Node<Id>& node)
+{
+	using Node = component::Node<Id>;
+	using Mode = void (Node::*)(const xpcc::ResponseHandle&, const uint8_t&);
+	using Speed = void (Node::*)(const xpcc::ResponseHandle&, const int16_t&);
+	postman.registerActionHandler(Id, robot::action::GET_STATUS, &node, &Node::actionGetStatus);
+	postman.registerActionHandler(Id, robot::action::SET_MODE, &node, Mode(&Node::actionSetMode));
+	postman.registerActionHandler(Id, robot::action::START, &node, &Node::actionStart);
+	postman.registerActionHandler(Id, robot::action::STOP, &node, &Node::actionStop);
+	postman.registerActionHandler(Id, robot::action::RESET, &node, &Node::actionReset);
+	postman.registerActionHandler(Id, robot::action::SET_SPEED, &node, Speed(&Node::actionSetSpeed));
+	postman.registerActionHandler(Id, robot::action::GET_SPEED, &node, &Node::actionGetSpeed);
+	postman.registerActionHandler(Id, robot::action::PING, &node, &Node::actionPing);
+}
+
+/// Instantiates all nodes and registers their actions
+void
+registerActions(xpcc::DynamicPostman& postman);
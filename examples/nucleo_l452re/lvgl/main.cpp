@@ -16,6 +16,7 @@
 #include <modm/driver/touch/touch2046.hpp>
 
 #include <lvgl/lvgl.h>
+#include <lv_modm_display.hpp>
 
 
 // Set the log level
@@ -62,8 +63,13 @@ namespace touch
 modm::Touch2046<touch::Spi, touch::Cs> touchController;
 
 
-static constexpr size_t buf_size = LV_HOR_RES_MAX * LV_VER_RES_MAX / 8;
-static modm_aligned(4) lv_color_t buf[buf_size];
+// LVGL renders into one buffer while the other one is transferred via DMA
+static constexpr size_t buf_size = LV_HOR_RES_MAX * LV_VER_RES_MAX / 16;
+static modm_aligned(4) lv_color_t buf1[buf_size];
+static modm_aligned(4) lv_color_t buf2[buf_size];
+
+lv_display_t *disp = lv_display_create(LV_HOR_RES_MAX, LV_VER_RES_MAX);
+modm::LvglDisplay flush{tftController, disp};
 
 void my_touchpad_read(lv_indev_t*, lv_indev_data_t* data)
 {
@@ -75,15 +81,34 @@ void my_touchpad_read(lv_indev_t*, lv_indev_data_t* data)
 	}
 }
 
-void disp_flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
+modm::Fiber fiber_flush([]
 {
-	tftController.drawRaw(
-		{area->x1, area->y1},
-		(area->x2 - area->x1 +1),
-		(area->y2 - area->y1 + 1),
-		(modm::color::Rgb565*)px_map);
-	lv_display_flush_ready(disp);
-}
+	while (true)
+	{
+		// Yields while the tile is transferred
+		flush.update();
+		modm::this_fiber::yield();
+	}
+});
+
+lv_obj_t* labelA;
+
+modm::Fiber<4096> fiber_gui([]
+{
+	uint16_t counter = 0;
+	modm::ShortPeriodicTimer tmr{10ms};
+
+	while (true)
+	{
+		lv_timer_handler();
+
+		if (tmr.execute())
+		{
+			lv_label_set_text_fmt(labelA, "counter=%d", ++counter);
+		}
+		modm::this_fiber::yield();
+	}
+});
 
 int
 main()
@@ -117,16 +142,14 @@ main()
 
 	MODM_LOG_INFO << "modm LVGL example on Nucleo-L452RE board!\n\n";
 
-	lv_display_t *disp = lv_display_create(LV_HOR_RES_MAX, LV_VER_RES_MAX);
-	lv_display_set_flush_cb(disp, disp_flush);
-	lv_display_set_buffers(disp, buf, NULL, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+	lv_display_set_buffers(disp, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
 
 	// Initialize touchscreen driver:
 	lv_indev_t* indev = lv_indev_create();
 	lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
 	lv_indev_set_read_cb(indev, my_touchpad_read);
 
-	lv_obj_t* labelA =  lv_label_create(lv_screen_active());
+	labelA = lv_label_create(lv_screen_active());
 	lv_label_set_text(labelA, "Hello world!");
 	lv_obj_set_pos(labelA, 60, 10);
 	lv_obj_set_size(labelA, 120, 50);
@@ -150,19 +173,7 @@ main()
 	lv_obj_set_pos(labelB, 40, 260);
 	lv_obj_set_style_text_font(labelB, &lv_font_montserrat_36, LV_PART_MAIN);
 
-	uint16_t counter = 0;
-
-	modm::ShortPeriodicTimer tmr{10ms};
-
-	while (true)
-	{
-		lv_timer_handler();
-
-		if (tmr.execute())
-		{
-			lv_label_set_text_fmt(labelA, "counter=%d", ++counter);
-		}
-	}
+	modm::fiber::Scheduler::run();
 
 	return 0;
 }
@@ -0,0 +1,135 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <lvgl/lvgl.h>
+#include <modm/processing/resumable.hpp>
+#include <modm/ui/color/rgb565.hpp>
+#include <modm/ui/display/graphic_display.hpp>
+
+namespace modm
+{
+
+/**
+ * Flushes an LVGL display to a display driver with an asynchronous
+ * `writeTile()`, such as `modm::Ili9341`.
+ *
+ * The flush callback only takes over the tile, which is then written by
+ * `update()`. With two draw buffers, LVGL renders into one buffer while the
+ * other one is transferred and only waits for the transfer before flushing the
+ * next tile.
+ *
+ * With protothreads, the flush callback starts the transfer and `update()`
+ * must be called from the main loop until it is complete. With fibers, call
+ * `update()` in a loop of a separate fiber, which the flush callback yields to
+ * and which yields itself while the tile is transferred. Without such a fiber,
+ * the tile is only written when LVGL waits for it.
+ *
+ * @code
+ * lv_display_set_buffers(disp, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+ * modm::LvglDisplay flush{tftController, disp};
+ * while (true)
+ * {
+ *     lv_timer_handler();
+ *     flush.update();
+ * }
+ * @endcode
+ *
+ * @ingroup modm_lvgl
+ */
+template< class Display >
+class LvglDisplay
+{
+public:
+	LvglDisplay(Display& display, lv_display_t* disp) :
+		display{display}, disp{disp}
+	{
+		lv_display_set_user_data(disp, this);
+		lv_display_set_flush_cb(disp, flush);
+		lv_display_set_flush_wait_cb(disp, wait);
+	}
+
+	LvglDisplay(const LvglDisplay&) = delete;
+	LvglDisplay& operator=(const LvglDisplay&) = delete;
+
+	/// Writes the pending tile and signals LVGL once it is complete.
+	void
+	update()
+	{
+		if (state == State::Idle) return;
+#ifdef MODM_RESUMABLE_IS_FIBER
+		// Another fiber is already writing the tile
+		if (state == State::Writing) return;
+		state = State::Writing;
+		display.writeTile(upperLeft, width, height, pixels);
+#else
+		state = State::Writing;
+		if (display.writeTile(upperLeft, width, height, pixels).getState() == modm::rf::Running)
+			return;
+#endif
+		state = State::Idle;
+		lv_display_flush_ready(disp);
+	}
+
+	/// @return `true` while a tile is pending or being written.
+	bool
+	isFlushing() const
+	{ return state != State::Idle; }
+
+protected:
+	static void
+	flush(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map)
+	{
+		auto* self = static_cast<LvglDisplay*>(lv_display_get_user_data(disp));
+		self->upperLeft = glcd::Point(area->x1, area->y1);
+		self->width = lv_area_get_width(area);
+		self->height = lv_area_get_height(area);
+		self->pixels = reinterpret_cast<color::Rgb565*>(px_map);
+		self->state = State::Pending;
+#ifdef MODM_RESUMABLE_IS_FIBER
+		// Let the fiber calling update() start the transfer
+		modm::this_fiber::yield();
+#else
+		// Start the transfer right away
+		self->update();
+#endif
+	}
+
+	static void
+	wait(lv_display_t* disp)
+	{
+		auto* self = static_cast<LvglDisplay*>(lv_display_get_user_data(disp));
+		while (self->isFlushing())
+		{
+			self->update();
+#ifdef MODM_RESUMABLE_IS_FIBER
+			if (self->isFlushing()) modm::this_fiber::yield();
+#endif
+		}
+	}
+
+	enum class
+	State : uint8_t
+	{
+		Idle,
+		Pending,
+		Writing,
+	};
+
+	Display& display;
+	lv_display_t* const disp;
+	glcd::Point upperLeft;
+	uint16_t width{0};
+	uint16_t height{0};
+	color::Rgb565* pixels{nullptr};
+	State state{State::Idle};
+};
+
+}	// namespace modm
@@ -31,6 +31,9 @@ namespace modm
 		 *
 		 * A maximum size of 254 is allowed for 8-bit microcontrollers.
 		 *
+		 * \see	modm::atomic::SpscRing and modm::atomic::MpscRing for
+		 * 		lock-free rings with bulk operations.
+		 *
 		 * \todo	This implementation should work but could be improved
 		 */
 		template<typename T, std::size_t N>
@@ -0,0 +1,327 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/detect.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace modm::atomic
+{
+
+/// @cond
+namespace detail
+{
+
+#ifdef MODM_OS_HOSTED
+// Separate the indices of producer and consumer into their own cache lines
+inline constexpr std::size_t RingIndexAlignment{64};
+#else
+inline constexpr std::size_t RingIndexAlignment{alignof(std::size_t)};
+#endif
+
+template< std::size_t N >
+using RingIndex = std::conditional_t< (N <= 0x8000), uint16_t, uint32_t >;
+
+}	// namespace detail
+/// @endcond
+
+/**
+ * Lock-free single-producer, single-consumer ring buffer.
+ *
+ * The indices are free-running and only wrapped when accessing the storage,
+ * so that all `N` elements can be used. The producer publishes elements with
+ * a release store of the head, the consumer frees them with a release store
+ * of the tail.
+ *
+ * Besides single elements, elements can be copied in bulk or accessed in
+ * place as contiguous regions, for example as the source or destination of a
+ * DMA transfer:
+ *
+ * @code
+ * auto region = ring.getReadRegion();
+ * // transfer region.data() and region.size() via DMA, then:
+ * ring.commitRead(region.size());
+ * @endcode
+ *
+ * @tparam	T	Element type, must be trivially copyable.
+ * @tparam	N	Capacity, must be a power of two.
+ *
+ * @note One producer and one consumer may run concurrently in different
+ *       contexts, for example the main loop and an interrupt.
+ *
+ * @ingroup	modm_architecture_atomic
+ */
+template< typename T, std::size_t N >
+class SpscRing
+{
+	static_assert((N & (N - 1)) == 0 and N >= 2, "Capacity must be a power of two!");
+	static_assert(N <= 0x8000'0000, "Capacity must fit into 31 bits!");
+	static_assert(std::is_trivially_copyable_v<T>, "Elements must be trivially copyable!");
+
+public:
+	using Index = detail::RingIndex<N>;
+	using Size = Index;
+
+	constexpr SpscRing() = default;
+
+	SpscRing(const SpscRing&) = delete;
+	SpscRing& operator=(const SpscRing&) = delete;
+
+	bool
+	isEmpty() const
+	{ return getSize() == 0; }
+
+	bool
+	isFull() const
+	{ return getSize() == N; }
+
+	static constexpr Size
+	getMaxSize()
+	{ return N; }
+
+	Size
+	getSize() const
+	{ return Index(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire)); }
+
+	/// @return `false` if the ring is full.
+	bool
+	push(const T& value)
+	{
+		const Index index = head.load(std::memory_order_relaxed);
+		if (Index(index - tail.load(std::memory_order_acquire)) == N) return false;
+		buffer[index & Mask] = value;
+		head.store(index + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// Copies as many elements as fit into the ring.
+	/// @return number of elements pushed
+	std::size_t
+	push(std::span<const T> values)
+	{
+		const Index index = head.load(std::memory_order_relaxed);
+		const std::size_t count = std::min<std::size_t>(values.size(),
+				N - Index(index - tail.load(std::memory_order_acquire)));
+		copy(values.data(), count, index);
+		head.store(index + count, std::memory_order_release);
+		return count;
+	}
+
+	/// @return `false` if the ring is empty.
+	bool
+	pop(T& value)
+	{
+		const Index index = tail.load(std::memory_order_relaxed);
+		if (index == head.load(std::memory_order_acquire)) return false;
+		value = buffer[index & Mask];
+		tail.store(index + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// Copies as many elements as available out of the ring.
+	/// @return number of elements popped
+	std::size_t
+	pop(std::span<T> values)
+	{
+		const Index index = tail.load(std::memory_order_relaxed);
+		const std::size_t count = std::min<std::size_t>(values.size(),
+				Index(head.load(std::memory_order_acquire) - index));
+		const std::size_t first = std::min(count, N - (index & Mask));
+		std::copy_n(buffer + (index & Mask), first, values.data());
+		std::copy_n(buffer, count - first, values.data() + first);
+		tail.store(index + count, std::memory_order_release);
+		return count;
+	}
+
+	/// @return the oldest element, the ring must not be empty.
+	const T&
+	get() const
+	{ return buffer[tail.load(std::memory_order_relaxed) & Mask]; }
+
+	/// @return contiguous free region behind the head, which may be shorter
+	///         than the free space if it wraps around.
+	std::span<T>
+	getWriteRegion()
+	{
+		const Index index = head.load(std::memory_order_relaxed);
+		const std::size_t free = N - Index(index - tail.load(std::memory_order_acquire));
+		return {buffer + (index & Mask), std::min(free, N - (index & Mask))};
+	}
+
+	/// Publishes `count` elements written into the region.
+	void
+	commitWrite(std::size_t count)
+	{ head.store(head.load(std::memory_order_relaxed) + count, std::memory_order_release); }
+
+	/// @return contiguous region of elements in front of the tail, which may
+	///         be shorter than the size if it wraps around.
+	std::span<const T>
+	getReadRegion() const
+	{
+		const Index index = tail.load(std::memory_order_relaxed);
+		const std::size_t used = Index(head.load(std::memory_order_acquire) - index);
+		return {buffer + (index & Mask), std::min(used, N - (index & Mask))};
+	}
+
+	/// Frees `count` elements read from the region.
+	void
+	commitRead(std::size_t count)
+	{ tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release); }
+
+protected:
+	static constexpr Index Mask = N - 1;
+
+	void
+	copy(const T* values, std::size_t count, Index index)
+	{
+		const std::size_t first = std::min(count, N - (index & Mask));
+		std::copy_n(values, first, buffer + (index & Mask));
+		std::copy_n(values + first, count - first, buffer);
+	}
+
+	alignas(detail::RingIndexAlignment) std::atomic<Index> head{0};
+	alignas(detail::RingIndexAlignment) std::atomic<Index> tail{0};
+	T buffer[N]{};
+};
+
+/**
+ * Lock-free multi-producer, single-consumer ring buffer.
+ *
+ * Producers reserve elements with a compare-and-swap of the head, copy their
+ * values and then publish each element by storing its position in a sequence
+ * number. The consumer stops at the first unpublished element, so a producer
+ * interrupted after its reservation only delays the elements behind it and
+ * producers in interrupts never wait for each other.
+ *
+ * The consumer interface and the contiguous read region are the same as for
+ * the `SpscRing`.
+ *
+ * @tparam	T	Element type, must be trivially copyable.
+ * @tparam	N	Capacity, must be a power of two.
+ *
+ * @ingroup	modm_architecture_atomic
+ */
+template< typename T, std::size_t N >
+class MpscRing
+{
+	static_assert((N & (N - 1)) == 0 and N >= 2, "Capacity must be a power of two!");
+	static_assert(N <= 0x8000'0000, "Capacity must fit into 31 bits!");
+	static_assert(std::is_trivially_copyable_v<T>, "Elements must be trivially copyable!");
+
+public:
+	using Index = detail::RingIndex<N>;
+	using Size = Index;
+
+	constexpr MpscRing() = default;
+
+	MpscRing(const MpscRing&) = delete;
+	MpscRing& operator=(const MpscRing&) = delete;
+
+	bool
+	isEmpty() const
+	{ return getSize() == 0; }
+
+	bool
+	isFull() const
+	{ return getSize() == N; }
+
+	static constexpr Size
+	getMaxSize()
+	{ return N; }
+
+	/// @return number of reserved elements, including unpublished ones.
+	Size
+	getSize() const
+	{ return Index(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire)); }
+
+	/// @return `false` if the ring is full.
+	/// @note This function can be called from an interrupt.
+	bool
+	push(const T& value)
+	{ return push(std::span{&value, 1}) == 1; }
+
+	/// Reserves as many elements as fit into the ring and copies them.
+	/// @return number of elements pushed
+	/// @note This function can be called from an interrupt.
+	std::size_t
+	push(std::span<const T> values)
+	{
+		Index index = head.load(std::memory_order_relaxed);
+		std::size_t count;
+		do
+		{
+			count = std::min<std::size_t>(values.size(),
+					N - Index(index - tail.load(std::memory_order_acquire)));
+			if (count == 0) return 0;
+		}
+		while (not head.compare_exchange_weak(index, index + count, std::memory_order_relaxed));
+
+		for (std::size_t ii = 0; ii < count; ii++, index++)
+		{
+			buffer[index & Mask] = values[ii];
+			sequence[index & Mask].store(index + 1, std::memory_order_release);
+		}
+		return count;
+	}
+
+	/// @return `false` if no published element is available.
+	bool
+	pop(T& value)
+	{ return pop(std::span{&value, 1}) == 1; }
+
+	/// Copies as many published elements as available out of the ring.
+	/// @return number of elements popped
+	std::size_t
+	pop(std::span<T> values)
+	{
+		const Index index = tail.load(std::memory_order_relaxed);
+		std::size_t count{0};
+		for (; count < values.size() and isPublished(index + count); count++)
+			values[count] = buffer[(index + count) & Mask];
+		tail.store(index + count, std::memory_order_release);
+		return count;
+	}
+
+	/// @return contiguous region of published elements in front of the tail.
+	std::span<const T>
+	getReadRegion() const
+	{
+		const Index index = tail.load(std::memory_order_relaxed);
+		const std::size_t end = N - (index & Mask);
+		std::size_t count{0};
+		while (count < end and isPublished(index + count)) count++;
+		return {buffer + (index & Mask), count};
+	}
+
+	/// Frees `count` elements read from the region.
+	void
+	commitRead(std::size_t count)
+	{ tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release); }
+
+protected:
+	static constexpr Index Mask = N - 1;
+
+	bool
+	isPublished(Index index) const
+	{ return sequence[index & Mask].load(std::memory_order_acquire) == Index(index + 1); }
+
+	alignas(detail::RingIndexAlignment) std::atomic<Index> head{0};
+	alignas(detail::RingIndexAlignment) std::atomic<Index> tail{0};
+	std::atomic<Index> sequence[N]{};
+	T buffer[N]{};
+};
+
+}	// namespace modm::atomic
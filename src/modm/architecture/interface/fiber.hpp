@@ -26,6 +26,23 @@ using id = uintptr_t;
 
 } // namespace modm::fiber
 
+/// @cond
+namespace modm::this_fiber::detail
+{
+
+/// Suspends the current fiber until `duration` has passed since `start`.
+/// The duration must be shorter than 2^31 clock ticks.
+void
+sleep(modm::chrono::milli_clock::time_point start, modm::chrono::milli_clock::duration duration);
+
+/// Suspends the current fiber until `duration` has passed since `start`.
+/// The duration must be shorter than 2^31 clock ticks.
+void
+sleep(modm::chrono::micro_clock::time_point start, modm::chrono::micro_clock::duration duration);
+
+} // namespace modm::this_fiber::detail
+/// @endcond
+
 namespace modm::this_fiber
 {
 
@@ -134,7 +151,9 @@ poll_until(std::chrono::time_point<Clock, Duration> sleep_time, Function &&condi
 }
 
 /**
- * Yields the current fiber until the time duration has elapsed.
+ * Suspends the current fiber until the time duration has elapsed.
+ * The fiber is not scheduled while sleeping, so this does not poll the clock.
+ * A zero or negative duration yields only once.
  *
  * @note For nanosecond delays, use `modm::delay(ns)`.
  * @note Due to the overhead of `yield()` and the scheduling other fibers, the
@@ -145,11 +164,33 @@ template< class Rep, class Period >
 void
 sleep_for(std::chrono::duration<Rep, Period> sleep_duration)
 {
-	(void) poll_for(sleep_duration, []{ return false; });
+	if (sleep_duration <= sleep_duration.zero()) return modm::this_fiber::yield();
+
+	// Only choose the microsecond clock if necessary
+	using Clock = std::conditional_t<
+		std::is_convertible_v<std::chrono::duration<Rep, Period>,
+							  std::chrono::duration<Rep, std::milli>>,
+		modm::chrono::milli_clock, modm::chrono::micro_clock>;
+
+	// Ensure the sleep duration is rounded up to the next full clock tick
+	auto clock_sleep_duration(std::chrono::ceil<typename Clock::duration>(sleep_duration));
+
+	// Split sleeps longer than the scheduler can handle in one go
+	constexpr typename Clock::duration max_duration{uint32_t(INT32_MAX)};
+	auto start = Clock::now();
+	while (clock_sleep_duration > max_duration)
+	{
+		detail::sleep(start, max_duration);
+		start += max_duration;
+		clock_sleep_duration -= max_duration;
+	}
+	detail::sleep(start, clock_sleep_duration);
 }
 
 /**
- * Yields the current fiber until the sleep time has been reached.
+ * Suspends the current fiber until the sleep time has been reached.
+ * For `modm::Clock` and `modm::PreciseClock` the fiber is not scheduled while
+ * sleeping, other clocks are polled.
  *
  * @note Due to the overhead of `yield()` and the scheduling other fibers, the
  *       sleep duration may be longer without any guarantee of an upper limit.
@@ -159,7 +200,12 @@ template< class Clock, class Duration >
 void
 sleep_until(std::chrono::time_point<Clock, Duration> sleep_time)
 {
-	(void) poll_until(sleep_time, []{ return false; });
+	if constexpr (std::is_same_v<Clock, modm::chrono::milli_clock> or
+				  std::is_same_v<Clock, modm::chrono::micro_clock>)
+	{
+		sleep_for(sleep_time - Clock::now());
+	}
+	else (void) poll_until(sleep_time, []{ return false; });
 }
 
 /// @}
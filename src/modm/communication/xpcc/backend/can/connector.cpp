@@ -13,6 +13,7 @@
 // ----------------------------------------------------------------------------
 
 #include <stdlib.h>
+#include <cstring>
 
 #include "connector.hpp"
 
@@ -114,3 +115,127 @@ xpcc::CanConnectorBase::getNumberOfFragments(uint8_t messageSize)
 	div_t n = div(messageSize, 6);
 	return (n.rem > 0) ? n.quot + 1 : n.quot;
 }
+
+// ----------------------------------------------------------------------------
+bool
+xpcc::CanConnectorBase::receiveFragment(const Header& header,
+		const uint8_t *data, uint8_t length)
+{
+	const uint8_t fragmentIndex = data[0] & 0x0f;
+	const uint8_t counter = data[0] & 0xf0;
+	const uint8_t messageSize = data[1];
+
+	// calculate the number of messages need to send messageSize-bytes
+	const uint8_t numberOfFragments = getNumberOfFragments(messageSize);
+
+	if (length < 3 || messageSize > 48 ||
+			fragmentIndex >= numberOfFragments)
+	{
+		// illegal format:
+		//   fragmented messages need to have at least 3 byte payload,
+		// 	 the maximum size is 48 Bytes and the fragment number
+		//	 should not be higher than the number of fragments.
+		return false;
+	}
+
+	// check the length of the fragment (all fragments except the
+	// last one need to have a payload-length of 6 bytes + 2 byte
+	// fragment information)
+	const uint8_t offset = fragmentIndex * 6;
+	if (fragmentIndex + 1 == numberOfFragments)
+	{
+		// this one is the last fragment
+		if (messageSize - offset != length - 2) {
+			// illegal format
+			return false;
+		}
+	}
+	else if (length != 8) {
+		// illegal format
+		return false;
+	}
+
+	// Probe from the home slot until either the packet or a free slot is
+	// found. Slots are kept contiguous on removal, so a free slot ends the
+	// search.
+	const uint8_t home = getHomeSlot(header);
+	uint8_t index = home;
+	for (uint8_t ii = 0; ii < ReassemblySlots; ++ii)
+	{
+		const Slot& slot = slots[index];
+		if (not slot.used or
+			(slot.header == header and slot.counter == counter)) {
+			break;
+		}
+		index = (index + 1) & (ReassemblySlots - 1);
+	}
+
+	Slot* slot = &slots[index];
+	if (slot->used and not (slot->header == header and slot->counter == counter))
+	{
+		// all slots are in use: replace the packet in the home slot, which
+		// keeps the probe sequences of all other packets intact
+		slot = &slots[home];
+		slot->used = false;
+	}
+	if (not slot->used or slot->payload.getSize() != messageSize)
+	{
+		// first part of this message
+		slot->header = header;
+		slot->payload = modm::SmartPointer(messageSize);
+		slot->counter = counter;
+		slot->receivedFragments = 0;
+		slot->used = true;
+	}
+
+	// create a marker for the currently received fragment and
+	// test if the fragment was already received
+	const uint8_t currentFragment = (1 << fragmentIndex);
+	if (currentFragment & slot->receivedFragments)
+	{
+		// error: received fragment twice -> most likely a new message -> delete the old one
+		slot->receivedFragments = 0;
+	}
+	slot->receivedFragments |= currentFragment;
+
+	std::memcpy(slot->payload.getPointer() + offset, data + 2, length - 2);
+
+	// test if this was the last segment, otherwise we have to wait
+	// for more messages
+	if (slot->receivedFragments == (1 << numberOfFragments) - 1)
+	{
+		receivedMessages.push(Packet{slot->header, slot->payload});
+		releaseSlot(slot - slots);
+	}
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::CanConnectorBase::releaseSlot(uint8_t index)
+{
+	// Backward shift deletion: move following packets of the probe sequence
+	// into the gap, so that no packet is behind a free slot.
+	slots[index].payload = modm::SmartPointer();
+	slots[index].used = false;
+
+	uint8_t next = index;
+	while (true)
+	{
+		next = (next + 1) & (ReassemblySlots - 1);
+		Slot& slot = slots[next];
+		if (not slot.used) break;
+
+		// distance from the home slot to the current and the free slot
+		const uint8_t home = getHomeSlot(slot.header);
+		const uint8_t toNext = (next - home) & (ReassemblySlots - 1);
+		const uint8_t toFree = (index - home) & (ReassemblySlots - 1);
+		if (toFree < toNext)
+		{
+			slots[index] = slot;
+			slot.payload = modm::SmartPointer();
+			slot.used = false;
+			index = next;
+		}
+	}
+}
@@ -18,6 +18,8 @@
 #define	XPCC_CAN_CONNECTOR_HPP
 
 #include <modm/container/linked_list.hpp>
+#include <modm/container/pool_allocator.hpp>
+#include <modm/container/queue.hpp>
 #include "../backend_interface.hpp"
 
 // Filter
@@ -75,8 +77,57 @@ namespace xpcc
 		static uint8_t
 		getNumberOfFragments(uint8_t messageSize);
 
+	protected:
+		/// Number of fragmented packets that can be reassembled concurrently,
+		/// must be a power of two.
+		static constexpr uint8_t ReassemblySlots = 8;
+		/// Number of received packets buffered until they are dropped.
+		static constexpr uint8_t ReceiveQueueSize = 8;
+
+		struct Packet
+		{
+			Header header;
+			modm::SmartPointer payload;
+		};
+
+		/**
+		 * \brief	Validate a fragment and copy it in place into its packet
+		 *
+		 * Fragments are reassembled in a fixed-slot table, whose home slot
+		 * is given by source and packet identifier. Collisions are resolved
+		 * by linear probing, so that packets with the same header but a
+		 * different message counter can be reassembled concurrently.
+		 * Completed packets are appended to \c receivedMessages.
+		 *
+		 * \return	\c false if the fragment has an illegal format.
+		 */
+		bool
+		receiveFragment(const Header& header, const uint8_t *data, uint8_t length);
+
+	private:
+		struct Slot
+		{
+			Header header;
+			modm::SmartPointer payload;
+			uint8_t counter = 0;
+			uint8_t receivedFragments = 0;
+			bool used = false;
+		};
+
+		static uint8_t
+		getHomeSlot(const Header& header)
+		{
+			return uint8_t(header.source * 31 + header.packetIdentifier) & (ReassemblySlots - 1);
+		}
+
+		void
+		releaseSlot(uint8_t index);
+
 	protected:
 		static uint8_t messageCounter;
+
+		Slot slots[ReassemblySlots];
+		modm::BoundedQueue<Packet, ReceiveQueueSize> receivedMessages;
 	};
 
 	/**
@@ -164,6 +215,17 @@ namespace xpcc
 		sendMessage(const uint32_t & identifier,
 				const uint8_t *data, uint8_t size);
 
+		/**
+		 * \brief	Try to send the next fragment of a message via CAN Driver
+		 *
+		 * The fragment is assembled directly in the CAN message.
+		 *
+		 * \return	\b true if the fragment could be send, \b false otherwise
+		 */
+		bool
+		sendFragment(const uint32_t & identifier,
+				const modm::SmartPointer& payload, uint8_t fragmentIndex);
+
 		void
 		sendWaitingMessages();
 
@@ -199,42 +261,11 @@ namespace xpcc
 			operator = (const SendListItem& other);
 		};
 
-		class ReceiveListItem
-		{
-		public:
-			ReceiveListItem(uint8_t size, const Header& inHeader,
-					uint8_t messageCounter = 0) :
-				header(inHeader), payload(size),
-				receivedFragments(0),
-				counter(messageCounter)
-			{
-			}
-
-			ReceiveListItem(const ReceiveListItem& other) :
-				header(other.header), payload(other.payload),
-				receivedFragments(other.receivedFragments),
-				counter(other.counter)
-			{
-			}
-
-			Header header;
-			modm::SmartPointer payload;
-
-			uint8_t receivedFragments;
-			const uint8_t counter;
-
-		private:
-			ReceiveListItem&
-			operator = (const ReceiveListItem& other);
-		};
-
-		typedef modm::LinkedList< SendListItem > SendList;
-		typedef modm::LinkedList< ReceiveListItem > ReceiveList;
+		// Nodes of the pending messages are allocated from a static pool
+		typedef modm::LinkedList< SendListItem, modm::PoolAllocator< SendListItem, 8 > > SendList;
 
 	protected:
 		SendList sendList;
-		ReceiveList pendingMessages;
-		ReceiveList receivedMessages;
 
 		Driver *canDriver;
 	};
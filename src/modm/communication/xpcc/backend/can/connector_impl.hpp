@@ -17,7 +17,8 @@
 	#error	"Don't include this file directly, use 'can_connector.hpp' instead!"
 #endif
 
-#include <modm/math/utils/bit_operation.hpp>
+#include <algorithm>
+#include <cstring>
 #include <modm/architecture/interface/can_message.hpp>
 
 // ----------------------------------------------------------------------------
@@ -37,21 +38,21 @@ template<typename Driver>
 bool
 xpcc::CanConnector<Driver>::isPacketAvailable() const
 {
-	return !this->receivedMessages.isEmpty();
+	return this->receivedMessages.isNotEmpty();
 }
 
 template<typename Driver>
 const xpcc::Header&
 xpcc::CanConnector<Driver>::getPacketHeader() const
 {
-	return this->receivedMessages.getFront().header;
+	return this->receivedMessages.get().header;
 }
 
 template<typename Driver>
 const modm::SmartPointer
 xpcc::CanConnector<Driver>::getPacketPayload() const
 {
-	return this->receivedMessages.getFront().payload;
+	return this->receivedMessages.get().payload;
 }
 
 // ----------------------------------------------------------------------------
@@ -82,7 +83,9 @@ template<typename Driver>
 void
 xpcc::CanConnector<Driver>::dropPacket()
 {
-	this->receivedMessages.removeFront();
+	// release the payload now, the queue only overwrites it later
+	this->receivedMessages.get().payload = modm::SmartPointer();
+	this->receivedMessages.pop();
 }
 
 // ----------------------------------------------------------------------------
@@ -90,7 +93,9 @@ template<typename Driver>
 void
 xpcc::CanConnector<Driver>::update()
 {
-	while (this->canDriver->isMessageAvailable()) {
+	// keep messages in the driver if the received packets are not dropped
+	while (this->receivedMessages.isNotFull() and
+			this->canDriver->isMessageAvailable()) {
 		this->retrieveMessage();
 	}
 	this->sendWaitingMessages();
@@ -113,6 +118,24 @@ xpcc::CanConnector<Driver>::sendMessage(const uint32_t & identifier,
 	return this->canDriver->sendMessage(message);
 }
 
+template<typename Driver>
+bool
+xpcc::CanConnector<Driver>::sendFragment(const uint32_t & identifier,
+		const modm::SmartPointer& payload, uint8_t fragmentIndex)
+{
+	const uint8_t messageSize = payload.getSize();
+	const uint8_t offset = fragmentIndex * 6;
+	// all fragments but the last one carry six bytes of payload
+	const uint8_t fragmentSize = std::min<uint8_t>(messageSize - offset, 6);
+
+	modm::can::Message message(identifier, fragmentSize + 2);
+	message.data[0] = fragmentIndex | (this->messageCounter & 0xf0);
+	message.data[1] = messageSize; 	// size of the complete message
+	std::memcpy(message.data + 2, payload.getPointer() + offset, fragmentSize);
+
+	return this->canDriver->sendMessage(message);
+}
+
 template<typename Driver>
 void
 xpcc::CanConnector<Driver>::sendWaitingMessages()
@@ -135,28 +158,10 @@ xpcc::CanConnector<Driver>::sendWaitingMessages()
 	if (messageSize > 8)
 	{
 		// fragmented message
-		uint8_t data[8];
-
-		data[0] = message.fragmentIndex | (this->messageCounter & 0xf0);
-		data[1] = messageSize; 	// size of the complete message
-
-		bool sendFinished = true;
-		uint8_t offset = message.fragmentIndex * 6;
-		uint8_t fragmentSize = messageSize - offset;
-		if (fragmentSize > 6)
-		{
-			fragmentSize = 6;
-			sendFinished = false;
-		}
-		// otherwise fragmentSize is smaller or equal to six, so the last
-		// fragment is about to be sent.
-
-		memcpy(data + 2, message.payload.getPointer() + offset, fragmentSize);
-
-		if (sendMessage(message.identifier, data, fragmentSize + 2))
+		if (sendFragment(message.identifier, message.payload, message.fragmentIndex))
 		{
 			message.fragmentIndex++;
-			if (sendFinished)
+			if (message.fragmentIndex * 6 >= messageSize)
 			{
 				// message was the last fragment
 				// => remove it from the list
@@ -187,91 +192,12 @@ xpcc::CanConnector<Driver>::retrieveMessage()
 
 		if (!isFragment)
 		{
-			this->receivedMessages.append(ReceiveListItem(message.length, header));
-			std::memcpy(this->receivedMessages.getBack().payload.getPointer(),
-					message.data,
-					message.length);
+			Packet packet{header, modm::SmartPointer(message.length)};
+			std::memcpy(packet.payload.getPointer(), message.data, message.length);
+			this->receivedMessages.push(packet);
 		}
-		else
-		{
-			// find existing container otherwise create a new one
-			const uint8_t fragmentIndex = message.data[0] & 0x0f;
-			const uint8_t counter = message.data[0] & 0xf0;
-			const uint8_t messageSize = message.data[1];
-
-			// calculate the number of messages need to send messageSize-bytes
-			uint8_t numberOfFragments = this->getNumberOfFragments(messageSize);
-
-			if (message.length < 3 || messageSize > 48 ||
-					fragmentIndex >= numberOfFragments)
-			{
-				// illegal format:
-				//   fragmented messages need to have at least 3 byte payload,
-				// 	 the maximum size is 48 Bytes and the fragment number
-				//	 should not be higher than the number of fragments.
-				return false;
-			}
-
-			// check the length of the fragment (all fragments except the
-			// last one need to have a payload-length of 6 bytes + 2 byte
-			// fragment information)
-			uint8_t offset = fragmentIndex * 6;
-			if (fragmentIndex + 1 == numberOfFragments)
-			{
-				// this one is the last fragment
-				if (messageSize - offset != message.length - 2)
-				{
-					// illegal format
-					return false;
-				}
-			}
-			else if (message.length != 8)
-			{
-				// illegal format
-				return false;
-			}
-
-			// Check if other parts of this message are already in the
-			// list of receiving messages.
-			typename ReceiveList::iterator packet = this->pendingMessages.begin();
-			for ( ; packet != this->pendingMessages.end(); ++packet)
-			{
-				if (packet->header == header &&
-					packet->counter == counter)
-				{
-					break;
-				}
-			}
-
-			if (packet == this->pendingMessages.end()) {
-				// message not found => first part of this message,
-				// prepend it to the list
-				this->pendingMessages.prepend(ReceiveListItem(messageSize, header, counter));
-				packet = this->pendingMessages.begin();
-			}
-
-			// create a marker for the currently received fragment and
-			// test if the fragment was already received
-			const uint8_t currentFragment = (1 << fragmentIndex);
-			if (currentFragment & packet->receivedFragments)
-			{
-				// error: received fragment twice -> most likely a new message -> delete the old one
-				//MODM_LOG_WARNING << "lost fragment" << modm::flush;
-				packet->receivedFragments = 0;
-			}
-			packet->receivedFragments |= currentFragment;
-
-			std::memcpy(packet->payload.getPointer() + offset,
-					message.data + 2,
-					message.length - 2);
-
-			// test if this was the last segment, otherwise we have to wait
-			// for more messages
-			if (modm::bitCount(packet->receivedFragments) == numberOfFragments)
-			{
-				this->receivedMessages.append(*packet);
-				this->pendingMessages.remove(packet);
-			}
+		else {
+			return this->receiveFragment(header, message.data, message.length);
 		}
 
 		return true;
@@ -26,6 +26,19 @@ xpcc::Dispatcher::Dispatcher(BackendInterface *backend_, Postman* postman_) :
 {
 }
 
+xpcc::Dispatcher::~Dispatcher()
+{
+	for (Entry *entry : buckets)
+	{
+		while (entry)
+		{
+			Entry *next = entry->bucketNext;
+			delete entry;
+			entry = next;
+		}
+	}
+}
+
 // ----------------------------------------------------------------------------
 void
 xpcc::Dispatcher::update()
@@ -110,56 +123,53 @@ xpcc::Dispatcher::handlePacket(const Header& header,
 		const modm::SmartPointer& payload)
 {
 	bool ack = false;
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	for (Entry *entry = findBucket(header); entry; entry = entry->bucketNext)
 	{
+		if (not entry->headerFits(header)) continue;
+
 		if (entry->type == Entry::Type::Default)
 		{
 			// waiting for ack, no response can be handled
-			if (entry->headerFits(header))
-			{
-				entry = this->entries.remove(entry);
-				return ack;
-			}
+			remove(entry);
 		}
 		else if (entry->type == Entry::Type::Callback)
 		{
-			if (entry->headerFits(header))
+			// entry actual has to be marked acknowledged if acknowleded
+			// request
+			if (header.type == Header::Type::REQUEST)
 			{
-				// entry actual has to be marked acknowledged if acknowleded
-				// request
-				if (header.type == Header::Type::REQUEST)
+				// Must be an acknowledge otherwise there is an error in
+				// communication, cause no requests can be handled here
+				if (header.isAcknowledge)
 				{
-					// Must be an acknowledge otherwise there is an error in
-					// communication, cause no requests can be handled here
-					if (header.isAcknowledge)
-					{
-						// make sure no requests passed here
-						entry->state = Entry::State::WaitForResponse;
-					}
+					// make sure no requests passed here
+					if (entry->state == Entry::State::TransmissionPending)
+						transmissionQueue.remove(entry);
+					else if (entry->state == Entry::State::WaitForACK)
+						acknowledgeQueue.remove(entry);
+					entry->state = Entry::State::WaitForResponse;
 				}
-				else
-				{
-					// response or negative response
-					if (!header.isAcknowledge) {
-						entry->callbackResponse(header, payload);
-						ack = true;
-					} else {
-						// cannot happen, since responses with callbacks are
-						// not possible
-					}
-					entry = this->entries.remove(entry);
+			}
+			else
+			{
+				// response or negative response
+				if (!header.isAcknowledge) {
+					entry->callbackResponse(header, payload);
+					ack = true;
+				} else {
+					// cannot happen, since responses with callbacks are
+					// not possible
 				}
-				return ack;
+				remove(entry);
 			}
 		}
-		++entry;
+		return ack;
 	}
 	return ack;
 }
 
-xpcc::Dispatcher::EntryIterator
-xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
+xpcc::Dispatcher::Entry *
+xpcc::Dispatcher::sendMessageToInnerComponent(Entry *entry)
 {
 	// to one component on board inner component
 	// send message also out, so it is possible to log
@@ -171,16 +181,18 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 		postman->deliverPacket(entry->header, entry->payload);
 		// TODO handle postman errors?
 
+		Entry *next = entry->next;
 		if (entry->type == Entry::Type::Callback)
 		{
 			// TODO timer for RESPONSES not handeled yet
+			transmissionQueue.remove(entry);
 			entry->state = Entry::State::WaitForResponse;
 			entry->time.restart(responseTimeout);
-			return entry;
 		}
 		else {
-			return this->entries.remove(entry);
+			remove(entry);
 		}
+		return next;
 	}
 	else
 	{
@@ -188,12 +200,7 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 		//
 		// we need to find the coresponding REQUEST and delete it as well
 		// as the RESPONSE
-		//
-		// responses are inserted at front, requests at end,
-		// thus we only need to search after the RESPONSE
-
-		auto req = entry;
-		for (++req; req != this->entries.end(); ++req)
+		for (Entry *req = findBucket(entry->header); req; req = req->bucketNext)
 		{
 			if (req->header.type == Header::Type::REQUEST and
 			    // must be State::WaitForResponse
@@ -204,86 +211,82 @@ xpcc::Dispatcher::sendMessageToInnerComponent(EntryIterator entry)
 				{
 					req->callbackResponse(entry->header, entry->payload);
 				}
-				this->entries.remove(req);
+				remove(req);
 				break;
 			}
 		}
 
-		return this->entries.remove(entry);
+		Entry *next = entry->next;
+		remove(entry);
+		return next;
 	}
-
-	return entry;
 }
 
 void
 xpcc::Dispatcher::handleWaitingMessages()
 {
-	auto entry = this->entries.begin();
-	while(entry != this->entries.end())
+	// acknowledge timeouts expire in the order of the queue
+	Entry *entry;
+	while ((entry = acknowledgeQueue.head) and entry->time.isExpired())
 	{
-		if (entry->state == Entry::State::TransmissionPending)
+		if (entry->tries >= 2)
 		{
-			if (entry->header.destination == 0)
-			{
-				// event
-				postman->deliverPacket(entry->header, entry->payload);
-				backend->sendPacket(entry->header, entry->payload);
+			Header header = entry->header;
+			header.type = Header::Type::TIMEOUT;
+			entry->callbackResponse(header, entry->payload);
+			remove(entry);
+		}
+		else
+		{
+			backend->sendPacket(entry->header, entry->payload);
 
-				entry = this->entries.remove(entry);
-				continue;
-			}
-			else
-			{
-				// action or response
-				if (postman->isComponentAvailable(entry->header.destination))
-				{
-					entry = sendMessageToInnerComponent(entry);
-					continue;
-				}
-				else
-				{
-					// destination not on board, message has to be sent
-					// out to the backend
-					backend->sendPacket(entry->header, entry->payload);
+			entry->tries++;
+			entry->time.restart(acknowledgeTimeout);
+			acknowledgeQueue.remove(entry);
+			acknowledgeQueue.append(entry);
+		}
+	}
 
-					entry->state = Entry::State::WaitForACK;
-					entry->time.restart(acknowledgeTimeout);
+	// Entries appended while handling are sent in the same pass,
+	// while prepended responses are sent in the next pass.
+	entry = transmissionQueue.head;
+	while (entry)
+	{
+		if (entry->header.destination == 0)
+		{
+			// event
+			postman->deliverPacket(entry->header, entry->payload);
+			backend->sendPacket(entry->header, entry->payload);
 
-					++entry;
-				}
-			}
+			Entry *next = entry->next;
+			remove(entry);
+			entry = next;
 		}
-		else if (entry->state == Entry::State::WaitForACK)
+		else
 		{
-			if (entry->time.isExpired())
+			// action or response
+			if (postman->isComponentAvailable(entry->header.destination))
 			{
-				if (entry->tries >= 2)
-				{
-                    Header header = entry->header;
-                    header.type = Header::Type::TIMEOUT;
-                    entry->callbackResponse(header, entry->payload);
-					entry = this->entries.remove(entry);
-					continue;
-				}
-				else
-				{
-					backend->sendPacket(entry->header, entry->payload);
-
-					entry->tries++;
-					entry->time.restart(acknowledgeTimeout);
-				}
+				entry = sendMessageToInnerComponent(entry);
 			}
+			else
+			{
+				// destination not on board, message has to be sent
+				// out to the backend
+				backend->sendPacket(entry->header, entry->payload);
 
-			++entry;
-		}
-		else
-		{
-			// WAIT_FOR_RESPONSE
-			// Responses stay in the queue for ever if no response ever
-			// comes. This may have to be changed.
-			++entry;
+				Entry *next = entry->next;
+				transmissionQueue.remove(entry);
+				entry->state = Entry::State::WaitForACK;
+				entry->time.restart(acknowledgeTimeout);
+				acknowledgeQueue.append(entry);
+				entry = next;
+			}
 		}
 	}
+	// WAIT_FOR_RESPONSE
+	// Responses stay in the index for ever if no response ever
+	// comes. This may have to be changed.
 }
 
 // ----------------------------------------------------------------------------
@@ -291,14 +294,14 @@ void
 xpcc::Dispatcher::addMessage(const Header& header,
 		modm::SmartPointer& smartPayload)
 {
-	this->entries.append(Entry(header, smartPayload));
+	insert(new Entry(header, smartPayload), false);
 }
 
 void
 xpcc::Dispatcher::addMessage(const Header& header,
 		modm::SmartPointer& smartPayload, ResponseCallback& responseCallback)
 {
-	this->entries.append(Entry(header, smartPayload, responseCallback));
+	insert(new Entry(header, smartPayload, responseCallback), false);
 }
 
 void
@@ -314,5 +317,108 @@ xpcc::Dispatcher::addResponse(const Header& header,
 	// but now responses are handled in reverse order that's not good
 	// what to do? a separator between responses and requests possible?
 
-	this->entries.prepend(Entry(header, smartPayload));
+	insert(new Entry(header, smartPayload), true);
+}
+
+// ----------------------------------------------------------------------------
+void
+xpcc::Dispatcher::EntryQueue::append(Entry *entry)
+{
+	entry->prev = tail;
+	entry->next = nullptr;
+	if (tail) tail->next = entry;
+	else head = entry;
+	tail = entry;
+}
+
+void
+xpcc::Dispatcher::EntryQueue::prepend(Entry *entry)
+{
+	entry->prev = nullptr;
+	entry->next = head;
+	if (head) head->prev = entry;
+	else tail = entry;
+	head = entry;
+}
+
+void
+xpcc::Dispatcher::EntryQueue::remove(Entry *entry)
+{
+	if (entry->prev) entry->prev->next = entry->next;
+	else head = entry->next;
+	if (entry->next) entry->next->prev = entry->prev;
+	else tail = entry->prev;
+	entry->prev = entry->next = nullptr;
+}
+
+// ----------------------------------------------------------------------------
+static inline std::size_t
+hashHeader(uint8_t destination, uint8_t source, uint8_t identifier)
+{
+	return ((destination * 31u + source) * 31u + identifier) &
+			(xpcc::Dispatcher::IndexBuckets - 1);
+}
+
+xpcc::Dispatcher::Entry *
+xpcc::Dispatcher::findBucket(const Header& header) const
+{
+	// An entry fits a header with swapped source and destination
+	return buckets[hashHeader(header.source, header.destination, header.packetIdentifier)];
+}
+
+void
+xpcc::Dispatcher::insert(Entry *entry, bool front)
+{
+	if (front) transmissionQueue.prepend(entry);
+	else transmissionQueue.append(entry);
+
+	// Keep each bucket in the same order as the entries were added, so that
+	// packets are matched to the same entry as by a linear search
+	Entry *&bucket = buckets[hashHeader(entry->header.destination,
+			entry->header.source, entry->header.packetIdentifier)];
+	if (bucket == nullptr)
+	{
+		entry->bucketPrev = entry;
+		entry->bucketNext = nullptr;
+		bucket = entry;
+	}
+	else if (front)
+	{
+		entry->bucketPrev = bucket->bucketPrev;
+		entry->bucketNext = bucket;
+		bucket->bucketPrev = entry;
+		bucket = entry;
+	}
+	else
+	{
+		Entry *last = bucket->bucketPrev;
+		last->bucketNext = entry;
+		entry->bucketPrev = last;
+		entry->bucketNext = nullptr;
+		bucket->bucketPrev = entry;
+	}
+}
+
+void
+xpcc::Dispatcher::remove(Entry *entry)
+{
+	if (entry->state == Entry::State::TransmissionPending)
+		transmissionQueue.remove(entry);
+	else if (entry->state == Entry::State::WaitForACK)
+		acknowledgeQueue.remove(entry);
+
+	Entry *&bucket = buckets[hashHeader(entry->header.destination,
+			entry->header.source, entry->header.packetIdentifier)];
+	if (entry == bucket)
+	{
+		bucket = entry->bucketNext;
+		if (bucket) bucket->bucketPrev = entry->bucketPrev;
+	}
+	else
+	{
+		entry->bucketPrev->bucketNext = entry->bucketNext;
+		if (entry->bucketNext) entry->bucketNext->bucketPrev = entry->bucketPrev;
+		else bucket->bucketPrev = entry->bucketPrev;
+	}
+	delete entry;
 }
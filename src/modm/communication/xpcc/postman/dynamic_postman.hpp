@@ -22,6 +22,7 @@
 #include "../backend/header.hpp"
 #include "../response_handle.hpp"
 
+#include <bitset>
 #include <map>
 #include <functional>
 
@@ -117,6 +118,8 @@ private:
 private:
 	EventMap eventMap;
 	ActionMap actionMap;
+	/// Components with at least one action handler
+	std::bitset<256> components;
 };
 
 }	// namespace xpcc
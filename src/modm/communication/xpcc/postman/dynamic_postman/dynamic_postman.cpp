@@ -67,7 +67,7 @@ xpcc::DynamicPostman::deliverPacket(const Header &header, const modm::SmartPoint
 bool
 xpcc::DynamicPostman::isComponentAvailable(uint8_t component) const
 {
-	return (this->actionMap.find(component) != this->actionMap.end());
+	return components.test(component);
 }
 
 // ----------------------------------------------------------------------------
@@ -71,6 +71,7 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 {
 	using namespace std::placeholders;
 
+	components.set(componentId);
 	actionMap[componentId][actionId] = ActionHandler(static_cast<ActionCallbackSimple>(
 			std::bind(
 					memberFunction,
@@ -91,6 +92,7 @@ xpcc::DynamicPostman::registerActionHandler(const uint8_t componentId,
 	using namespace std::placeholders;
 	typedef void (C::*Function)(const ResponseHandle&, const uint8_t&);
 
+	components.set(componentId);
 	actionMap[componentId][actionId] = ActionHandler(
 			std::bind(
 					reinterpret_cast<Function>(memberFunction),
@@ -0,0 +1,148 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <stdint.h>
+#include <cstddef>
+#include <atomic>
+
+namespace modm
+{
+
+/// Usage statistics of a `modm::BlockPool`.
+/// @ingroup modm_container
+struct BlockPoolStatistics
+{
+	uint16_t size;		///< Bytes per block
+	uint16_t capacity;	///< Number of blocks
+	uint16_t used;		///< Number of currently allocated blocks
+	uint16_t highWater;	///< Maximum number of allocated blocks
+	uint32_t exhausted;	///< Number of failed allocations
+};
+
+/**
+ * Fixed-capacity pool of equally sized memory blocks.
+ *
+ * The pool is statically allocated and requires no initialization, so it can
+ * be used during static construction. Free blocks are kept in a lock-free
+ * stack, whose head is tagged with a counter to prevent the ABA problem.
+ * Blocks that have never been allocated are handed out from the end of the
+ * pool instead, so that the free list does not need to be initialized.
+ *
+ * @tparam	BlockSize	Size of each block in bytes, must be in [1, 65535].
+ * @tparam	Capacity	Number of blocks, must be less than 65535.
+ * @tparam	Alignment	Alignment of each block in bytes.
+ *
+ * @ingroup modm_container
+ */
+template< std::size_t BlockSize, std::size_t Capacity, std::size_t Alignment = 4 >
+class BlockPool
+{
+	static_assert(BlockSize > 0 and BlockSize <= 0xFFFF, "BlockSize must be in [1, 65535]!");
+	static_assert(Capacity > 0 and Capacity < 0xFFFF, "Capacity must be in [1, 65535)!");
+
+	static constexpr uint16_t Empty{0xFFFF};
+	static constexpr uint32_t Tag{0x10000};
+
+public:
+	constexpr BlockPool() = default;
+
+	BlockPool(const BlockPool&) = delete;
+	BlockPool& operator=(const BlockPool&) = delete;
+
+	/// @returns an aligned block or nullptr if the pool is exhausted.
+	/// @note This function can be called from an interrupt.
+	void*
+	allocate()
+	{
+		uint32_t head = free.load(std::memory_order_acquire);
+		while (uint16_t(head) != Empty)
+		{
+			const uint16_t index = head;
+			const uint32_t next = ((head & ~(Tag - 1)) + Tag) | links[index].load(std::memory_order_relaxed);
+			if (free.compare_exchange_weak(head, next, std::memory_order_acquire,
+										   std::memory_order_acquire))
+			{
+				return acquire(index);
+			}
+		}
+		uint16_t index = fresh.load(std::memory_order_relaxed);
+		while (index < Capacity)
+		{
+			if (fresh.compare_exchange_weak(index, index + 1, std::memory_order_relaxed))
+				return acquire(index);
+		}
+		exhausted.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	/// Returns a block previously allocated from this pool.
+	/// @note This function can be called from an interrupt.
+	void
+	deallocate(void *ptr)
+	{
+		const uint16_t index = static_cast<Block*>(ptr) - blocks;
+		uint32_t head = free.load(std::memory_order_relaxed);
+		uint32_t next;
+		do
+		{
+			links[index].store(uint16_t(head), std::memory_order_relaxed);
+			next = ((head & ~(Tag - 1)) + Tag) | index;
+		}
+		while (not free.compare_exchange_weak(head, next, std::memory_order_release,
+											  std::memory_order_relaxed));
+		used.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	/// @returns if the pointer belongs to a block of this pool.
+	bool
+	contains(const void *ptr) const
+	{
+		return (ptr >= static_cast<const void*>(blocks) and
+				ptr < static_cast<const void*>(blocks + Capacity));
+	}
+
+	BlockPoolStatistics
+	getStatistics() const
+	{
+		return {BlockSize, Capacity,
+				used.load(std::memory_order_relaxed),
+				highWater.load(std::memory_order_relaxed),
+				exhausted.load(std::memory_order_relaxed)};
+	}
+
+private:
+	void*
+	acquire(uint16_t index)
+	{
+		const uint16_t count = used.fetch_add(1, std::memory_order_relaxed) + 1;
+		uint16_t high = highWater.load(std::memory_order_relaxed);
+		while (count > high and not highWater.compare_exchange_weak(
+				high, count, std::memory_order_relaxed)) ;
+		return blocks + index;
+	}
+
+	struct alignas(Alignment) Block
+	{
+		uint8_t data[BlockSize];
+	};
+
+	Block blocks[Capacity]{};
+	std::atomic<uint16_t> links[Capacity]{};
+	// Tagged index of the first free block
+	std::atomic<uint32_t> free{Empty};
+	// Index of the first never allocated block
+	std::atomic<uint16_t> fresh{0};
+	std::atomic<uint16_t> used{0};
+	std::atomic<uint16_t> highWater{0};
+	std::atomic<uint32_t> exhausted{0};
+};
+
+}	// namespace modm
@@ -18,6 +18,8 @@
 #include "container/doubly_linked_list.hpp"
 
 #include "container/dynamic_array.hpp"
+#include "container/small_dynamic_array.hpp"
+#include "container/pool_allocator.hpp"
 
 #include "container/pair.hpp"
 #include "container/smart_pointer.hpp"
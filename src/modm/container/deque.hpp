@@ -15,10 +15,13 @@
 #ifndef	MODM_DEQUE_HPP
 #define	MODM_DEQUE_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
 #include <iterator>
+#include <span>
 
 namespace modm
 {
@@ -184,6 +187,51 @@ namespace modm
 		void
 		removeFront();
 
+		/// Appends as many values as fit, trivially copyable values are
+		/// copied with memcpy.
+		/// \return number of values appended
+		Size
+		append(std::span<const T> values);
+
+		/// Removes the first n elements.
+		void
+		removeFront(Size n);
+
+		/// Removes the last n elements.
+		void
+		removeBack(Size n);
+
+		/**
+		 * Contiguous elements at the front.
+		 *
+		 * The span ends at the end of the internal buffer, so it may contain
+		 * less than `getSize()` elements. Read the elements in place, for
+		 * example with DMA, then remove them with `consume()`.
+		 */
+		std::span<T>
+		getContiguousFront();
+
+		std::span<const T>
+		getContiguousFront() const;
+
+		/// Removes n elements read from `getContiguousFront()`.
+		void
+		consume(Size n) { removeFront(n); }
+
+		/**
+		 * Contiguous free space behind the back.
+		 *
+		 * The span ends at the end of the internal buffer, so it may be
+		 * shorter than the free space. Write the elements in place, for
+		 * example with DMA, then append them with `commit()`.
+		 */
+		std::span<T>
+		getContiguousBack();
+
+		/// Appends n elements written into `getContiguousBack()`.
+		void
+		commit(Size n);
+
 	public:
 		#pragma GCC diagnostic push
 		#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
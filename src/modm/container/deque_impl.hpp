@@ -290,6 +290,76 @@ modm::BoundedDeque<T, N>::removeFront()
 
 // ----------------------------------------------------------------------------
 
+template<typename T, std::size_t N>
+typename modm::BoundedDeque<T, N>::Size
+modm::BoundedDeque<T, N>::append(std::span<const T> values)
+{
+	const Size count = std::min<std::size_t>(values.size(), N - this->size);
+	Size copied = 0;
+	while (copied < count)
+	{
+		const std::span<T> region = this->getContiguousBack();
+		const Size length = std::min<std::size_t>(region.size(), count - copied);
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			std::memcpy(region.data(), values.data() + copied, length * sizeof(T));
+		}
+		else {
+			std::copy_n(values.data() + copied, length, region.data());
+		}
+		this->commit(length);
+		copied += length;
+	}
+	return count;
+}
+
+template<typename T, std::size_t N>
+void
+modm::BoundedDeque<T, N>::removeFront(Size n)
+{
+	this->tail = (this->tail + n) % N;
+	this->size -= n;
+}
+
+template<typename T, std::size_t N>
+void
+modm::BoundedDeque<T, N>::removeBack(Size n)
+{
+	this->head = (this->head + N - n) % N;
+	this->size -= n;
+}
+
+template<typename T, std::size_t N>
+std::span<T>
+modm::BoundedDeque<T, N>::getContiguousFront()
+{
+	return {this->buffer + this->tail, std::min<std::size_t>(this->size, N - this->tail)};
+}
+
+template<typename T, std::size_t N>
+std::span<const T>
+modm::BoundedDeque<T, N>::getContiguousFront() const
+{
+	return {this->buffer + this->tail, std::min<std::size_t>(this->size, N - this->tail)};
+}
+
+template<typename T, std::size_t N>
+std::span<T>
+modm::BoundedDeque<T, N>::getContiguousBack()
+{
+	const Index start = (this->head + 1) % N;
+	return {this->buffer + start, std::min<std::size_t>(N - this->size, N - start)};
+}
+
+template<typename T, std::size_t N>
+void
+modm::BoundedDeque<T, N>::commit(Size n)
+{
+	this->head = (this->head + n) % N;
+	this->size += n;
+}
+
+// ----------------------------------------------------------------------------
+
 template<typename T, std::size_t N>
 modm::BoundedDeque<T, N>::const_iterator::const_iterator() :
 	index(0), parent(0), count(0)
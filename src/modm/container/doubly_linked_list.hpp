@@ -33,8 +33,8 @@ namespace modm
 	class DoublyLinkedList
 	{
 	public:
-		using const_iterator = std::list<T>::const_iterator;
-		using iterator = std::list<T>::iterator;
+		using const_iterator = std::list<T, Allocator>::const_iterator;
+		using iterator = std::list<T, Allocator>::iterator;
 		using Size = std::size_t;
 
 		DoublyLinkedList(const Allocator& allocator = Allocator())
@@ -75,25 +75,25 @@ namespace modm
 	public:
 		using std::pair<T1, T2>::pair;
 
-		FirstType&
+		constexpr FirstType&
 		getFirst()
 		{
 			return this->first;
 		}
 
-		const FirstType&
+		constexpr const FirstType&
 		getFirst() const
 		{
 			return this->first;
 		}
 
-		SecondType&
+		constexpr SecondType&
 		getSecond()
 		{
 			return this->second;
 		}
 
-		const SecondType&
+		constexpr const SecondType&
 		getSecond() const
 		{
 			return this->second;
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "block_pool.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace modm
+{
+
+/// @cond
+namespace detail
+{
+
+template< typename Tag, std::size_t Capacity >
+struct PoolAllocatorRegistry
+{
+	// Statistics of the pool of the node type, which is only known to the container
+	static inline BlockPoolStatistics (*statistics)() = nullptr;
+};
+
+}	// namespace detail
+/// @endcond
+
+/**
+ * Allocator for node-based containers backed by a static `modm::BlockPool`.
+ *
+ * Single objects are allocated from a pool of `Capacity` blocks, which is
+ * shared by all containers with the same node type and capacity. When the pool
+ * is exhausted or several objects are requested at once, the allocator falls
+ * back to the heap. The allocator is stateless, so containers can still be
+ * copied, moved and swapped freely.
+ *
+ * @code
+ * // Up to 16 nodes of all send lists are allocated without the heap
+ * modm::LinkedList<Item, modm::PoolAllocator<Item, 16>> sendList;
+ * @endcode
+ *
+ * @tparam	T			Type of the objects, rebound to the node type by the container.
+ * @tparam	Capacity	Number of objects in the pool.
+ * @tparam	Tag			Type identifying the pool for statistics, kept when rebinding.
+ *
+ * @ingroup	modm_container
+ */
+template< typename T, std::size_t Capacity, typename Tag = T >
+class PoolAllocator
+{
+	using Pool = BlockPool<sizeof(T), Capacity, alignof(T)>;
+	using Registry = detail::PoolAllocatorRegistry<Tag, Capacity>;
+
+public:
+	using value_type = T;
+
+	template< typename U >
+	struct rebind
+	{
+		using other = PoolAllocator<U, Capacity, Tag>;
+	};
+
+	constexpr PoolAllocator() = default;
+
+	template< typename U >
+	constexpr PoolAllocator(const PoolAllocator<U, Capacity, Tag>&) {}
+
+	/// @note This function can be called from an interrupt, as long as the
+	///       pool is not exhausted.
+	T*
+	allocate(std::size_t n)
+	{
+		if (n == 1)
+		{
+			Registry::statistics = &getPoolStatistics;
+			if (void* block = pool.allocate(); block)
+				return static_cast<T*>(block);
+		}
+		return std::allocator<T>{}.allocate(n);
+	}
+
+	void
+	deallocate(T* ptr, std::size_t n)
+	{
+		if (pool.contains(ptr))
+			pool.deallocate(ptr);
+		else
+			std::allocator<T>{}.deallocate(ptr, n);
+	}
+
+	/// Usage statistics of the pool of the node type the container allocates.
+	static BlockPoolStatistics
+	getStatistics()
+	{ return Registry::statistics ? Registry::statistics() : BlockPoolStatistics{}; }
+
+	template< typename U >
+	constexpr bool
+	operator==(const PoolAllocator<U, Capacity, Tag>&) const
+	{ return true; }
+
+private:
+	static BlockPoolStatistics
+	getPoolStatistics()
+	{ return pool.getStatistics(); }
+
+	static inline Pool pool;
+};
+
+}	// namespace modm
@@ -16,6 +16,7 @@
 #define	MODM_QUEUE_HPP
 
 #include <cstddef>
+#include <span>
 
 #include "deque.hpp"
 
@@ -101,6 +102,49 @@ namespace modm
 			c.removeFront();
 		}
 
+		/// Pushes as many values as fit.
+		/// \return number of values pushed
+		inline Size
+		push(std::span<const T> values)
+		{
+			return c.append(values);
+		}
+
+		/// Pops the first n elements.
+		inline void
+		pop(Size n)
+		{
+			c.removeFront(n);
+		}
+
+		/// Contiguous elements at the front, see `BoundedDeque::getContiguousFront()`.
+		inline std::span<T>
+		getContiguousFront()
+		{
+			return c.getContiguousFront();
+		}
+
+		/// Pops n elements read from `getContiguousFront()`.
+		inline void
+		consume(Size n)
+		{
+			c.consume(n);
+		}
+
+		/// Contiguous free space, see `BoundedDeque::getContiguousBack()`.
+		inline std::span<T>
+		getContiguousBack()
+		{
+			return c.getContiguousBack();
+		}
+
+		/// Pushes n elements written into `getContiguousBack()`.
+		inline void
+		commit(Size n)
+		{
+			c.commit(n);
+		}
+
 	protected:
 		Container c;
 	};
@@ -0,0 +1,346 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+
+namespace modm
+{
+
+/**
+ * Dynamic array with inline storage for the first `N` elements.
+ *
+ * Behaves like `modm::DynamicArray`, however, up to `N` elements are stored
+ * inside the object itself, so that small arrays never touch the heap. Only
+ * when the array grows beyond that, the elements are moved into storage from
+ * the allocator. `clear()` returns to the inline storage.
+ *
+ * @tparam	T			Type of the elements
+ * @tparam	N			Number of elements stored inline
+ * @tparam	Allocator	Allocator used beyond `N` elements
+ *
+ * @ingroup	modm_container
+ */
+template< typename T, std::size_t N, typename Allocator = std::allocator<T> >
+class SmallDynamicArray
+{
+	static_assert(N > 0, "Use modm::DynamicArray without inline storage!");
+	using Traits = std::allocator_traits<Allocator>;
+
+public:
+	using SizeType = std::size_t;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+public:
+	SmallDynamicArray(const Allocator& allocator = Allocator()) :
+		allocator_(allocator)
+	{}
+
+	SmallDynamicArray(SizeType n, const T& value, const Allocator& allocator = Allocator()) :
+		allocator_(allocator)
+	{
+		reserve(n);
+		std::uninitialized_fill_n(data_, n, value);
+		size_ = n;
+	}
+
+	SmallDynamicArray(std::initializer_list<T> init, const Allocator& allocator = Allocator()) :
+		allocator_(allocator)
+	{
+		reserve(init.size());
+		std::uninitialized_copy(init.begin(), init.end(), data_);
+		size_ = init.size();
+	}
+
+	SmallDynamicArray(const SmallDynamicArray& other) :
+		allocator_(Traits::select_on_container_copy_construction(other.allocator_))
+	{
+		reserve(other.size_);
+		std::uninitialized_copy_n(other.data_, other.size_, data_);
+		size_ = other.size_;
+	}
+
+	SmallDynamicArray(SmallDynamicArray&& other) :
+		allocator_(std::move(other.allocator_))
+	{
+		if (other.isInline())
+		{
+			std::uninitialized_move_n(other.data_, other.size_, data_);
+			size_ = other.size_;
+			other.removeAll();
+		}
+		else
+		{
+			data_ = std::exchange(other.data_, other.inlineData());
+			size_ = std::exchange(other.size_, 0);
+			capacity_ = std::exchange(other.capacity_, N);
+		}
+	}
+
+	SmallDynamicArray&
+	operator = (const SmallDynamicArray& other)
+	{
+		if (this != &other)
+		{
+			removeAll();
+			reserve(other.size_);
+			std::uninitialized_copy_n(other.data_, other.size_, data_);
+			size_ = other.size_;
+		}
+		return *this;
+	}
+
+	SmallDynamicArray&
+	operator = (SmallDynamicArray&& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			if (other.isInline() or allocator_ != other.allocator_)
+			{
+				reserve(other.size_);
+				std::uninitialized_move_n(other.data_, other.size_, data_);
+				size_ = other.size_;
+				other.clear();
+			}
+			else
+			{
+				data_ = std::exchange(other.data_, other.inlineData());
+				size_ = std::exchange(other.size_, 0);
+				capacity_ = std::exchange(other.capacity_, N);
+			}
+		}
+		return *this;
+	}
+
+	~SmallDynamicArray()
+	{
+		clear();
+	}
+
+	bool
+	isEmpty() const
+	{
+		return size_ == 0;
+	}
+
+	SizeType
+	getSize() const
+	{
+		return size_;
+	}
+
+	SizeType
+	getCapacity() const
+	{
+		return capacity_;
+	}
+
+	/// @return `true` if the elements are stored inside the object.
+	bool
+	isInline() const
+	{
+		return data_ == inlineData();
+	}
+
+	void
+	reserve(SizeType n)
+	{
+		if (n > capacity_) {
+			relocate(n);
+		}
+	}
+
+	/// Removes all elements and releases the allocated storage.
+	void
+	clear()
+	{
+		removeAll();
+		if (not isInline())
+		{
+			Traits::deallocate(allocator_, data_, capacity_);
+			data_ = inlineData();
+			capacity_ = N;
+		}
+	}
+
+	/// Removes all elements, but keeps the storage.
+	void
+	removeAll()
+	{
+		std::destroy_n(data_, size_);
+		size_ = 0;
+	}
+
+	inline T&
+	operator [](SizeType index)
+	{
+		return data_[index];
+	}
+
+	inline const T&
+	operator [](SizeType index) const
+	{
+		return data_[index];
+	}
+
+	void
+	append(const T& value)
+	{
+		if (size_ == capacity_)
+		{
+			// The value may be an element of this array
+			T copy(value);
+			relocate(capacity_ * 2);
+			Traits::construct(allocator_, data_ + size_, std::move(copy));
+		}
+		else {
+			Traits::construct(allocator_, data_ + size_, value);
+		}
+		size_++;
+	}
+
+	void
+	removeBack()
+	{
+		std::destroy_at(data_ + --size_);
+	}
+
+	/// Inserts the value in front of the position.
+	/// @return iterator to the inserted element
+	iterator
+	insert(const_iterator position, const T& value)
+	{
+		const SizeType index = position - data_;
+		if (index == size_)
+		{
+			append(value);
+			return data_ + index;
+		}
+		T copy(value);
+		if (size_ == capacity_) {
+			relocate(capacity_ * 2);
+		}
+		Traits::construct(allocator_, data_ + size_, std::move(data_[size_ - 1]));
+		std::move_backward(data_ + index, data_ + size_ - 1, data_ + size_);
+		data_[index] = std::move(copy);
+		size_++;
+		return data_ + index;
+	}
+
+	/// @return iterator to the element following the erased one
+	iterator
+	erase(const_iterator position)
+	{
+		const SizeType index = position - data_;
+		std::move(data_ + index + 1, data_ + size_, data_ + index);
+		removeBack();
+		return data_ + index;
+	}
+
+	inline const T&
+	getFront() const
+	{
+		return data_[0];
+	}
+
+	inline T&
+	getFront()
+	{
+		return data_[0];
+	}
+
+	inline const T&
+	getBack() const
+	{
+		return data_[size_ - 1];
+	}
+
+	inline T&
+	getBack()
+	{
+		return data_[size_ - 1];
+	}
+
+	iterator
+	begin()
+	{
+		return data_;
+	}
+
+	const_iterator
+	begin() const
+	{
+		return data_;
+	}
+
+	iterator
+	end()
+	{
+		return data_ + size_;
+	}
+
+	const_iterator
+	end() const
+	{
+		return data_ + size_;
+	}
+
+	iterator
+	find(const T& value)
+	{
+		return std::find(begin(), end(), value);
+	}
+
+	const_iterator
+	find(const T& value) const
+	{
+		return std::find(begin(), end(), value);
+	}
+
+private:
+	T*
+	inlineData()
+	{
+		return reinterpret_cast<T*>(storage_);
+	}
+
+	const T*
+	inlineData() const
+	{
+		return reinterpret_cast<const T*>(storage_);
+	}
+
+	void
+	relocate(SizeType capacity)
+	{
+		T* data = Traits::allocate(allocator_, capacity);
+		std::uninitialized_move_n(data_, size_, data);
+		std::destroy_n(data_, size_);
+		if (not isInline()) {
+			Traits::deallocate(allocator_, data_, capacity_);
+		}
+		data_ = data;
+		capacity_ = capacity;
+	}
+
+	[[no_unique_address]] Allocator allocator_;
+	T* data_{inlineData()};
+	SizeType size_{0};
+	SizeType capacity_{N};
+	alignas(T) std::byte storage_[N * sizeof(T)];
+};
+
+}	// namespace modm
@@ -19,6 +19,7 @@
 #include <cstring>		// for std::memcpy
 #include <stdint.h>
 #include <modm/architecture/utils.hpp>
+#include "block_pool.hpp"
 
 #include <modm/io/iostream.hpp>
 
@@ -35,6 +36,11 @@ namespace modm
 	 * records when it is copied - when the last copy is destroyed the
 	 * memory is released.
 	 *
+	 * The memory is taken from the size-classed pools configured by the
+	 * `modm:container:smart_pointer.pool` option, and only falls back to the
+	 * heap if no pool is large enough or all suitable pools are exhausted.
+	 * Empty payloads do not allocate at all.
+	 *
 	 * \ingroup modm_container
 	 */
 	class SmartPointer
@@ -55,7 +61,7 @@ namespace modm
 		// between constructor and copy constructor!
 		template<typename T>
 		explicit SmartPointer(const T *data)
-		: ptr(new uint8_t[sizeof(T) + 4])
+		: ptr(allocate(sizeof(T)))
 		{
 			ptr[0] = 1;
 			*reinterpret_cast<uint16_t*>(ptr + 2) = sizeof(T);
@@ -124,7 +130,23 @@ namespace modm
 		SmartPointer&
 		operator = (const SmartPointer& other);
 
+	public:
+		/// @returns the number of configured pools.
+		static std::size_t
+		getPoolCount();
+
+		/// @returns usage statistics of the pool with the given index.
+		/// The size includes four bytes of header per payload.
+		static BlockPoolStatistics
+		getPoolStatistics(std::size_t index);
+
 	protected:
+		static uint8_t *
+		allocate(uint16_t size);
+
+		static void
+		release(uint8_t *ptr);
+
 		uint8_t * ptr;
 
 	protected:
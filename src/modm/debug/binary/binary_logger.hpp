@@ -0,0 +1,243 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/architecture/utils.hpp>
+#include <modm/io/iodevice.hpp>
+#include "logger/level.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace modm::log
+{
+
+/// @cond
+namespace detail
+{
+
+/// String arguments are truncated to this length
+static constexpr std::size_t BinaryStringLength{63};
+
+template< typename T >
+constexpr bool is_binary_string = std::is_convertible_v<const T&, const char*>;
+
+/// Type codes of the arguments as used by Python's struct module,
+/// plus 's' for length-prefixed strings and 'P' for pointers.
+template< typename T >
+consteval char
+binaryTypeCode()
+{
+	if constexpr (is_binary_string<T>) return 's';
+	else if constexpr (std::is_same_v<T, bool>) return '?';
+	else if constexpr (std::is_same_v<T, char>) return 'c';
+	else if constexpr (std::is_same_v<T, float>) return 'f';
+	else if constexpr (std::is_same_v<T, double>) return 'd';
+	else if constexpr (std::is_pointer_v<T>) return 'P';
+	else if constexpr (std::is_enum_v<T>) return binaryTypeCode<std::underlying_type_t<T>>();
+	else if constexpr (std::is_integral_v<T>)
+	{
+		constexpr char codes[] = "bBhHiIqQ";
+		const std::size_t index = (sizeof(T) == 1) ? 0 : (sizeof(T) == 2) ? 2 : (sizeof(T) == 4) ? 4 : 6;
+		return codes[index + std::is_unsigned_v<T>];
+	}
+	else static_assert(std::is_void_v<T>, "Type cannot be logged in binary!");
+}
+
+template< typename... Args >
+struct BinaryTypes {};
+
+// Only used to deduce the argument types in an unevaluated context
+template< typename... Args >
+BinaryTypes<std::remove_cvref_t<Args>...>
+binaryTypes(const Args&...);
+
+/// Format string entry, which is only read by the decoder on the host.
+/// The entries may be padded with zeros, so the level has its MSB set to
+/// mark the start of an entry.
+template< std::size_t Types, std::size_t Format >
+struct BinaryEntry
+{
+	uint8_t level;
+	char types[Types + 1];
+	char format[Format];
+};
+
+template< std::size_t N, typename... Args >
+consteval auto
+makeBinaryEntry(Level level, const char (&format)[N], BinaryTypes<Args...>)
+{
+	BinaryEntry<sizeof...(Args), N> entry{uint8_t(0x80 | level), {binaryTypeCode<Args>()..., '\0'}, {}};
+	for (std::size_t ii = 0; ii < N; ii++) entry.format[ii] = format[ii];
+	return entry;
+}
+
+/// FNV-1a hash over all bytes of the entry
+template< std::size_t Types, std::size_t Format >
+consteval uint32_t
+binaryId(const BinaryEntry<Types, Format>& entry)
+{
+	uint32_t hash{0x811c9dc5};
+	const auto fn_hash = [&hash](uint8_t byte) { hash = (hash ^ byte) * 0x01000193; };
+	fn_hash(entry.level);
+	for (const char c : entry.types) fn_hash(c);
+	for (const char c : entry.format) fn_hash(c);
+	return hash;
+}
+
+template< typename T >
+constexpr std::size_t
+binaryMaxSize()
+{
+	if constexpr (is_binary_string<T>) return 1 + BinaryStringLength;
+	else return sizeof(T);
+}
+
+template< typename T >
+inline uint8_t*
+serializeBinary(uint8_t* ptr, const T& value)
+{
+	if constexpr (is_binary_string<T>)
+	{
+		const char* str = value;
+		const uint8_t length = strnlen(str, BinaryStringLength);
+		*ptr++ = length;
+		std::memcpy(ptr, str, length);
+		return ptr + length;
+	}
+	else
+	{
+		std::memcpy(ptr, &value, sizeof(T));
+		return ptr + sizeof(T);
+	}
+}
+
+}	// namespace detail
+/// @endcond
+
+/**
+ * Deferred binary logger.
+ *
+ * Instead of formatting the arguments on the target, only a compact record
+ * is written into a ring buffer:
+ *
+ * - 4 byte ID of the format string,
+ * - 4 byte timestamp of `modm::PreciseClock` in microseconds,
+ * - 2 byte length of the arguments,
+ * - the raw bytes of the arguments, strings are prefixed with their length.
+ *
+ * The format strings are interned at compile time into the `modm_log_strings.*`
+ * ELF sections, which are not loaded onto Cortex-M devices. The ID is a hash
+ * of the level, argument types and format string, so that the
+ * `modm_tools.binary_log` decoder can reconstruct the text from the ELF file.
+ *
+ * Records are serialized on the stack and copied into the ring inside a short
+ * critical section, so that logging is safe from interrupts. If the ring is
+ * full, the whole record is dropped. The ring is drained by a single consumer
+ * without blocking the producers.
+ *
+ * @warning GCC ignores the section of static variables in templates, so
+ *          messages logged inside function templates cannot be decoded.
+ *
+ * @ingroup modm_debug_binary
+ */
+class BinaryLogger
+{
+public:
+	template< std::size_t Size >
+	constexpr BinaryLogger(uint8_t (&buffer)[Size]) :
+		buffer{buffer}, capacity{Size}
+	{}
+
+	BinaryLogger(const BinaryLogger&) = delete;
+	BinaryLogger& operator=(const BinaryLogger&) = delete;
+
+	/// Writes a record, use the `MODM_BINLOG_*` macros instead.
+	/// @note This function can be called from an interrupt.
+	template< uint32_t Id, typename... Args >
+	void
+	write(const Args&... args)
+	{
+		constexpr std::size_t MaxSize = 10 + (detail::binaryMaxSize<Args>() + ... + 0);
+		uint8_t record[MaxSize];
+		uint8_t* end = detail::serializeBinary(record, Id);
+		end = detail::serializeBinary(end, modm::PreciseClock::now().time_since_epoch().count());
+		uint8_t* const arguments = end += 2;
+		((end = detail::serializeBinary(end, args)), ...);
+		const uint16_t length = end - arguments;
+		std::memcpy(arguments - 2, &length, 2);
+		push(record, end - record);
+	}
+
+	/// Copies up to `data.size()` bytes of records into the buffer.
+	/// Records may be split across multiple reads.
+	/// @return number of bytes read
+	std::size_t
+	read(std::span<uint8_t> data);
+
+	/// Writes all records to the device, without blocking the producers.
+	void
+	drain(IODevice& device);
+
+	/// @return number of bytes waiting to be read.
+	std::size_t
+	getSize() const;
+
+	/// @return number of records dropped, because the ring was full.
+	uint32_t
+	getDropped() const
+	{ return dropped.load(std::memory_order_relaxed); }
+
+protected:
+	void
+	push(const uint8_t* data, std::size_t length);
+
+	uint8_t* const buffer;
+	const std::size_t capacity;
+	std::atomic<std::size_t> head{0};
+	std::atomic<std::size_t> tail{0};
+	std::atomic<uint32_t> dropped{0};
+};
+
+/// Default binary logger, its size is set by the `modm:debug:binary:buffer` option.
+/// @ingroup modm_debug_binary
+extern BinaryLogger binary;
+
+}	// namespace modm::log
+
+/**
+ * Log a printf-style message in binary.
+ *
+ * The format string must be a string literal. Arguments may be integers,
+ * enums, floating point numbers, pointers and C-strings.
+ *
+ * @ingroup modm_debug_binary
+ */
+#define MODM_BINLOG(level, format, ...) \
+	if (MODM_LOG_LEVEL > level){} \
+	else [&] \
+	{ \
+		using modm_binlog_types = decltype(::modm::log::detail::binaryTypes(__VA_ARGS__)); \
+		[[gnu::section("modm_log_strings." MODM_STRINGIFY(__COUNTER__)), gnu::used, gnu::retain]] \
+		static constexpr auto entry = ::modm::log::detail::makeBinaryEntry(level, format, modm_binlog_types{}); \
+		::modm::log::binary.write<::modm::log::detail::binaryId(entry)>(__VA_ARGS__); \
+	}()
+
+/// @ingroup modm_debug_binary
+/// @{
+#define MODM_BINLOG_DEBUG(format, ...) MODM_BINLOG(modm::log::DEBUG, format __VA_OPT__(,) __VA_ARGS__)
+#define MODM_BINLOG_INFO(format, ...) MODM_BINLOG(modm::log::INFO, format __VA_OPT__(,) __VA_ARGS__)
+#define MODM_BINLOG_WARNING(format, ...) MODM_BINLOG(modm::log::WARNING, format __VA_OPT__(,) __VA_ARGS__)
+#define MODM_BINLOG_ERROR(format, ...) MODM_BINLOG(modm::log::ERROR, format __VA_OPT__(,) __VA_ARGS__)
+/// @}
@@ -0,0 +1,237 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/io/iodevice.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <span>
+
+namespace modm::log
+{
+
+/**
+ * Lock-free multi-producer, single-consumer ring of log records.
+ *
+ * Each record consists of a 4-byte header followed by its payload, padded to
+ * whole words. Producers reserve space with a compare-and-swap on the head,
+ * copy their payload and then publish the record by writing its header. The
+ * consumer stops at the first unpublished header, so a producer interrupted
+ * after its reservation only delays the records behind it. Consumed words are
+ * cleared, so that an unpublished header always reads as zero.
+ *
+ * A record that does not fit in front of the end of the ring is preceded by a
+ * padding record, so that payloads are always contiguous. If the ring is full,
+ * the record is dropped and counted.
+ *
+ * @ingroup modm_debug
+ */
+class AsyncBuffer
+{
+	static constexpr uint32_t Published{0x8000'0000};
+	static constexpr uint32_t Padding{0x4000'0000};
+	static constexpr uint32_t LengthMask{0xffff};
+
+public:
+	template< std::size_t Size >
+	constexpr AsyncBuffer(uint32_t (&buffer)[Size]) :
+		words{buffer}, capacity{Size}
+	{
+		static_assert(Size >= 2 and Size <= 0x4000, "Size must be in [2, 16384] words!");
+	}
+
+	AsyncBuffer(const AsyncBuffer&) = delete;
+	AsyncBuffer& operator=(const AsyncBuffer&) = delete;
+
+	/// Appends the data as one record.
+	/// @return `false` if the ring was full and the record was dropped.
+	/// @note This function can be called from an interrupt.
+	bool
+	write(std::span<const uint8_t> data)
+	{
+		const std::size_t size = 1 + (data.size() + 3) / 4;
+		std::size_t reserved = head.load(std::memory_order_relaxed);
+		std::size_t start, next;
+		do
+		{
+			const std::size_t tail = this->tail.load(std::memory_order_acquire);
+			// Records must be contiguous, so skip the end of the ring if necessary
+			start = (reserved + size > capacity) ? 0 : reserved;
+			next = (start + size) % capacity;
+			const std::size_t used = (reserved + capacity - tail) % capacity;
+			const std::size_t required = size + (start ? 0 : (capacity - reserved) % capacity);
+			// One word is kept free to distinguish a full from an empty ring
+			if (data.size() > LengthMask or used + required >= capacity)
+			{
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+		}
+		while (not head.compare_exchange_weak(reserved, next, std::memory_order_relaxed));
+
+		if (start != reserved)
+			header(reserved).store(Published | Padding | (capacity - reserved), std::memory_order_release);
+		std::memcpy(reinterpret_cast<uint8_t*>(words + start + 1), data.data(), data.size());
+		header(start).store(Published | data.size(), std::memory_order_release);
+		return true;
+	}
+
+	/// Writes all published records to the device, one call per record.
+	/// Must only be called from a single context, for example the idle loop
+	/// or a low priority fiber.
+	/// @return number of records written
+	std::size_t
+	drain(IODevice& device)
+	{
+		std::size_t tail = this->tail.load(std::memory_order_relaxed);
+		std::size_t count{0};
+		while (tail != head.load(std::memory_order_acquire))
+		{
+			const uint32_t value = header(tail).load(std::memory_order_acquire);
+			// The producer of this record has not finished yet
+			if (not (value & Published)) break;
+
+			std::size_t size = value & LengthMask;
+			if (value & Padding) size -= 1;
+			else
+			{
+				device.write(std::span{reinterpret_cast<const uint8_t*>(words + tail + 1), size});
+				size = (size + 3) / 4;
+				count++;
+			}
+			std::fill_n(words + tail, 1 + size, 0);
+			tail = (tail + 1 + size) % capacity;
+			this->tail.store(tail, std::memory_order_release);
+		}
+		return count;
+	}
+
+	/// @return `true` if no record is waiting to be drained.
+	bool
+	isEmpty() const
+	{ return tail.load(std::memory_order_relaxed) == head.load(std::memory_order_relaxed); }
+
+	/// @return number of records dropped, because the ring was full.
+	uint32_t
+	getDropped() const
+	{ return dropped.load(std::memory_order_relaxed); }
+
+protected:
+	std::atomic_ref<uint32_t>
+	header(std::size_t index) const
+	{ return std::atomic_ref<uint32_t>{words[index]}; }
+
+	uint32_t* const words;
+	const std::size_t capacity;
+	std::atomic<std::size_t> head{0};
+	std::atomic<std::size_t> tail{0};
+	std::atomic<uint32_t> dropped{0};
+};
+
+/**
+ * Token bucket limiting the rate of log messages.
+ *
+ * The bucket holds up to `burst` tokens and is refilled with `rate` tokens
+ * per second. A rate of zero disables the limit.
+ *
+ * @ingroup modm_debug
+ */
+class RateLimit
+{
+public:
+	constexpr RateLimit(uint16_t rate = 0, uint16_t burst = 1) :
+		rate{rate}, burst{burst}, tokens{uint32_t(burst) * 1000}
+	{}
+
+	/// @return `true` if a message may be logged now.
+	/// @note This function can be called from an interrupt.
+	bool
+	acquire()
+	{
+		if (rate == 0) return true;
+		const uint32_t now = modm::Clock::now().time_since_epoch().count();
+		modm::atomic::Lock _;
+		// Tokens are counted in thousandths to refill them every millisecond
+		const uint32_t elapsed = std::min<uint32_t>(now - last, uint32_t(burst) * 1000 / rate + 1);
+		tokens = std::min<uint32_t>(tokens + elapsed * rate, uint32_t(burst) * 1000);
+		last = now;
+		if (tokens < 1000) return false;
+		tokens -= 1000;
+		return true;
+	}
+
+protected:
+	const uint16_t rate;
+	const uint16_t burst;
+	uint32_t tokens;
+	uint32_t last{0};
+};
+
+/**
+ * Asynchronous log device appending all output to an `AsyncBuffer`.
+ *
+ * Every write becomes one record, which is later drained into the real device.
+ * The rate limit is applied per line: if no token is available at the start
+ * of a line, the whole line is discarded and counted.
+ *
+ * @note Lines written concurrently from an interrupt and the main loop may
+ *       be interleaved at the granularity of single writes.
+ *
+ * @ingroup modm_debug
+ */
+class AsyncDevice : public IODevice
+{
+public:
+	AsyncDevice(AsyncBuffer& buffer, RateLimit limit = {}) :
+		buffer{buffer}, limit{limit}
+	{}
+
+	using IODevice::write;
+
+	void
+	write(char c) override
+	{ write(std::span{reinterpret_cast<const uint8_t*>(&c), 1}); }
+
+	void
+	write(std::span<const uint8_t> data) override
+	{
+		if (data.empty()) return;
+		if (lineStart and (discarding = not limit.acquire()))
+			limited.fetch_add(1, std::memory_order_relaxed);
+		lineStart = (data.back() == '\n');
+		if (not discarding) buffer.write(data);
+	}
+
+	/// Output is only flushed by draining the buffer.
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+
+	/// @return number of lines discarded by the rate limit.
+	uint32_t
+	getLimited() const
+	{ return limited.load(std::memory_order_relaxed); }
+
+protected:
+	AsyncBuffer& buffer;
+	RateLimit limit;
+	std::atomic<uint32_t> limited{0};
+	bool lineStart{true};
+	bool discarding{false};
+};
+
+}	// namespace modm::log
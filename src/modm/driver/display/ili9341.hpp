@@ -16,6 +16,7 @@
 #include <modm/architecture/interface/register.hpp>
 #include <modm/math/utils/endianness.hpp>
 #include <modm/platform/gpio/base.hpp>
+#include <modm/processing/resumable.hpp>
 #include <modm/ui/display/color_graphic_display.hpp>
 
 namespace modm
@@ -140,7 +141,7 @@ public:
 
 /// @ingroup modm_driver_ili9341
 template <class Interface, class Reset, class Backlight, std::size_t BufferSize = 320>
-class Ili9341 : public Interface, public modm::ColorGraphicDisplay
+class Ili9341 : public Interface, public modm::ColorGraphicDisplay, public modm::Resumable<1>
 {
 	static_assert(BufferSize >= 16, "at least a small buffer is required");
 
@@ -273,6 +274,23 @@ public:
 	void
 	drawRaw(glcd::Point upperLeft, uint16_t width, uint16_t height, color::Rgb565* data);
 
+	/**
+	 * Writes a tile of pixels, which the transport may transfer in the
+	 * background, for example via a DMA capable SPI master.
+	 *
+	 * The pixels are converted to the byte order of the display in place, so
+	 * the tile must not be modified until the write is complete. To overlap
+	 * rendering with the transfer, render the next tile into a second buffer
+	 * while a protothread waits for this function, or from another fiber.
+	 */
+	modm::ResumableResult<void>
+	writeTile(glcd::Point upperLeft, uint16_t width, uint16_t height, color::Rgb565* data);
+
+	/// @return `true` while a tile is being written.
+	bool
+	isWritingTile() const
+	{ return this->isResumableRunning(0); }
+
 	void
 	setScrollArea(uint16_t topFixedRows, uint16_t bottomFixedRows, uint16_t firstRow);
 
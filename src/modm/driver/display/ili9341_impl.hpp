@@ -270,20 +270,15 @@ void
 Ili9341<Interface, Reset, Backlight, BufferSize>::fillCircle(
 		glcd::Point center, uint16_t radius)
 {
-	uint8_t const setColor[] { uint8_t((foregroundColor.color >> 8) & 0xff),
-			uint8_t(foregroundColor.color & 0xff) };
-
 	int16_t f = 1 - radius;
 	int16_t ddF_x = 0;
 	int16_t ddF_y = -2 * radius;
 	uint16_t x = 0;
 	uint16_t y = radius;
 
-	BatchHandle h(*this);
-
-	setClipping(center.getX() - radius, center.getY(), 2 * radius, 1);
-	for (std::size_t i = 0; i < 2 * radius; ++i)
-		this->writeData(setColor, 2);
+	// Every row is written as one burst
+	if (radius)
+		drawHorizontalRun(glcd::Point(center.getX() - radius, center.getY()), 2 * radius);
 
 	while(x < y)
 	{
@@ -297,18 +292,10 @@ Ili9341<Interface, Reset, Backlight, BufferSize>::fillCircle(
 		ddF_x += 2;
 		f += ddF_x + 1;
 
-		setClipping(center.getX() - x, center.getY() - y, 2 * x, 1);
-		for (std::size_t i = 0; i < 2 * x; ++i)
-			this->writeData(setColor, 2);
-		setClipping(center.getX() - y, center.getY() - x, 2 * y, 1);
-		for (std::size_t i = 0; i < 2 * y; ++i)
-			this->writeData(setColor, 2);
-		setClipping(center.getX() - x, center.getY() + y, 2 * x, 1);
-		for (std::size_t i = 0; i < 2 * x; ++i)
-			this->writeData(setColor, 2);
-		setClipping(center.getX() - y, center.getY() + x, 2 * y, 1);
-		for (std::size_t i = 0; i < 2 * y; ++i)
-			this->writeData(setColor, 2);
+		drawHorizontalRun(glcd::Point(center.getX() - x, center.getY() - y), 2 * x);
+		drawHorizontalRun(glcd::Point(center.getX() - y, center.getY() - x), 2 * y);
+		drawHorizontalRun(glcd::Point(center.getX() - x, center.getY() + y), 2 * x);
+		drawHorizontalRun(glcd::Point(center.getX() - y, center.getY() + x), 2 * y);
 	}
 }
 
@@ -317,31 +304,36 @@ void
 Ili9341<Interface, Reset, Backlight, BufferSize>::drawImageRaw(glcd::Point upperLeft,
 		uint16_t width, uint16_t height, modm::accessor::Flash<uint8_t> data)
 {
-	uint8_t const setColor[] { uint8_t((foregroundColor.color >> 8) & 0xff),
-			uint8_t(foregroundColor.color & 0xff) };
-	uint8_t const clearColor[] { uint8_t((backgroundColor.color >> 8) & 0xff),
-			uint8_t(backgroundColor.color & 0xff) };
+	uint16_t const setColor { modm::toBigEndian(foregroundColor.color) };
+	uint16_t const clearColor { modm::toBigEndian(backgroundColor.color) };
+	uint16_t *buffer16 { reinterpret_cast<uint16_t *>(buffer) };
 
 	BatchHandle h(*this);
 
 	setClipping(upperLeft.getX(), upperLeft.getY(), width, height);
 
+	// The pixels are collected in the buffer and written in bursts
+	std::size_t count { 0 };
 	uint8_t bit = 0x01;
 	for (uint16_t r = 0; r < height; ++r)
 	{
 		for (uint16_t w = 0; w < width; ++w)
 		{
 			uint8_t byte = data[(r / 8) * width + w];
-			if (byte & bit)
-				this->writeData(setColor, 2);
-			else
-				this->writeData(clearColor, 2);
+			buffer16[count++] = (byte & bit) ? setColor : clearColor;
+			if (count == BufferSize)
+			{
+				this->writeData(buffer, BufferSize * 2);
+				count = 0;
+			}
 		}
 		// TODO: optimize, use ROL (rotate left)
 		bit <<= 1;
 		if (bit == 0)
 			bit = 0x01;
 	}
+	if (count)
+		this->writeData(buffer, count * 2);
 }
 
 template <class Interface, class Reset, class Backlight, std::size_t BufferSize>
@@ -349,15 +341,31 @@ void
 Ili9341<Interface, Reset, Backlight, BufferSize>::drawRaw(glcd::Point upperLeft,
 		uint16_t width, uint16_t height, color::Rgb565* data)
 {
-	BatchHandle h(*this);
+	RF_CALL_BLOCKING(writeTile(upperLeft, width, height, data));
+}
 
-	uint16_t* buffer = (uint16_t*)data;
-	for(size_t i = 0; i < size_t(width*height); i++) {
-		buffer[i] = modm::fromBigEndian(buffer[i]);
+template <class Interface, class Reset, class Backlight, std::size_t BufferSize>
+modm::ResumableResult<void>
+Ili9341<Interface, Reset, Backlight, BufferSize>::writeTile(glcd::Point upperLeft,
+		uint16_t width, uint16_t height, color::Rgb565* data)
+{
+	RF_BEGIN(0);
+
+	{
+		uint16_t* buffer = (uint16_t*)data;
+		for(size_t i = 0; i < size_t(width*height); i++) {
+			buffer[i] = modm::fromBigEndian(buffer[i]);
+		}
 	}
 
+	// The chip select must stay low across the transfer, so the batch cannot
+	// be scoped by a BatchHandle here.
+	this->beginBatch();
 	setClipping(upperLeft.getX(), upperLeft.getY(), width, height);
-	this->writeData((uint8_t*)buffer, width * height * 2);
+	RF_CALL(this->transferData((uint8_t*)data, size_t(width * height) * 2));
+	this->endBatch();
+
+	RF_END();
 }
 
 template <class Interface, class Reset, class Backlight, std::size_t BufferSize>
@@ -44,6 +44,15 @@ public:
 		for(std::size_t i=0; i<length16; ++i)
 			interface.writeData(modm::fromBigEndian(data16[i]));
 	}
+	/// The bus is written by the CPU, so the transfer is complete on return.
+	modm::ResumableResult<void>
+	transferData(uint8_t const *data, std::size_t length)
+	{
+		writeData(data, length);
+#ifndef MODM_RESUMABLE_IS_FIBER
+		return {modm::rf::Stop, 0};
+#endif
+	}
 	void
 	writeCommandValue8(Command command, uint8_t value)
 	{
@@ -66,6 +75,11 @@ public:
 		return interface.readData();
 	}
 
+	void
+	beginBatch() {}
+	void
+	endBatch() {}
+
 public:
 	struct BatchHandle
 	{
@@ -55,6 +55,12 @@ public:
 	{
 		SPI::transferBlocking(const_cast<unsigned char *>(data), nullptr, length);
 	}
+	/// Transfers the data via DMA, if the SPI master supports it.
+	modm::ResumableResult<void>
+	transferData(uint8_t const *data, std::size_t length)
+	{
+		return SPI::transfer(data, nullptr, length);
+	}
 	void
 	writeCommandValue8(Command command, uint8_t value)
 	{
@@ -81,6 +87,19 @@ public:
 		return SPI::transferBlocking(0x00);
 	}
 
+	void
+	beginBatch()
+	{
+		this->acquireMaster();
+		Cs::reset();
+	}
+	void
+	endBatch()
+	{
+		if (this->releaseMaster())
+			Cs::set();
+	}
+
 public:
 	struct BatchHandle
 	{
@@ -88,13 +107,11 @@ public:
 		BatchHandle(Ili9341SPIInterface& iface)
 		: i(iface)
 		{
-			i.acquireMaster();
-			Cs::reset();
+			i.beginBatch();
 		}
 		~BatchHandle()
 		{
-			if (i.releaseMaster())
-				Cs::set();
+			i.endBatch();
 		}
 	};
 };
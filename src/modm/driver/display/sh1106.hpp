@@ -38,17 +38,21 @@ protected:
 		RF_BEGIN();
 
 		this->transaction_success = true;
+		this->window = this->takeDirtyArea();
 
-		this->commandBuffer[0] = ssd1306::AdressingCommands::HigherColumnStartAddress;
-		this->commandBuffer[1] = 0x02;
-
-		for (page = 0; page < Height / 8; page++)
+		// Only the changed columns of the changed pages are transferred
+		for (this->page = this->window.y0; this->page < this->window.y1; this->page++)
 		{
-			this->commandBuffer[2] = 0xB0 | page;
+			// The RAM is 132 columns wide, the panel starts at column 2
+			this->commandBuffer[0] = ssd1306::AdressingCommands::HigherColumnStartAddress |
+									 ((this->window.x0 + 2) >> 4);
+			this->commandBuffer[1] = ssd1306::AdressingCommands::LowerColumnStartAddress |
+									 ((this->window.x0 + 2) & 0x0F);
+			this->commandBuffer[2] = ssd1306::AdressingCommands::PageStartAddress | this->page;
 			this->transaction_success &= RF_CALL(this->writeCommands(3));
 
-			RF_WAIT_UNTIL(
-				this->transaction.configureDisplayWrite((uint8_t*)&this->buffer[page], 128));
+			RF_WAIT_UNTIL(this->transaction.configureDisplayWrite(
+				&this->buffer[this->page][this->window.x0], this->window.x1 - this->window.x0));
 			RF_WAIT_UNTIL(this->startTransaction());
 			RF_WAIT_WHILE(this->isTransactionRunning());
 			this->transaction_success &= this->wasTransactionSuccessful();
@@ -67,9 +71,6 @@ protected:
 		this->transaction_success &= RF_CALL(this->writeCommands(2));
 		RF_END();
 	}
-
-private:
-	size_t page;
 };
 
 }  // namespace modm
@@ -182,6 +182,10 @@ protected:
 
 	uint8_t commandBuffer[7];
 	bool transaction_success;
+
+	// Buffer area currently transferred by startWriteDisplay()
+	typename MonochromeGraphicDisplayVertical<128, Height>::DirtyArea window;
+	uint8_t page;
 };
 
 }  // namespace modm
@@ -66,6 +66,9 @@ modm::Ssd1306<I2cMaster, Height>::initialize()
 	commandBuffer[0] = FundamentalCommands::DisplayOn;
 	transaction_success &= RF_CALL(writeCommands(1));
 
+	// The display RAM content is undefined, so the next update writes all of it
+	this->invalidate();
+
 	RF_END_RETURN(transaction_success);
 }
 
@@ -96,15 +99,53 @@ modm::Ssd1306<I2cMaster, Height>::initializeMemoryMode()
 }
 
 // ----------------------------------------------------------------------------
+/**
+ * @brief	Only the dirty area of the buffer is transferred. The address
+ * 			window is set to the dirty area, so that the display wraps to
+ * 			the next page by itself and each page only needs a transaction
+ * 			for its changed columns. Full width areas are contiguous in the
+ * 			buffer and sent in one transaction.
+ */
 template<class I2cMaster, uint8_t Height>
 modm::ResumableResult<void>
 modm::Ssd1306<I2cMaster, Height>::startWriteDisplay()
 {
 	RF_BEGIN();
 
-	RF_WAIT_UNTIL(
-		this->transaction.configureDisplayWrite((uint8_t*)(&this->buffer), sizeof(this->buffer)) and
-		this->startTransaction());
+	transaction_success = true;
+	window = this->takeDirtyArea();
+	if (window.isEmpty()) RF_RETURN();
+
+	commandBuffer[0] = AdressingCommands::ColumnAddress;
+	commandBuffer[1] = window.x0;
+	commandBuffer[2] = window.x1 - 1;
+	commandBuffer[3] = AdressingCommands::PageAddress;
+	commandBuffer[4] = window.y0;
+	commandBuffer[5] = window.y1 - 1;
+	transaction_success &= RF_CALL(writeCommands(6));
+
+	if (window.x0 == 0 and window.x1 == 128)
+	{
+		RF_WAIT_UNTIL(
+			this->transaction.configureDisplayWrite(&this->buffer[window.y0][0],
+													(window.y1 - window.y0) * 128) and
+			this->startTransaction());
+		RF_RETURN();
+	}
+
+	for (page = window.y0; page < window.y1; page++)
+	{
+		RF_WAIT_UNTIL(
+			this->transaction.configureDisplayWrite(&this->buffer[page][window.x0],
+													window.x1 - window.x0) and
+			this->startTransaction());
+		// The transfer of the last page is checked by the caller
+		if (page + 1 < window.y1)
+		{
+			RF_WAIT_WHILE(this->isTransactionRunning());
+			transaction_success &= this->wasTransactionSuccessful();
+		}
+	}
 
 	RF_END();
 }
@@ -118,8 +159,9 @@ modm::Ssd1306<I2cMaster, Height>::writeDisplay()
 	RF_CALL(startWriteDisplay());
 
 	RF_WAIT_WHILE(this->isTransactionRunning());
+	transaction_success &= this->wasTransactionSuccessful();
 
-	RF_END_RETURN(this->wasTransactionSuccessful());
+	RF_END_RETURN(transaction_success);
 }
 
 template<class I2cMaster, uint8_t Height>
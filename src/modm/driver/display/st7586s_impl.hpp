@@ -15,6 +15,8 @@
 #include <modm/architecture/interface/assert.hpp>
 #include <modm/architecture/interface/gpio.hpp>
 
+#include <algorithm>
+
 namespace modm
 {
 
@@ -65,7 +67,7 @@ St7586s<SPI, CS, RST, DC, Width, Height>::initialize()
 		| payload::DisplayControl::SegInc);
 	sendCommand(Command::DisplayDuty, uint8_t(Height - 1));
 	sendCommand(Command::InverseOff);
-	setClipping(0, 0, Width, Height);
+	this->invalidate();
 	update();  // clear the display
 	sendCommand(Command::DisplayOn);
 }
@@ -96,26 +98,27 @@ template <typename SPI, typename CS, typename RST, typename DC, int Width, int H
 void
 St7586s<SPI, CS, RST, DC, Width, Height>::update()
 {
+	const auto area = this->takeDirtyArea();
+	if (area.isEmpty()) return;
+
+	// A display column holds three pixels, so align the dirty area to whole columns
+	const uint16_t x0 = (area.x0 * 8) / pixelsPerByte * pixelsPerByte;
+	const uint16_t x1 = std::min<uint16_t>(
+		(area.x1 * 8 + pixelsPerByte - 1) / pixelsPerByte * pixelsPerByte,
+		Width / pixelsPerByte * pixelsPerByte);
+	setClipping(x0, area.y0, x1 - x0, area.y1 - area.y0);
+
 	sendCommand(Command::WriteDisplayData);
 	CS::reset();
-	// TODO: support windows other than full screen (then make setClipping public)
 	// TODO: transfer the whole memory area, not individual pixels
-	for (uint16_t y = 0; y < Height; y++) {
+	for (uint16_t y = area.y0; y < area.y1; y++) {
 		const uint8_t* row = this->buffer[y];
-		uint16_t currentByte = 0;
-		uint8_t validBits = 0;
-		for (uint16_t x = 0; x + 2 < Width; x += 3) {
-			if (validBits < 3) {
-				currentByte |= (*row++) << validBits;
-				validBits += 8;
-			}
-
+		const auto pixel = [row](uint16_t x) { return row[x / 8] & (1 << (x % 8)); };
+		for (uint16_t x = x0; x < x1; x += 3) {
 			uint8_t cell = 0;
-			if (currentByte & 0b001) cell |= (0b11 << 6);
-			if (currentByte & 0b010) cell |= (0b11 << 3);
-			if (currentByte & 0b100) cell |= (0b11 << 0);
-			validBits -= 3;
-			currentByte >>= 3;
+			if (pixel(x + 0)) cell |= (0b11 << 6);
+			if (pixel(x + 1)) cell |= (0b11 << 3);
+			if (pixel(x + 2)) cell |= (0b11 << 0);
 
 			SPI::transferBlocking(cell);
 		}
@@ -97,6 +97,41 @@ public:
 	{ /* noop */
 	}
 
+	void
+	drawImageRaw(glcd::Point start, uint16_t width, uint16_t height,
+				 modm::accessor::Flash<uint8_t> data) final
+	{
+		Driver::setClipping(start.x, start.y, width, height);
+
+		// All pixels of the image are written in a single memory write
+		Interface::beginCommand(Driver::Command::WriteDisplayData);
+		Interface::switchToDataMode();
+		for (uint16_t row = 0; row < height; ++row)
+		{
+			for (uint16_t column = 0; column < width; ++column)
+			{
+				const bool set = data[(row / 8) * width + column] & (1 << (row % 8));
+				const uint16_t color = set ? foregroundColor.color : backgroundColor.color;
+				Interface::continueData(uint8_t(color >> 8));
+				Interface::continueData(uint8_t(color));
+			}
+		}
+		Interface::end();
+	}
+
+protected:
+	void
+	drawHorizontalLine(glcd::Point start, uint16_t length) final
+	{
+		if (length) Driver::fill(start.x, start.y, length, 1, foregroundColor.color);
+	}
+
+	void
+	drawVerticalLine(glcd::Point start, uint16_t length) final
+	{
+		if (length) Driver::fill(start.x, start.y, 1, length, foregroundColor.color);
+	}
+
 private:
 	void
 	setPixel(int16_t x, int16_t y, const color::Rgb565 &color)
@@ -41,6 +41,10 @@ public:
 	void
 	clear(uint16_t color);
 
+	/// Fills the window with one color in a single memory write.
+	void
+	fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color);
+
 	void
 	setClipping(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
 
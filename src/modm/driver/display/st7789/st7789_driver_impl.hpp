@@ -48,11 +48,19 @@ template<typename Interface, uint16_t Width, uint16_t Height>
 void
 St7789Driver<Interface, Width, Height>::clear(uint16_t color)
 {
-	setClipping(0, 0, Width, Height);
+	fill(0, 0, Width, Height, color);
+}
+
+template<typename Interface, uint16_t Width, uint16_t Height>
+void
+St7789Driver<Interface, Width, Height>::fill(uint16_t x, uint16_t y, uint16_t width,
+											 uint16_t height, uint16_t color)
+{
+	setClipping(x, y, width, height);
 
 	Interface::beginCommand(Command::WriteDisplayData);
 	Interface::switchToDataMode();
-	for (size_t i = 0; i < Width * Height; ++i)
+	for (size_t i = 0; i < size_t(width) * height; ++i)
 	{
 		auto data = reinterpret_cast<const uint8_t *>(&color);
 		Interface::continueData(data[1]);
@@ -29,6 +29,12 @@ modm::Terminal::write(const char* s)
 	std::cout << s;
 }
 
+void
+modm::Terminal::write(std::span<const uint8_t> data)
+{
+	std::cout.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
 void
 modm::Terminal::flush()
 {
@@ -41,3 +47,15 @@ modm::Terminal::read(char& value)
 	std::cin.get(value);
 	return std::cin.good();
 }
+
+std::size_t
+modm::Terminal::read(std::span<uint8_t> data)
+{
+	if (data.empty()) return 0;
+	// Waits for the first byte like read(char&). The others are only read as
+	// far as they are already buffered, so an interactive terminal does not
+	// hang until the whole span is filled.
+	char* buffer = reinterpret_cast<char*>(data.data());
+	if (not read(buffer[0])) return 0;
+	return 1 + std::cin.readsome(buffer + 1, data.size() - 1);
+}
@@ -33,11 +33,17 @@ public :
 	virtual void
 	write(const char* s);
 
+	virtual void
+	write(std::span<const uint8_t> data);
+
 	virtual void
 	flush();
 
 	virtual bool
 	read(char& value);
+
+	virtual std::size_t
+	read(std::span<uint8_t> data);
 };
 
 }
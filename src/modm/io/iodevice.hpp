@@ -14,6 +14,10 @@
 #ifndef MODM_IODEVICE_HPP
 #define MODM_IODEVICE_HPP
 
+#include <stdint.h>
+#include <cstring>
+#include <span>
+
 namespace modm
 {
 
@@ -37,8 +41,16 @@ public:
 	virtual inline void
 	write(const char* str)
 	{
-		char c;
-		while ( (c = *str++) ) write(c);
+		write(std::span{reinterpret_cast<const uint8_t*>(str), std::strlen(str)});
+	}
+
+	/// Write a block of bytes.
+	/// Override this to pass the whole block to the hardware at once,
+	/// the default implementation writes the bytes one by one.
+	virtual inline void
+	write(std::span<const uint8_t> data)
+	{
+		for (const uint8_t c : data) write(char(c));
 	}
 
 	virtual void
@@ -47,6 +59,17 @@ public:
 	/// Read a single character
 	virtual bool
 	read(char& c) = 0;
+
+	/// Read up to `data.size()` bytes, stopping at the first byte that is
+	/// not available.
+	/// @return number of bytes read
+	virtual inline std::size_t
+	read(std::span<uint8_t> data)
+	{
+		std::size_t count{0};
+		while (count < data.size() and read(reinterpret_cast<char&>(data[count]))) count++;
+		return count;
+	}
 };
 
 }	// namespace modm
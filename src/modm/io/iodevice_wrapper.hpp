@@ -16,6 +16,7 @@
 #define MODM_IODEVICE_WRAPPER_HPP
 
 #include <stdint.h>
+#include <span>
 
 #include "iodevice.hpp"
 
@@ -42,6 +43,7 @@ class IODeviceWrapper : public IODevice
 public:
 	IODeviceWrapper() = default;
 	using IODevice::write;
+	using IODevice::read;
 
 	void
 	write(char c) override
@@ -54,6 +56,17 @@ public:
 		while(behavior == IOBuffer::BlockIfFull and not written);
 	}
 
+	void
+	write(std::span<const uint8_t> data) override
+	{
+		std::size_t written = Device::write(data.data(), data.size());
+		if constexpr (behavior == IOBuffer::BlockIfFull)
+		{
+			while (written < data.size())
+				written += Device::write(data.data() + written, data.size() - written);
+		}
+	}
+
 	void
 	flush() override
 	{
@@ -65,6 +78,12 @@ public:
 	{
 		return Device::read(reinterpret_cast<uint8_t&>(c));
 	}
+
+	std::size_t
+	read(std::span<uint8_t> data) override
+	{
+		return Device::read(data.data(), data.size());
+	}
 };
 
 /// @ingroup modm_io
@@ -75,6 +94,7 @@ class IODeviceObjectWrapper : public IODevice
 public:
 	IODeviceObjectWrapper(Device& device) : device{device} {}
 	using IODevice::write;
+	using IODevice::read;
 
 	void
 	write(char c) override
@@ -87,6 +107,17 @@ public:
 		while(behavior == IOBuffer::BlockIfFull and not written);
 	}
 
+	void
+	write(std::span<const uint8_t> data) override
+	{
+		std::size_t written = device.write(data.data(), data.size());
+		if constexpr (behavior == IOBuffer::BlockIfFull)
+		{
+			while (written < data.size())
+				written += device.write(data.data() + written, data.size() - written);
+		}
+	}
+
 	void
 	flush() override
 	{
@@ -98,6 +129,12 @@ public:
 	{
 		return device.read(reinterpret_cast<uint8_t&>(c));
 	}
+
+	std::size_t
+	read(std::span<uint8_t> data) override
+	{
+		return device.read(data.data(), data.size());
+	}
 };
 
 }
@@ -25,16 +25,8 @@ IOStream::get(char* s, size_t n)
 	if(n < 1) {
 		return *this;
 	}
-	char cc;
-	size_t ii;
-	for(ii = 0; ii < (n-1); ++ii) {
-		if(device->read(cc)) {
-			s[ii] = cc;
-		} else {
-			break;
-		}
-	}
-	s[ii] = '\0';
+	const size_t count = device->read(std::span{reinterpret_cast<uint8_t*>(s), n-1});
+	s[count] = '\0';
 	return *this;
 }
 
@@ -58,52 +50,55 @@ IOStream::operator << (const bool& v)
 }
 
 // ----------------------------------------------------------------------------
-void
-IOStream::writeHex(uint8_t value)
+char*
+IOStream::formatHex(char* str, uint8_t value)
 {
-	const auto fn_nibble = [this](uint8_t nibble)
+	const auto fn_nibble = [](uint8_t nibble) -> char
 	{
-		device->write( nibble + (nibble > 9 ? 'A' - 10 : '0') );
+		return nibble + (nibble > 9 ? 'A' - 10 : '0');
 	};
-	fn_nibble(value >> 4);
-	fn_nibble(value & 0xF);
+	*str++ = fn_nibble(value >> 4);
+	*str++ = fn_nibble(value & 0xF);
+	return str;
 }
 
-// ----------------------------------------------------------------------------
-void
-IOStream::writeBin(uint8_t value)
+char*
+IOStream::formatBin(char* str, uint8_t value)
 {
 	for (uint_fast8_t ii = 0; ii < 8; ii++)
 	{
-		device->write(value & 0x80 ? '1' : '0');
+		*str++ = (value & 0x80 ? '1' : '0');
 		value <<= 1;
 	}
+	return str;
 }
 
 // ----------------------------------------------------------------------------
 void
-IOStream::writePointer(const void* p)
+IOStream::writeHex(uint8_t value)
 {
-	device->write('0');
-	device->write('x');
-	const uintptr_t value = reinterpret_cast<uintptr_t>(p);
-
-#if MODM_SIZEOF_POINTER == 2
-
-	writeHex(value >> 8);
-	writeHex(value);
-
-#elif MODM_SIZEOF_POINTER == 4
-
-	for (uint8_t ii=24; ii < 32; ii -= 8)
-		writeHex(value >> ii);
-
-#elif MODM_SIZEOF_POINTER == 8
+	char str[2];
+	writeBuffer(str, formatHex(str, value) - str);
+}
 
-	for (uint8_t ii=56; ii < 64; ii -= 8)
-		writeHex(value >> ii);
+// ----------------------------------------------------------------------------
+void
+IOStream::writeBin(uint8_t value)
+{
+	char str[8];
+	writeBuffer(str, formatBin(str, value) - str);
+}
 
-#endif
+// ----------------------------------------------------------------------------
+void
+IOStream::writePointer(const void* p)
+{
+	char str[2 + 2 * sizeof(uintptr_t)] = {'0', 'x'};
+	char* end = str + 2;
+	const uintptr_t value = reinterpret_cast<uintptr_t>(p);
+	for (uint8_t ii = (sizeof(uintptr_t) - 1) * 8; ii < sizeof(uintptr_t) * 8; ii -= 8)
+		end = formatHex(end, value >> ii);
+	writeBuffer(str, end - str);
 }
 
 IOStream&
@@ -12,10 +12,13 @@
  */
 // ----------------------------------------------------------------------------
 
+#include "filter/biquad.hpp"
+#include "filter/block_fir.hpp"
 #include "filter/debounce.hpp"
 #include "filter/fir.hpp"
 #include "filter/median.hpp"
 #include "filter/moving_average.hpp"
+#include "filter/order_statistic.hpp"
 #include "filter/pid.hpp"
 #include "filter/ramp.hpp"
 #include "filter/s_curve_controller.hpp"
@@ -0,0 +1,177 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <span>
+#include <type_traits>
+
+namespace modm::filter
+{
+
+/**
+ * Coefficients of a biquad normalized to a0 = 1.
+ *
+ * H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ *
+ * @ingroup	modm_math_filter
+ */
+template< typename T >
+struct BiquadCoefficients
+{
+	T b0, b1, b2;
+	T a1, a2;
+};
+
+/**
+ * Cascade of second order infinite impulse response filters.
+ *
+ * Every stage is a biquad in transposed direct form II:
+ *
+ * y[n] = b0 * x[n] + s1
+ * s1 = b1 * x[n] - a1 * y[n] + s2
+ * s2 = b2 * x[n] - a2 * y[n]
+ *
+ * The coefficients are normalized to a0 = 1. Blocks are processed one stage
+ * at a time, so that the coefficients and the state of a stage stay in
+ * registers for the whole block.
+ *
+ * @code
+ * // 4th order Butterworth lowpass at 1 kHz for an 8 kHz stream
+ * using Filter = modm::filter::Biquad<float, 2>;
+ * Filter lowpass{{Filter::lowpass(1000, 8000, 0.5412f), Filter::lowpass(1000, 8000, 1.3066f)}};
+ * lowpass.process(adcBlock, filteredBlock);
+ * @endcode
+ *
+ * @tparam	T		Floating-point type
+ * @tparam	STAGES	Number of cascaded biquads
+ *
+ * @ingroup	modm_math_filter
+ */
+template< typename T, std::size_t STAGES = 1 >
+class Biquad
+{
+	static_assert(std::is_floating_point_v<T>, "Biquads are only implemented for floating-point types!");
+	static_assert(STAGES >= 1);
+
+public:
+	using Coefficients = BiquadCoefficients<T>;
+
+	Biquad(const Coefficients (&coefficients)[STAGES])
+	{
+		setCoefficients(coefficients);
+		reset();
+	}
+
+	void
+	setCoefficients(const Coefficients (&coefficients)[STAGES])
+	{
+		std::copy_n(coefficients, STAGES, this->coefficients);
+	}
+
+	/// Clears the state of all stages.
+	void
+	reset()
+	{
+		std::fill_n(state, STAGES, State{});
+		output = 0;
+	}
+
+	/**
+	 * Filters the input samples into the output samples.
+	 *
+	 * The output may be the same memory as the input for filtering in place.
+	 * Only as many samples as fit into the output are processed.
+	 */
+	void
+	process(std::span<const T> input, std::span<T> output)
+	{
+		const std::size_t size = std::min(input.size(), output.size());
+		if (size == 0) return;
+		const T* in = input.data();
+		for (std::size_t s = 0; s < STAGES; ++s)
+		{
+			processStage(s, in, output.data(), size);
+			in = output.data();
+		}
+		this->output = output[size - 1];
+	}
+
+	/// Filters a single sample.
+	void
+	update(const T& input)
+	{
+		process(std::span{&input, 1}, std::span{&output, 1});
+	}
+
+	/// @return the last output sample.
+	const T&
+	getValue() const
+	{
+		return output;
+	}
+
+	/// Lowpass with the cutoff frequency and quality factor, from the Audio EQ Cookbook.
+	static Coefficients
+	lowpass(T cutoff, T sampleRate, T q = T(std::numbers::sqrt2 / 2))
+	{
+		const T w = T(2 * std::numbers::pi) * cutoff / sampleRate;
+		const T alpha = std::sin(w) / (2 * q);
+		const T cosw = std::cos(w);
+		const T a0 = 1 + alpha;
+		return {(1 - cosw) / (2 * a0), (1 - cosw) / a0, (1 - cosw) / (2 * a0),
+				-2 * cosw / a0, (1 - alpha) / a0};
+	}
+
+	/// Highpass with the cutoff frequency and quality factor, from the Audio EQ Cookbook.
+	static Coefficients
+	highpass(T cutoff, T sampleRate, T q = T(std::numbers::sqrt2 / 2))
+	{
+		const T w = T(2 * std::numbers::pi) * cutoff / sampleRate;
+		const T alpha = std::sin(w) / (2 * q);
+		const T cosw = std::cos(w);
+		const T a0 = 1 + alpha;
+		return {(1 + cosw) / (2 * a0), -(1 + cosw) / a0, (1 + cosw) / (2 * a0),
+				-2 * cosw / a0, (1 - alpha) / a0};
+	}
+
+protected:
+	struct State
+	{
+		T s1{0};
+		T s2{0};
+	};
+
+	void
+	processStage(std::size_t stage, const T* in, T* out, std::size_t size)
+	{
+		const Coefficients c = coefficients[stage];
+		T s1 = state[stage].s1;
+		T s2 = state[stage].s2;
+		for (std::size_t n = 0; n < size; ++n)
+		{
+			const T x = in[n];
+			const T y = c.b0 * x + s1;
+			s1 = c.b1 * x - c.a1 * y + s2;
+			s2 = c.b2 * x - c.a2 * y;
+			out[n] = y;
+		}
+		state[stage] = {s1, s2};
+	}
+
+	Coefficients coefficients[STAGES];
+	State state[STAGES];
+	T output;
+};
+
+}	// namespace modm::filter
@@ -0,0 +1,203 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <modm/math/saturation/saturated.hpp>
+#include <modm/math/utils/simd.hpp>
+
+namespace modm::filter
+{
+
+/// @cond
+namespace detail
+{
+
+template< typename T >
+struct FirArithmetic
+{
+	using Accumulator = T;
+};
+
+// Q15: the Q30 products are summed exactly
+template<>
+struct FirArithmetic<int16_t>
+{
+	using Product = int32_t;
+	using Accumulator = int64_t;
+	static constexpr int ProductShift = 0;
+	static constexpr int OutputShift = 15;
+};
+
+// Q31: the Q62 products are summed as Q47, leaving 16 guard bits
+template<>
+struct FirArithmetic<int32_t>
+{
+	using Product = int64_t;
+	using Accumulator = int64_t;
+	static constexpr int ProductShift = 15;
+	static constexpr int OutputShift = 16;
+};
+
+}	// namespace detail
+/// @endcond
+
+/**
+ * Finite impulse response filter processing blocks of samples.
+ *
+ * y[n] = SUM(h[k] * x[n-k])
+ *
+ * Instead of a circular buffer, the last N-1 input samples are kept in front
+ * of a linear buffer of `BLOCK_SIZE` samples, so that the window of every
+ * output is contiguous. Several outputs are computed at once, with vector
+ * registers for `float` and `double` if the target has SIMD instructions.
+ * Blocks longer than `BLOCK_SIZE` are processed in several chunks.
+ *
+ * For the fixed-point types `int16_t` (Q15) and `int32_t` (Q31), samples and
+ * coefficients are in the same format. The products are accumulated with 64
+ * bits and the output is rounded and saturated.
+ *
+ * @code
+ * // 8 kHz ADC stream, one filter per channel
+ * modm::filter::BlockFir<float, 31> lowpass{coefficients};
+ * lowpass.process(adcBlock, filteredBlock);
+ * @endcode
+ *
+ * @tparam	T			`float`, `double`, `int16_t` (Q15) or `int32_t` (Q31)
+ * @tparam	N			Number of coefficients
+ * @tparam	BLOCK_SIZE	Number of samples buffered at once
+ *
+ * @ingroup	modm_math_filter
+ */
+template< typename T, std::size_t N, std::size_t BLOCK_SIZE = 32 >
+class BlockFir
+{
+	static_assert(N >= 1 and BLOCK_SIZE >= 1);
+	static_assert(std::is_floating_point_v<T> or std::is_same_v<T, int16_t> or std::is_same_v<T, int32_t>,
+			"Only floating-point, Q15 and Q31 samples are supported!");
+	using Arithmetic = detail::FirArithmetic<T>;
+	using Accumulator = typename Arithmetic::Accumulator;
+
+public:
+	/// @param	coefficients	h[0] to h[N-1], h[0] is applied to the newest sample
+	BlockFir(const T (&coefficients)[N])
+	{
+		setCoefficients(coefficients);
+		reset();
+	}
+
+	void
+	setCoefficients(const T (&coefficients)[N])
+	{
+		// Reversed, so that they are applied from the oldest sample onwards
+		std::reverse_copy(coefficients, coefficients + N, this->coefficients);
+	}
+
+	/// Clears the previous samples.
+	void
+	reset()
+	{
+		std::fill_n(samples, N - 1, T(0));
+	}
+
+	/**
+	 * Filters the input samples into the output samples.
+	 *
+	 * The output may be the same memory as the input for filtering in place.
+	 * Only as many samples as fit into the output are processed.
+	 */
+	void
+	process(std::span<const T> input, std::span<T> output)
+	{
+		std::size_t size = std::min(input.size(), output.size());
+		const T* in = input.data();
+		T* out = output.data();
+		while (size)
+		{
+			const std::size_t count = std::min(size, BLOCK_SIZE);
+			std::copy_n(in, count, samples + N - 1);
+			convolve(out, count);
+			// Keep the window of the next output in front of the buffer
+			std::copy_n(samples + count, N - 1, samples);
+			in += count;
+			out += count;
+			size -= count;
+		}
+	}
+
+protected:
+	void
+	convolve(T* out, std::size_t count) const
+	{
+		constexpr std::size_t L = modm::detail::simd::Lanes<T>;
+		// Four accumulators hide the latency of the multiply-add
+		constexpr std::size_t Block = L * 4;
+
+		std::size_t n = 0;
+		for (; n + Block <= count; n += Block)
+			convolveBlock<L, 4>(samples + n, out + n);
+		for (; n + L <= count and L > 1; n += L)
+			convolveBlock<L, 1>(samples + n, out + n);
+		for (; n < count; ++n)
+			convolveBlock<1, 1>(samples + n, out + n);
+	}
+
+	// Computes Count vectors of L neighbouring outputs from the oldest sample
+	// in the window of the first output.
+	template< std::size_t L, std::size_t Count >
+	void
+	convolveBlock(const T* x, T* out) const
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			using S = modm::detail::simd::Simd<T, L>;
+			typename S::Vector acc[Count];
+#pragma GCC unroll 4
+			for (std::size_t v = 0; v < Count; ++v)
+				acc[v] = coefficients[0] * S::load(x + v * L);
+			for (std::size_t k = 1; k < N; ++k)
+			{
+				const T h = coefficients[k];
+#pragma GCC unroll 4
+				for (std::size_t v = 0; v < Count; ++v)
+					acc[v] += h * S::load(x + k + v * L);
+			}
+#pragma GCC unroll 4
+			for (std::size_t v = 0; v < Count; ++v)
+				S::store(out + v * L, acc[v]);
+		}
+		else
+		{
+			Accumulator acc[Count]{};
+			for (std::size_t k = 0; k < N; ++k)
+			{
+				using Product = typename Arithmetic::Product;
+				const Product h = coefficients[k];
+#pragma GCC unroll 4
+				for (std::size_t v = 0; v < Count; ++v)
+					acc[v] += (h * Product(x[k + v])) >> Arithmetic::ProductShift;
+			}
+			constexpr Accumulator Round = Accumulator(1) << (Arithmetic::OutputShift - 1);
+#pragma GCC unroll 4
+			for (std::size_t v = 0; v < Count; ++v)
+				out[v] = modm::Saturated<T>((acc[v] + Round) >> Arithmetic::OutputShift).getValue();
+		}
+	}
+
+	T coefficients[N];
+	T samples[N - 1 + BLOCK_SIZE];
+};
+
+}	// namespace modm::filter
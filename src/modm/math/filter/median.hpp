@@ -15,6 +15,7 @@
 #define MODM_FILTER_MEDIAN_HPP
 
 #include <stdint.h>
+#include "order_statistic.hpp"
 
 namespace modm
 {
@@ -28,7 +29,8 @@ namespace modm
 		 *
 		 * Implementation are available for N = 3, 5, 7 and 9. To find
 		 * the median the signal values will be partly sorted, but only as much
-		 * as needed to find the median.
+		 * as needed to find the median. All other sizes use an
+		 * OrderStatistic filter, which returns the lower median for even N.
 		 *
 		 * \code
 		 * // create a new filter for five samples
@@ -68,11 +70,15 @@ namespace modm
 
 			/// calculate median
 			void
-			udpate();
+			update();
 
 			/// Get median value
 			const T
 			getValue() const;
+
+		private:
+			OrderStatistic<T, N> filter;
+			T median;
 		};
 	}
 }
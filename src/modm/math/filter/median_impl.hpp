@@ -28,4 +28,29 @@
 #undef MODM_MEDIAN_SWAP
 
 // ----------------------------------------------------------------------------
-// TODO General implementation
+template <typename T, int N>
+modm::filter::Median<T, N>::Median(const T& initialValue) :
+	filter(initialValue), median(initialValue)
+{
+}
+
+template <typename T, int N>
+void
+modm::filter::Median<T, N>::append(const T& input)
+{
+	filter.update(input);
+}
+
+template <typename T, int N>
+void
+modm::filter::Median<T, N>::update()
+{
+	median = filter.getValue();
+}
+
+template <typename T, int N>
+const T
+modm::filter::Median<T, N>::getValue() const
+{
+	return median;
+}
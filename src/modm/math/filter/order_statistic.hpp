@@ -0,0 +1,230 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include <modm/math/utils/integer_traits.hpp>
+
+namespace modm::filter
+{
+
+/**
+ * Sliding window order statistic filter
+ *
+ * Returns the k-th smallest of the N newest values, for example the median
+ * or a percentile of the window. Like the median it is useful for removing
+ * spikes from the input, but for windows of hundreds of samples.
+ *
+ * The window is split into two binary heaps: a max-heap holds the k+1
+ * smallest values and a min-heap the others, so the top of the max-heap is
+ * the result. Every update overwrites the oldest value in its heap, restores
+ * that heap and swaps the two tops if they are out of order. This costs
+ * O(log N) comparisons and the result is available in O(1). The filter
+ * needs no dynamic memory, only the values and two indices per sample.
+ *
+ * Changing the rank with setRank() rebuilds both heaps in O(N).
+ *
+ * \code
+ * // 95th percentile of the last 256 range measurements
+ * modm::filter::OrderStatistic<uint16_t, 256> filter;
+ * filter.setPercentile(95);
+ *
+ * filter.update(distance);
+ * output = filter.getValue();
+ * \endcode
+ *
+ * \tparam	T	Input type, must be less-than comparable
+ * \tparam	N	Number of samples
+ *
+ * \ingroup	modm_math_filter
+ */
+template<typename T, std::size_t N>
+class OrderStatistic
+{
+	static_assert(N >= 1);
+	using Index = least_uint<std::bit_width(N)>;
+
+public:
+	/// Defaults to the median, the lower median for even N
+	constexpr OrderStatistic(T initialValue = 0, std::size_t rank = (N - 1) / 2)
+	{
+		lowerSize = std::min(rank, N - 1) + 1;
+		reset(initialValue);
+	}
+
+	/// Reset whole buffer to 'input'
+	/// Next call of getValue() returns 'input'
+	constexpr void
+	reset(T input)
+	{
+		for (std::size_t i = 0; i < N; ++i) {
+			heap[i] = {input, Index(i)};
+			position[i] = i;
+		}
+		oldest = 0;
+	}
+
+	/// Replaces the oldest value in the window
+	constexpr void
+	update(T input)
+	{
+		const std::size_t i = position[oldest];
+		heap[i].value = input;
+		if constexpr (N == 1) {
+			// A single value is its own lower heap
+		}
+		else
+		{
+			if (i < lowerSize) {
+				restore<false>(i);
+			} else {
+				restore<true>(i - lowerSize);
+			}
+			// Only the new value can be on the wrong side
+			if (lowerSize < N and heap[lowerSize].value < heap[0].value)
+			{
+				const Entry top = heap[0];
+				place(0, heap[lowerSize]);
+				place(lowerSize, top);
+				siftDown<false>(0);
+				siftDown<true>(0);
+			}
+		}
+		if (++oldest == N)
+			oldest = 0;
+	}
+
+	/// Get the value with the configured rank in the window
+	constexpr T
+	getValue() const
+	{
+		return heap[0].value;
+	}
+
+	/// Zero-based rank of the value returned by getValue()
+	constexpr std::size_t
+	getRank() const
+	{
+		return lowerSize - 1;
+	}
+
+	/// Selects the rank of the value returned by getValue(), 0 is the minimum
+	/// and N-1 the maximum of the window
+	constexpr void
+	setRank(std::size_t rank)
+	{
+		lowerSize = std::min(rank, N - 1) + 1;
+		std::nth_element(heap, heap + getRank(), heap + N,
+						 [](const Entry& a, const Entry& b) { return a.value < b.value; });
+		for (std::size_t i = lowerSize / 2; i-- > 0; )
+			siftDown<false>(i);
+		for (std::size_t i = (N - lowerSize) / 2; i-- > 0; )
+			siftDown<true>(i);
+		for (std::size_t i = 0; i < N; ++i)
+			position[heap[i].slot] = i;
+	}
+
+	/// Selects the rank closest to the percentile from 0 to 100
+	constexpr void
+	setPercentile(float percentile)
+	{
+		percentile = std::clamp(percentile, 0.f, 100.f);
+		setRank(std::size_t(percentile * (N - 1) / 100 + 0.5f));
+	}
+
+private:
+	struct Entry
+	{
+		T value;
+		Index slot;
+	};
+
+	// The max-heap of the smaller values is stored in heap[0, lowerSize),
+	// the min-heap of the larger values in heap[lowerSize, N).
+	template<bool Upper>
+	static constexpr bool
+	above(const T& a, const T& b)
+	{
+		if constexpr (Upper) {
+			return a < b;
+		} else {
+			return b < a;
+		}
+	}
+
+	constexpr void
+	place(std::size_t i, const Entry& entry)
+	{
+		heap[i] = entry;
+		position[entry.slot] = i;
+	}
+
+	template<bool Upper>
+	constexpr void
+	restore(std::size_t i)
+	{
+		const std::size_t base = Upper ? lowerSize : 0;
+		if (i > 0 and above<Upper>(heap[base + i].value, heap[base + (i - 1) / 2].value)) {
+			siftUp<Upper>(i);
+		} else {
+			siftDown<Upper>(i);
+		}
+	}
+
+	template<bool Upper>
+	constexpr void
+	siftUp(std::size_t i)
+	{
+		const std::size_t base = Upper ? lowerSize : 0;
+		const Entry entry = heap[base + i];
+		while (i > 0)
+		{
+			const std::size_t parent = (i - 1) / 2;
+			if (not above<Upper>(entry.value, heap[base + parent].value))
+				break;
+			place(base + i, heap[base + parent]);
+			i = parent;
+		}
+		place(base + i, entry);
+	}
+
+	template<bool Upper>
+	constexpr void
+	siftDown(std::size_t i)
+	{
+		const std::size_t base = Upper ? lowerSize : 0;
+		const std::size_t size = Upper ? N - lowerSize : lowerSize;
+		const Entry entry = heap[base + i];
+		while (true)
+		{
+			std::size_t child = 2 * i + 1;
+			if (child >= size)
+				break;
+			if (child + 1 < size and above<Upper>(heap[base + child + 1].value, heap[base + child].value))
+				child++;
+			if (not above<Upper>(heap[base + child].value, entry.value))
+				break;
+			place(base + i, heap[base + child]);
+			i = child;
+		}
+		place(base + i, entry);
+	}
+
+	Entry heap[N];
+	Index position[N];
+	Index oldest;
+	Index lowerSize;
+};
+
+} // namespace modm::filter
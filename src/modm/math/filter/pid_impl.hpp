@@ -98,7 +98,8 @@ modm::Pid<T, ScaleFactor>::update(const T& input, bool externalLimitation)
 	// If an external limitation (saturation somewhere in the control loop) is
 	// applied the error sum will only be decremented, never incremented.
 	// This is done to help the system to leave the saturated state.
-	if (not limitation or (std::abs(tempErrorSum) < std::abs(this->errorSum)))
+	using std::abs;
+	if (not limitation or (abs(tempErrorSum) < abs(this->errorSum)))
 	{
 		this->errorSum = tempErrorSum;
 	}
@@ -0,0 +1,336 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <modm/math/utils/integer_traits.hpp>
+
+namespace modm
+{
+
+/**
+ * Signed fixed-point number with saturating arithmetic
+ *
+ * The value is stored as an integer scaled by 2^FracBits. Together with the
+ * sign bit, the integer and fractional bits must fill an `int8_t`, `int16_t`
+ * or `int32_t`: `fixed<15, 16>` is the Q15.16 format and `fixed<0, 15>` the
+ * Q15 format of 16-bit samples.
+ *
+ * All operations saturate at the limits of the format instead of wrapping
+ * around. Products and quotients are computed with twice the width and are
+ * rounded to nearest. Integers convert implicitly, floating-point values only
+ * explicitly, so that no float operation sneaks into the code of targets
+ * without FPU. Constants are converted at compile time:
+ *
+ * @code
+ * using q16 = modm::fixed<15, 16>;
+ * constexpr q16 gain{0.35f};
+ *
+ * q16 output = gain * input + 2;
+ * float value = float(output);
+ * @endcode
+ *
+ * The type can be used as the value type of modm::Pid, modm::filter::Fir
+ * and modm::Vector. `fixed_math.hpp` provides sqrt, hypot, sin, cos and atan2.
+ *
+ * @tparam	IntBits		Number of integer bits without the sign bit
+ * @tparam	FracBits	Number of fractional bits
+ *
+ * @ingroup	modm_math_fixed_point
+ */
+template<int IntBits, int FracBits>
+class fixed
+{
+	static_assert(IntBits >= 0 and FracBits >= 0);
+	static_assert(IntBits + FracBits + 1 == 8 or IntBits + FracBits + 1 == 16 or
+				  IntBits + FracBits + 1 == 32,
+			"The sign, integer and fractional bits must fill 8, 16 or 32 bit!");
+
+public:
+	/// Storage type of the raw value
+	using Type = std::make_signed_t<least_uint<IntBits + FracBits + 1>>;
+	/// Type holding the raw product of two values
+	using WideType = std::make_signed_t<least_uint<2 * (IntBits + FracBits + 1)>>;
+
+	static constexpr int integerBits = IntBits;
+	static constexpr int fractionalBits = FracBits;
+
+	constexpr fixed() = default;
+
+	/// Integer value, saturated to the range of the format
+	template<std::integral U>
+	constexpr fixed(U integer)
+	{
+		if (std::cmp_greater(integer, maxRaw >> FracBits)) {
+			value = maxRaw;
+		} else if (std::cmp_less(integer, minRaw >> FracBits)) {
+			value = minRaw;
+		} else {
+			value = Type(WideType(integer) << FracBits);
+		}
+	}
+
+	/// Floating-point value, rounded to nearest and saturated
+	template<std::floating_point U>
+	explicit constexpr fixed(U number)
+	{
+		const U scaled = number * U(WideType(1) << FracBits);
+		if (not (scaled < U(maxRaw))) {
+			value = maxRaw;
+		} else if (not (scaled > U(minRaw))) {
+			value = minRaw;
+		} else {
+			value = Type(scaled < 0 ? scaled - U(0.5) : scaled + U(0.5));
+		}
+	}
+
+	/// Value of another format, explicit if range or precision may be lost
+	template<int I, int F>
+	explicit(I > IntBits or F > FracBits)
+	constexpr fixed(const fixed<I, F>& other)
+	{
+		using Wide = std::common_type_t<WideType, typename fixed<I, F>::WideType>;
+		if constexpr (F > FracBits) {
+			value = saturate(roundShift(Wide(other.raw()), F - FracBits));
+		} else {
+			value = saturate(Wide(other.raw()) << (FracBits - F));
+		}
+	}
+
+	static constexpr fixed
+	fromRaw(Type raw)
+	{
+		fixed result;
+		result.value = raw;
+		return result;
+	}
+
+	constexpr Type
+	raw() const
+	{
+		return value;
+	}
+
+	/// Largest representable value
+	static constexpr fixed
+	max()
+	{
+		return fromRaw(maxRaw);
+	}
+
+	/// Most negative representable value
+	static constexpr fixed
+	min()
+	{
+		return fromRaw(minRaw);
+	}
+
+	/// Difference between two neighbouring values
+	static constexpr fixed
+	epsilon()
+	{
+		return fromRaw(1);
+	}
+
+	template<std::floating_point U>
+	explicit constexpr operator U() const
+	{
+		return U(value) / U(WideType(1) << FracBits);
+	}
+
+	/// Integer part, rounded towards zero
+	template<std::integral U>
+	explicit constexpr operator U() const
+	{
+		return U(value / (WideType(1) << FracBits));
+	}
+
+	// comparison operators
+	friend constexpr bool
+	operator==(const fixed&, const fixed&) = default;
+
+	friend constexpr auto
+	operator<=>(const fixed&, const fixed&) = default;
+
+	// arithmetic operators
+	friend constexpr fixed
+	operator+(fixed a, fixed b)
+	{
+		Type result;
+		if (__builtin_add_overflow(a.value, b.value, &result)) {
+			result = (b.value < 0) ? minRaw : maxRaw;
+		}
+		return fromRaw(result);
+	}
+
+	friend constexpr fixed
+	operator-(fixed a, fixed b)
+	{
+		Type result;
+		if (__builtin_sub_overflow(a.value, b.value, &result)) {
+			result = (b.value < 0) ? maxRaw : minRaw;
+		}
+		return fromRaw(result);
+	}
+
+	friend constexpr fixed
+	operator*(fixed a, fixed b)
+	{
+		return fromRaw(saturate(roundShift(WideType(a.value) * b.value, FracBits)));
+	}
+
+	/// Division by zero saturates towards the sign of the dividend
+	friend constexpr fixed
+	operator/(fixed a, fixed b)
+	{
+		if (b.value == 0) {
+			return fromRaw(a.value < 0 ? minRaw : maxRaw);
+		}
+		return fromRaw(saturate(roundDivide(WideType(a.value) << FracBits, b.value)));
+	}
+
+	constexpr fixed
+	operator-() const
+	{
+		return fromRaw(value == minRaw ? maxRaw : Type(-value));
+	}
+
+	constexpr fixed
+	operator+() const
+	{
+		return *this;
+	}
+
+	// Scaling with integers does not convert them into the format first,
+	// so that for example a Q15 value can be divided by 4.
+	template<std::integral U>
+	friend constexpr fixed
+	operator*(fixed a, U b)
+	{
+		return fromRaw(saturate(WideType(a.value) * clampInteger(b)));
+	}
+
+	template<std::integral U>
+	friend constexpr fixed
+	operator*(U a, fixed b)
+	{
+		return b * a;
+	}
+
+	template<std::integral U>
+	friend constexpr fixed
+	operator/(fixed a, U b)
+	{
+		if (b == 0) {
+			return fromRaw(a.value < 0 ? minRaw : maxRaw);
+		}
+		return fromRaw(saturate(roundDivide(WideType(a.value), clampInteger(b))));
+	}
+
+	constexpr fixed&
+	operator+=(fixed other)
+	{
+		return *this = *this + other;
+	}
+
+	constexpr fixed&
+	operator-=(fixed other)
+	{
+		return *this = *this - other;
+	}
+
+	constexpr fixed&
+	operator*=(fixed other)
+	{
+		return *this = *this * other;
+	}
+
+	constexpr fixed&
+	operator/=(fixed other)
+	{
+		return *this = *this / other;
+	}
+
+	template<std::integral U>
+	constexpr fixed&
+	operator*=(U other)
+	{
+		return *this = *this * other;
+	}
+
+	template<std::integral U>
+	constexpr fixed&
+	operator/=(U other)
+	{
+		return *this = *this / other;
+	}
+
+	friend constexpr fixed
+	abs(fixed a)
+	{
+		return (a.value < 0) ? -a : a;
+	}
+
+private:
+	static constexpr Type maxRaw = std::numeric_limits<Type>::max();
+	static constexpr Type minRaw = std::numeric_limits<Type>::min();
+
+	template<typename W>
+	static constexpr Type
+	saturate(W raw)
+	{
+		return (raw > maxRaw) ? maxRaw : ((raw < minRaw) ? minRaw : Type(raw));
+	}
+
+	template<typename W>
+	static constexpr W
+	roundShift(W raw, int shift)
+	{
+		return (shift > 0) ? W((raw + (W(1) << (shift - 1))) >> shift) : raw;
+	}
+
+	static constexpr WideType
+	roundDivide(WideType dividend, WideType divisor)
+	{
+		const WideType half = (divisor < 0 ? -divisor : divisor) / 2;
+		return ((dividend < 0) ? (dividend - half) : (dividend + half)) / divisor;
+	}
+
+	// Larger integers saturate any product with a non-zero value anyway
+	template<std::integral U>
+	static constexpr WideType
+	clampInteger(U integer)
+	{
+		if (std::cmp_greater(integer, maxRaw)) return WideType(maxRaw) + 1;
+		if (std::cmp_less(integer, minRaw)) return WideType(minRaw) - 1;
+		return WideType(integer);
+	}
+
+	Type value{0};
+};
+
+/// @ingroup modm_math_fixed_point
+/// @{
+template<typename T>
+struct is_fixed_point : std::false_type {};
+
+template<int IntBits, int FracBits>
+struct is_fixed_point< fixed<IntBits, FracBits> > : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_fixed_point_v = is_fixed_point<T>::value;
+/// @}
+
+}	// namespace modm
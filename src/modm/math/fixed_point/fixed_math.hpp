@@ -0,0 +1,304 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <utility>
+
+#include "fixed.hpp"
+
+/// @cond
+namespace modm::detail::fixed_point
+{
+
+// Only used at compile time to build the tables
+constexpr double
+sineSeries(double x)
+{
+	double term = x;
+	double sum = x;
+	for (int n = 1; n < 20; ++n)
+	{
+		term *= -x * x / ((2 * n) * (2 * n + 1));
+		sum += term;
+	}
+	return sum;
+}
+
+constexpr double
+arctanSeries(double x)
+{
+	double power = x;
+	double sum = 0;
+	for (int n = 0; n < 60; ++n)
+	{
+		sum += ((n % 2) ? -power : power) / (2 * n + 1);
+		power *= x * x;
+	}
+	return sum;
+}
+
+// Sine of the first quarter circle in Q30 at 256 steps, plus one step beyond
+// for the interpolation of the last step.
+inline constexpr std::array<int32_t, 258> sineTable = []
+{
+	std::array<int32_t, 258> table{};
+	for (std::size_t i = 0; i < table.size(); ++i) {
+		table[i] = int32_t(sineSeries(i * std::numbers::pi / 512) * (1 << 30) + 0.5);
+	}
+	return table;
+}();
+
+// atan(2^-i) in units of 2^-32 full circles
+inline constexpr std::array<uint32_t, 30> arctanTable = []
+{
+	std::array<uint32_t, 30> table{};
+	table[0] = uint32_t(1) << 29;
+	for (std::size_t i = 1; i < table.size(); ++i) {
+		table[i] = uint32_t(arctanSeries(1.0 / (uint64_t(1) << i)) * 4294967296.0 / (2 * std::numbers::pi) + 0.5);
+	}
+	return table;
+}();
+
+// Angle in radians with FracBits to units of 2^-32 full circles, modulo one circle
+template<int FracBits>
+constexpr uint32_t
+toPhase(int32_t radian)
+{
+	// 2^32 / 2pi with 32 more fractional bits, so that large angles keep
+	// their accuracy
+	constexpr int64_t Scale = 683565275;
+	constexpr int64_t ScaleFraction = 2475754826;
+	constexpr int64_t Round = FracBits ? (int64_t(1) << (FracBits - 1)) : 0;
+	return uint32_t((radian * Scale + ((radian * ScaleFraction) >> 32) + Round) >> FracBits);
+}
+
+// Signed units of 2^-32 full circles to radians with FracBits
+template<int FracBits>
+constexpr int64_t
+toRadian(int32_t phase)
+{
+	// round(2pi * 2^29)
+	constexpr int64_t Scale = 3373259426;
+	constexpr int Shift = 61 - FracBits;
+	return (phase * Scale + (int64_t(1) << (Shift - 1))) >> Shift;
+}
+
+// Sine of the phase in Q30 by linear interpolation of the table
+constexpr int32_t
+sine(uint32_t phase)
+{
+	const uint32_t quadrant = phase >> 30;
+	uint32_t position = phase & 0x3fff'ffff;
+	if (quadrant & 1) {
+		position = 0x4000'0000 - position;
+	}
+	const uint32_t index = position >> 22;
+	const int32_t fraction = position & 0x3f'ffff;
+	const int32_t y0 = sineTable[index];
+	const int32_t y1 = sineTable[index + 1];
+	const int32_t y = y0 + int32_t((int64_t(y1 - y0) * fraction + (1 << 21)) >> 22);
+	return (quadrant & 2) ? -y : y;
+}
+
+// Angle of the vector in signed units of 2^-32 full circles by CORDIC
+template<int Iterations>
+constexpr int32_t
+arctan2(int32_t y, int32_t x)
+{
+	if (x == 0 and y == 0) {
+		return 0;
+	}
+	int64_t x64 = x;
+	int64_t y64 = y;
+	uint32_t phase = 0;
+	// Rotate by half a circle into the right half plane
+	if (x64 < 0)
+	{
+		x64 = -x64;
+		y64 = -y64;
+		phase = uint32_t(1) << 31;
+	}
+	// Scale to 29 bits, so that the CORDIC gain cannot overflow
+	const int shift = std::bit_width(uint64_t(std::max(x64, y64 < 0 ? -y64 : y64))) - 29;
+	if (shift > 0) {
+		x64 >>= shift;
+		y64 >>= shift;
+	} else {
+		x64 <<= -shift;
+		y64 <<= -shift;
+	}
+
+	int32_t xi = int32_t(x64);
+	int32_t yi = int32_t(y64);
+	for (int i = 0; i < Iterations; ++i)
+	{
+		// Rotate towards the x axis. The unpredictable direction is applied
+		// by negating with a mask instead of a branch.
+		const int32_t mask = -int32_t(yi <= 0);
+		const int32_t dx = ((xi >> i) ^ mask) - mask;
+		const int32_t dy = ((yi >> i) ^ mask) - mask;
+		xi += dy;
+		yi -= dx;
+		phase += (arctanTable[i] ^ uint32_t(mask)) - uint32_t(mask);
+	}
+	// Keep the sign of y next to the negative x axis
+	const int32_t angle = int32_t(phase);
+	if (y >= 0 and angle < 0 and x < 0) {
+		return std::numeric_limits<int32_t>::max();
+	}
+	if (y < 0 and angle > 0 and x < 0) {
+		return std::numeric_limits<int32_t>::min();
+	}
+	return angle;
+}
+
+// Rounded integer square root
+template<typename T>
+constexpr T
+squareRoot(T n)
+{
+	const T original = n;
+	T root = 0;
+	// Largest power of four not above the value
+	T bit = n ? T(1) << ((std::bit_width(n) - 1) & ~1) : 0;
+	while (bit)
+	{
+		// Masks instead of branches, as the comparison is not predictable
+		const T trial = root + bit;
+		const T mask = T(0) - T(n >= trial);
+		n -= trial & mask;
+		root = (root >> 1) + (bit & mask);
+		bit >>= 2;
+	}
+	// (root + 0.5)^2 = root^2 + root + 0.25
+	return (original - root * root > root) ? root + 1 : root;
+}
+
+template<int IntBits, int FracBits, typename W>
+constexpr fixed<IntBits, FracBits>
+saturated(W raw)
+{
+	using Fixed = fixed<IntBits, FracBits>;
+	if (std::cmp_greater(raw, Fixed::max().raw())) return Fixed::max();
+	if (std::cmp_less(raw, Fixed::min().raw())) return Fixed::min();
+	return Fixed::fromRaw(typename Fixed::Type(raw));
+}
+
+}	// namespace modm::detail::fixed_point
+/// @endcond
+
+namespace modm
+{
+
+/// @ingroup modm_math_fixed_point
+/// @{
+
+/**
+ * Square root, rounded to nearest
+ *
+ * Computed bit by bit with integer operations, negative values return zero.
+ */
+template<int IntBits, int FracBits>
+constexpr fixed<IntBits, FracBits>
+sqrt(fixed<IntBits, FracBits> value)
+{
+	using Fixed = fixed<IntBits, FracBits>;
+	using Unsigned = std::make_unsigned_t<typename Fixed::WideType>;
+	if (value.raw() <= 0) {
+		return Fixed{};
+	}
+	// sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F)
+	const Unsigned root = detail::fixed_point::squareRoot(Unsigned(Unsigned(value.raw()) << FracBits));
+	return detail::fixed_point::saturated<IntBits, FracBits>(root);
+}
+
+/**
+ * Length of the vector (x, y), rounded to nearest
+ *
+ * The squares are summed with twice the width, so that the result only
+ * saturates if the length itself cannot be represented.
+ */
+template<int IntBits, int FracBits>
+constexpr fixed<IntBits, FracBits>
+hypot(fixed<IntBits, FracBits> x, fixed<IntBits, FracBits> y)
+{
+	using Fixed = fixed<IntBits, FracBits>;
+	using Unsigned = std::make_unsigned_t<typename Fixed::WideType>;
+	const auto wx = typename Fixed::WideType(x.raw());
+	const auto wy = typename Fixed::WideType(y.raw());
+	const Unsigned root = detail::fixed_point::squareRoot(Unsigned(Unsigned(wx * wx) + Unsigned(wy * wy)));
+	return detail::fixed_point::saturated<IntBits, FracBits>(root);
+}
+
+/**
+ * Sine of an angle in radians
+ *
+ * Interpolated linearly from a table of 256 values per quarter circle with
+ * an error below 5e-6, limited by the resolution of the format.
+ */
+template<int IntBits, int FracBits>
+constexpr fixed<IntBits, FracBits>
+sin(fixed<IntBits, FracBits> angle)
+{
+	using namespace detail::fixed_point;
+	const int64_t sine = detail::fixed_point::sine(toPhase<FracBits>(angle.raw()));
+	if constexpr (FracBits > 30) {
+		return saturated<IntBits, FracBits>(sine << (FracBits - 30));
+	} else {
+		constexpr int Shift = 30 - FracBits;
+		return saturated<IntBits, FracBits>(Shift ? (sine + (int64_t(1) << Shift >> 1)) >> Shift : sine);
+	}
+}
+
+/**
+ * Cosine of an angle in radians
+ *
+ * @see	sin()
+ */
+template<int IntBits, int FracBits>
+constexpr fixed<IntBits, FracBits>
+cos(fixed<IntBits, FracBits> angle)
+{
+	using namespace detail::fixed_point;
+	// cos(x) = sin(x + pi/2)
+	const int64_t cosine = sine(toPhase<FracBits>(angle.raw()) + (uint32_t(1) << 30));
+	if constexpr (FracBits > 30) {
+		return saturated<IntBits, FracBits>(cosine << (FracBits - 30));
+	} else {
+		constexpr int Shift = 30 - FracBits;
+		return saturated<IntBits, FracBits>(Shift ? (cosine + (int64_t(1) << Shift >> 1)) >> Shift : cosine);
+	}
+}
+
+/**
+ * Angle of the vector (x, y) in radians from -pi to pi
+ *
+ * Computed by CORDIC in vectoring mode with shifts and additions only, with
+ * enough iterations for the resolution of the format. The result saturates
+ * if the format cannot represent pi.
+ */
+template<int IntBits, int FracBits>
+constexpr fixed<IntBits, FracBits>
+atan2(fixed<IntBits, FracBits> y, fixed<IntBits, FracBits> x)
+{
+	using namespace detail::fixed_point;
+	constexpr int Iterations = std::min(FracBits + 4, 28);
+	return saturated<IntBits, FracBits>(toRadian<FracBits>(arctan2<Iterations>(y.raw(), x.raw())));
+}
+
+/// @}
+
+}	// namespace modm
@@ -20,6 +20,8 @@
 #include <math.h>
 #include <numbers>
 
+#include <modm/math/fixed_point/fixed.hpp>
+
 // The circumference of a circle with diameter 1
 #ifndef M_PI
 #define M_PI  3.14159265358979323846
@@ -112,6 +114,46 @@ namespace modm
 		static float
 		perpendicular(float angle, const bool cw);
 
+		/// Normalize a fixed-point angle to [-Pi,Pi]
+		template<int IntBits, int FracBits>
+		static constexpr fixed<IntBits, FracBits>
+		normalize(fixed<IntBits, FracBits> angle)
+		{
+			constexpr auto pi = pi_v<IntBits, FracBits>;
+			// 2*Pi may not be representable, so Pi is subtracted twice
+			while (angle > pi) {
+				angle = angle - pi - pi;
+			}
+			while (angle < -pi) {
+				angle = angle + pi + pi;
+			}
+			return angle;
+		}
+
+		/// Reverse a fixed-point angle and keep it normalized to [-Pi,Pi]
+		template<int IntBits, int FracBits>
+		static constexpr fixed<IntBits, FracBits>
+		reverse(fixed<IntBits, FracBits> angle)
+		{
+			constexpr auto pi = pi_v<IntBits, FracBits>;
+			return (angle >= 0) ? angle - pi : angle + pi;
+		}
+
+		/// Find a perpendicular fixed-point angle
+		template<int IntBits, int FracBits>
+		static constexpr fixed<IntBits, FracBits>
+		perpendicular(fixed<IntBits, FracBits> angle, const bool cw)
+		{
+			constexpr auto pi = pi_v<IntBits, FracBits>;
+			constexpr auto halfPi = pi / 2;
+			// Wraps around before the sum could saturate
+			angle = normalize(angle);
+			if (cw) {
+				return (angle < -halfPi) ? angle + pi + halfPi : angle - halfPi;
+			}
+			return (angle > halfPi) ? angle - pi - halfPi : angle + halfPi;
+		}
+
 		static constexpr float
 		toRadian(float angle)
 		{
@@ -123,6 +165,14 @@ namespace modm
 		{
 			return ::modm::toDegree(angle);
 		}
+
+	private:
+		template<int IntBits, int FracBits>
+		static constexpr fixed<IntBits, FracBits> pi_v = []
+		{
+			static_assert(IntBits >= 2, "Fixed-point angles need at least two integer bits!");
+			return fixed<IntBits, FracBits>(std::numbers::pi);
+		}();
 	};
 }
 
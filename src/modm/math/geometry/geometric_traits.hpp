@@ -16,6 +16,7 @@
 #include <cmath>
 #include <stdint.h>
 #include <modm/architecture/utils.hpp>
+#include <modm/math/fixed_point/fixed.hpp>
 
 namespace modm
 {
@@ -138,6 +139,23 @@ namespace modm
 			return value;
 		}
 	};
+
+	template <int IntBits, int FracBits>
+	struct GeometricTraits< fixed<IntBits, FracBits> >
+	{
+		static const bool isValidType = true;
+
+		typedef float FloatType;
+
+		// Products saturate instead of overflowing
+		typedef fixed<IntBits, FracBits> WideType;
+
+		static inline fixed<IntBits, FracBits>
+		round(float value)
+		{
+			return fixed<IntBits, FracBits>(value);
+		}
+	};
 }
 
 #endif // MODM_GEOMETRIC_TRAITS_HPP
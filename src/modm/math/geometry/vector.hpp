@@ -18,6 +18,7 @@
 #include <cmath>
 #include <stdint.h>
 
+#include <modm/math/fixed_point/fixed_math.hpp>
 #include <modm/math/matrix.hpp>
 #include <modm/math/utils/arithmetic_traits.hpp>
 
@@ -118,10 +118,16 @@ template<typename T>
 T
 modm::Vector<T, 2>::getLength() const
 {
-	float tx = this->x;
-	float ty = this->y;
+	if constexpr (is_fixed_point_v<T>) {
+		return hypot(this->x, this->y);
+	}
+	else
+	{
+		float tx = this->x;
+		float ty = this->y;
 
-	return GeometricTraits<T>::round(std::sqrt(tx*tx + ty*ty));
+		return GeometricTraits<T>::round(std::sqrt(tx*tx + ty*ty));
+	}
 }
 
 // ----------------------------------------------------------------------------
@@ -140,7 +146,16 @@ template<typename T>
 float
 modm::Vector<T, 2>::getAngle() const
 {
-	return std::atan2(this->y, this->x);
+	if constexpr (is_fixed_point_v<T>)
+	{
+		// The angle only depends on the ratio of the coordinates, so the raw
+		// values are used in a format that can represent Pi.
+		using Radian = fixed<3, 28>;
+		return static_cast<float>(atan2(Radian::fromRaw(this->y.raw()), Radian::fromRaw(this->x.raw())));
+	}
+	else {
+		return std::atan2(this->y, this->x);
+	}
 }
 
 // ----------------------------------------------------------------------------
@@ -194,13 +209,26 @@ template<typename T>
 modm::Vector<T, 2>&
 modm::Vector<T, 2>::rotate(float phi)
 {
-	float c = std::cos(phi);
-	float s = std::sin(phi);
+	if constexpr (is_fixed_point_v<T>)
+	{
+		const fixed<15, 16> angle(phi);
+		const T c = T(cos(angle));
+		const T s = T(sin(angle));
+
+		T tx =    c * this->x - s * this->y;
+		this->y = s * this->x + c * this->y;
+		this->x = tx;
+	}
+	else
+	{
+		float c = std::cos(phi);
+		float s = std::sin(phi);
 
-	// without rounding the result might be false for T = integer
-	T tx =    GeometricTraits<T>::round(c * this->x - s * this->y);
-	this->y = GeometricTraits<T>::round(s * this->x + c * this->y);
-	this->x = tx;
+		// without rounding the result might be false for T = integer
+		T tx =    GeometricTraits<T>::round(c * this->x - s * this->y);
+		this->y = GeometricTraits<T>::round(s * this->x + c * this->y);
+		this->x = tx;
+	}
 
 	return *this;
 }
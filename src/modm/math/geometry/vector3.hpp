@@ -15,6 +15,7 @@
 #define MODM_VECTOR3_HPP
 
 #include <stdint.h>
+#include <type_traits>
 #include "vector.hpp"
 
 namespace modm
@@ -119,8 +120,11 @@ namespace modm
 		Vector& operator *= (const T &rhs);
 		Vector& operator /= (const T &rhs);
 
-		float getLength() const;
-		float getLengthSquared() const;
+		/// Fixed-point vectors keep their type, all others use float
+		using LengthType = std::conditional_t<is_fixed_point_v<T>, T, float>;
+
+		LengthType getLength() const;
+		LengthType getLengthSquared() const;
 
 		Vector scaled(float newLength) const;
 		void scale(float newLength);
@@ -427,15 +427,20 @@ modm::Vector<T, 3>::operator - () const
 
 // ----------------------------------------------------------------------------
 template<typename T>
-float
+typename modm::Vector<T, 3>::LengthType
 modm::Vector<T, 3>::getLength() const
 {
-	return std::sqrt(getLengthSquared());
+	if constexpr (is_fixed_point_v<T>) {
+		return hypot(hypot(x, y), z);
+	}
+	else {
+		return std::sqrt(getLengthSquared());
+	}
 }
 
 // ----------------------------------------------------------------------------
 template<typename T>
-float
+typename modm::Vector<T, 3>::LengthType
 modm::Vector<T, 3>::getLengthSquared() const
 {
 	return x*x+y*y+z*z;
@@ -454,8 +459,8 @@ template<typename T>
 modm::Vector<T, 3>
 modm::Vector<T, 3>::scaled(float newLength) const
 {
-	float scale = newLength/getLength();
-	return *this * scale;
+	float scale = newLength / float(getLength());
+	return *this * T(scale);
 }
 
 // ----------------------------------------------------------------------------
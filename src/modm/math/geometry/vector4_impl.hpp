@@ -693,15 +693,20 @@ modm::Vector<T, 4>::operator - () const
 
 // ----------------------------------------------------------------------------
 template<typename T>
-float
+typename modm::Vector<T, 4>::LengthType
 modm::Vector<T, 4>::getLength() const
 {
-	return std::sqrt(getLengthSquared());
+	if constexpr (is_fixed_point_v<T>) {
+		return hypot(hypot(x, y), hypot(z, w));
+	}
+	else {
+		return std::sqrt(getLengthSquared());
+	}
 }
 
 // ----------------------------------------------------------------------------
 template<typename T>
-float
+typename modm::Vector<T, 4>::LengthType
 modm::Vector<T, 4>::getLengthSquared() const
 {
 	return x*x + y*y + z*z + w*w;
@@ -720,8 +725,8 @@ template<typename T>
 modm::Vector<T, 4>
 modm::Vector<T, 4>::scaled(float newLength) const
 {
-	float scale = newLength / getLength();
-	return *this * scale;
+	float scale = newLength / float(getLength());
+	return *this * T(scale);
 }
 
 // ----------------------------------------------------------------------------
@@ -316,7 +316,8 @@ template<typename T, uint8_t N>
 T
 modm::Vector<T, N>::getLength() const
 {
-	return std::sqrt(getLengthSquared());
+	using std::sqrt;
+	return sqrt(getLengthSquared());
 }
 
 // ----------------------------------------------------------------------------
@@ -16,5 +16,7 @@
 
 #include "interpolation/linear.hpp"
 #include "interpolation/lagrange.hpp"
+#include "interpolation/linear_table.hpp"
+#include "interpolation/lagrange_table.hpp"
 
 #endif	// MODM_INTERPOLATION_HPP
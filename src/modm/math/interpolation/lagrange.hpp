@@ -16,6 +16,8 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <span>
 #include <type_traits>
 #include <modm/container/pair.hpp>
 #include <modm/architecture/interface/accessor.hpp>
@@ -25,6 +27,12 @@ namespace modm
 	namespace interpolation
 	{
 		/**
+		 * Lagrange interpolation through all supporting points.
+		 *
+		 * Every interpolation costs O(N^2) multiplications. For constant
+		 * supporting points see LagrangeTable, which precomputes the
+		 * polynomial.
+		 *
 		 * \warning	Only floating points types are allowed as second type of
 		 * 			modm::Pair, otherwise the calculation will deliver wrong
 		 * 			results!
@@ -70,6 +78,14 @@ namespace modm
 			OutputType
 			interpolate(const InputType& value) const;
 
+			/**
+			 * \brief	Interpolate a block of values
+			 *
+			 * Only as many values as fit into \p output are interpolated.
+			 */
+			void
+			interpolate(std::span<const InputType> values, std::span<OutputType> output) const;
+
 		private:
 			const Accessor<T> supportingPoints;
 			const uint8_t numberOfPoints;
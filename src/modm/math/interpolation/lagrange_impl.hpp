@@ -34,17 +34,32 @@ modm::interpolation::Lagrange<T, Accessor>::interpolate(const InputType& value)
 	OutputType ret = 0;
 	for (uint8_t i = 0; i < this->numberOfPoints; ++i)
 	{
-		OutputType li = 1;
+		const T point(this->supportingPoints[i]);
+		// Numerator and denominator of the basis polynomial, divided only once
+		OutputType numerator = 1;
+		OutputType denominator = 1;
 		for (uint8_t j = 0; j < this->numberOfPoints; ++j)
 		{
 			if (i != j) {
-				li *= static_cast<OutputType>(value - this->supportingPoints[j].getFirst()) /
-					  static_cast<OutputType>(this->supportingPoints[i].getFirst() -
-							  this->supportingPoints[j].getFirst());
+				const InputType xj = this->supportingPoints[j].getFirst();
+				numerator *= static_cast<OutputType>(value - xj);
+				denominator *= static_cast<OutputType>(point.getFirst() - xj);
 			}
 		}
-		ret += li * this->supportingPoints[i].getSecond();
+		ret += numerator / denominator * point.getSecond();
 	}
 
 	return ret;
 }
+
+template <typename T,
+		  template <typename> class Accessor>
+void
+modm::interpolation::Lagrange<T, Accessor>::interpolate(
+		std::span<const InputType> values, std::span<OutputType> output) const
+{
+	const std::size_t size = std::min(values.size(), output.size());
+	for (std::size_t i = 0; i < size; ++i) {
+		output[i] = interpolate(values[i]);
+	}
+}
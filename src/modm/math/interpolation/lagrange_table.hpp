@@ -0,0 +1,132 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#include <modm/container/pair.hpp>
+#include <modm/math/utils/simd.hpp>
+
+namespace modm::interpolation
+{
+
+/**
+ * Lagrange interpolation over a constant table of supporting points
+ *
+ * The constructor converts the interpolation polynomial into the Newton form
+ * by computing the divided differences of the supporting points. Every
+ * interpolation is then evaluated with N-1 multiply-adds and no division,
+ * instead of the O(N^2) multiplications and divisions of Lagrange. The
+ * constructor is `constexpr`, so a table of constant supporting points is
+ * built at compile time.
+ *
+ * Blocks of values are evaluated with vector registers if the target has SIMD
+ * instructions for the output type.
+ *
+ * @code
+ * using Point = modm::Pair<float, float>;
+ * // interpolate x^2 over the range of 1 <= x <= 3
+ * constexpr Point points[] = { {1, 1}, {2, 4}, {3, 9} };
+ * constexpr modm::interpolation::LagrangeTable table(points);
+ *
+ * float output = table.interpolate(1.5f);
+ * // output => 2.25;
+ * @endcode
+ *
+ * @tparam	T	Any specialization of modm::Pair<> with a floating point type
+ * 				as second template argument.
+ * @tparam	N	Number of supporting points
+ *
+ * @ingroup	modm_math_interpolation
+ */
+template< typename T, std::size_t N >
+class LagrangeTable
+{
+public:
+	using InputType = typename T::FirstType;
+	using OutputType = typename T::SecondType;
+
+	static_assert(N >= 1);
+	static_assert(std::is_floating_point_v<OutputType>,
+			"Only floating point types are allowed as second type of modm::Pair");
+
+public:
+	constexpr LagrangeTable(const T (&supportingPoints)[N])
+	{
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			nodes[i] = OutputType(supportingPoints[i].getFirst());
+			coefficients[i] = supportingPoints[i].getSecond();
+		}
+		// Divided differences, in place from the highest order downwards
+		for (std::size_t j = 1; j < N; ++j)
+		{
+			for (std::size_t i = N - 1; i >= j; --i) {
+				coefficients[i] = (coefficients[i] - coefficients[i - 1]) / (nodes[i] - nodes[i - j]);
+			}
+		}
+	}
+
+	/**
+	 * \brief	Perform a Lagrange-interpolation
+	 *
+	 * \param 	value	input value
+	 * \return	interpolated value
+	 */
+	constexpr OutputType
+	interpolate(const InputType& value) const
+	{
+		const OutputType x = OutputType(value);
+		OutputType result = coefficients[N - 1];
+		for (std::size_t i = N - 1; i-- > 0; ) {
+			result = result * (x - nodes[i]) + coefficients[i];
+		}
+		return result;
+	}
+
+	/**
+	 * \brief	Interpolate a block of values
+	 *
+	 * Only as many values as fit into \p results are interpolated.
+	 */
+	void
+	interpolate(std::span<const InputType> values, std::span<OutputType> results) const
+	{
+		const std::size_t size = std::min(values.size(), results.size());
+		std::size_t n = 0;
+		if constexpr (std::is_same_v<InputType, OutputType> and
+					  modm::detail::simd::Lanes<OutputType> > 1)
+		{
+			constexpr std::size_t L = modm::detail::simd::Lanes<OutputType>;
+			using S = modm::detail::simd::Simd<OutputType, L>;
+			for (; n < size - size % L; n += L)
+			{
+				const typename S::Vector x = S::load(values.data() + n);
+				typename S::Vector result = typename S::Vector{} + coefficients[N - 1];
+				for (std::size_t i = N - 1; i-- > 0; ) {
+					result = result * (x - nodes[i]) + coefficients[i];
+				}
+				S::store(results.data() + n, result);
+			}
+		}
+		for (; n < size; ++n) {
+			results[n] = interpolate(values[n]);
+		}
+	}
+
+private:
+	OutputType nodes[N]{};
+	OutputType coefficients[N]{};
+};
+
+}	// namespace modm::interpolation
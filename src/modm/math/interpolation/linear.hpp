@@ -15,6 +15,8 @@
 #define	MODM_INTERPOLATION_LINEAR_HPP
 
 #include <stdint.h>
+#include <algorithm>
+#include <span>
 
 #include <modm/math/utils/arithmetic_traits.hpp>
 #include <modm/container/pair.hpp>
@@ -25,6 +27,13 @@ namespace modm
 	namespace interpolation
 	{
 		/**
+		 * Linear interpolation between supporting points sorted by their
+		 * input value.
+		 *
+		 * The segment is found by binary search over the supporting points.
+		 * For constant tables see LinearTable, which also precomputes the
+		 * slopes of all segments.
+		 *
 		 * \tparam	T			Any specialization of modm::Pair<>
 		 * \tparam	Accessor	Accessor class. Can be modm::accessor::Ram,
 		 * 						modm::accessor::Flash or any self defined
@@ -63,6 +72,14 @@ namespace modm
 			OutputType
 			interpolate(const InputType& value) const;
 
+			/**
+			 * \brief	Interpolate a block of values
+			 *
+			 * Only as many values as fit into \p output are interpolated.
+			 */
+			void
+			interpolate(std::span<const InputType> values, std::span<OutputType> output) const;
+
 		private:
 			const Accessor<T> supportingPoints;
 			const uint8_t numberOfPoints;
@@ -30,36 +30,54 @@ template <typename T,
 typename modm::interpolation::Linear<T, Accessor>::OutputType
 modm::interpolation::Linear<T, Accessor>::interpolate(const InputType& value) const
 {
-	T current(this->supportingPoints[0]);
+	const T first(this->supportingPoints[0]);
+	if (value <= first.getFirst()) {
+		return first.getSecond();
+	}
 
-	if (value <= current.getFirst()) {
-		return current.getSecond();
+	const T last(this->supportingPoints[this->numberOfPoints - 1]);
+	if (!(value < last.getFirst())) {
+		return last.getSecond();
 	}
 
-	T last(current);
-	uint8_t i;
-	for (i = 1; i < this->numberOfPoints; ++i)
+	// Binary search for the first supporting point not below the value,
+	// the point at 'lower' is always below the value.
+	uint_fast8_t lower = 0;
+	uint_fast8_t count = this->numberOfPoints - 1;
+	while (count > 1)
 	{
-		current = this->supportingPoints[i];
+		const uint_fast8_t half = count / 2;
+		if (this->supportingPoints[lower + half].getFirst() < value) {
+			lower += half;
+		}
+		count -= half;
+	}
 
-		if (value <= current.getFirst())
-		{
-			InputType x1_in = last.getFirst();
-			InputType x2_in = current.getFirst();
+	const T previous(this->supportingPoints[lower]);
+	const T current(this->supportingPoints[lower + 1]);
 
-			OutputType x1_out = last.getSecond();
-			OutputType x2_out = current.getSecond();
+	InputType x1_in = previous.getFirst();
+	InputType x2_in = current.getFirst();
 
-			InputType a = value - x1_in;		// >0
-			WideType b = static_cast<OutputSignedType>(x2_out) -
-						 static_cast<OutputSignedType>(x1_out);
-			InputType c = x2_in - x1_in;		// >0
+	OutputType x1_out = previous.getSecond();
+	OutputType x2_out = current.getSecond();
 
-			return static_cast<OutputType>(((a * b) / c) + x1_out);
-		}
+	InputType a = value - x1_in;		// >0
+	WideType b = static_cast<OutputSignedType>(x2_out) -
+				 static_cast<OutputSignedType>(x1_out);
+	InputType c = x2_in - x1_in;		// >0
 
-		last = current;
-	}
+	return static_cast<OutputType>(((a * b) / c) + x1_out);
+}
 
-	return current.getSecond();
+template <typename T,
+		  template <typename> class Accessor>
+void
+modm::interpolation::Linear<T, Accessor>::interpolate(
+		std::span<const InputType> values, std::span<OutputType> output) const
+{
+	const std::size_t size = std::min(values.size(), output.size());
+	for (std::size_t i = 0; i < size; ++i) {
+		output[i] = interpolate(values[i]);
+	}
 }
@@ -0,0 +1,190 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <modm/container/pair.hpp>
+
+namespace modm::interpolation
+{
+
+/**
+ * Linear interpolation over a constant table of supporting points
+ *
+ * In contrast to Linear, the constructor copies the supporting points and
+ * precomputes the slopes of all segments. An interpolation then costs one
+ * multiplication instead of a division. The constructor is `constexpr`, so
+ * a table of constant supporting points is built at compile time.
+ *
+ * If the supporting points are equally spaced, the segment is computed from
+ * the input value in O(1), otherwise it is found by binary search.
+ *
+ * Floating-point outputs are equal to the ones of Linear up to rounding.
+ * Integer outputs are computed with 16.16 fixed-point slopes and are rounded
+ * to nearest instead of truncated, so they may differ from Linear by one.
+ *
+ * Two supporting points with the same input form a step. Exactly at the
+ * input of the step, the output of the second point is returned, whereas
+ * Linear returns the output of the first one.
+ *
+ * @code
+ * using Point = modm::Pair<uint16_t, float>;
+ * // ADC value to temperature of a thermistor
+ * constexpr Point points[] = { {0, 150.f}, {16000, 85.f}, {32000, 40.f}, {48000, 5.f}, {64000, -40.f} };
+ * constexpr modm::interpolation::LinearTable table(points);
+ *
+ * float temperature = table.interpolate(adcValue);
+ * @endcode
+ *
+ * @tparam	T	Any specialization of modm::Pair<> with sorted input values.
+ * 				Integer outputs are limited to 16 bit inputs and outputs.
+ * @tparam	N	Number of supporting points
+ *
+ * @ingroup	modm_math_interpolation
+ */
+template< typename T, std::size_t N >
+class LinearTable
+{
+public:
+	using InputType = typename T::FirstType;
+	using OutputType = typename T::SecondType;
+
+	static_assert(N >= 1);
+	static_assert(std::is_floating_point_v<OutputType> or
+				  (sizeof(InputType) <= 2 and sizeof(OutputType) <= 2),
+			"Integer outputs are only supported for inputs and outputs of up to 16 bit!");
+
+private:
+	static constexpr bool FloatingPoint = std::is_floating_point_v<OutputType>;
+	using SlopeType = std::conditional_t<FloatingPoint, OutputType, int64_t>;
+	static constexpr int SlopeShift = 16;
+	using IndexType = std::conditional_t<std::is_floating_point_v<InputType>, InputType, float>;
+
+public:
+	constexpr LinearTable(const T (&supportingPoints)[N])
+	{
+		for (std::size_t i = 0; i < N; ++i)
+		{
+			inputs[i] = supportingPoints[i].getFirst();
+			outputs[i] = supportingPoints[i].getSecond();
+		}
+		for (std::size_t i = 0; i + 1 < N; ++i)
+		{
+			// The segment of a step is never chosen by segment()
+			if (not (inputs[i] < inputs[i + 1])) { continue; }
+			if constexpr (FloatingPoint) {
+				slopes[i] = (outputs[i + 1] - outputs[i]) / OutputType(inputs[i + 1] - inputs[i]);
+			} else {
+				const int64_t rise = int64_t(outputs[i + 1]) - outputs[i];
+				const int64_t run = int64_t(inputs[i + 1]) - inputs[i];
+				slopes[i] = (rise * (int64_t(1) << SlopeShift) + (rise < 0 ? -run : run) / 2) / run;
+			}
+		}
+
+		uniform = N >= 2 and inputs[0] < inputs[1];
+		for (std::size_t i = 1; i + 1 < N and uniform; ++i) {
+			uniform = (inputs[i + 1] - inputs[i] == inputs[1] - inputs[0]);
+		}
+		if (uniform) {
+			inverseSpacing = IndexType(1) / IndexType(inputs[1] - inputs[0]);
+		}
+	}
+
+	/// True if the segment is computed in O(1) from equally spaced supporting points
+	constexpr bool
+	isUniform() const
+	{
+		return uniform;
+	}
+
+	/**
+	 * \brief	Perform a linear interpolation
+	 *
+	 * \param 	value	input value
+	 * \return	interpolated value, or the output of the first or last
+	 * 			supporting point outside of the table
+	 */
+	constexpr OutputType
+	interpolate(InputType value) const
+	{
+		if (value < inputs[0]) {
+			return outputs[0];
+		}
+		if (not (value < inputs[N - 1])) {
+			return outputs[N - 1];
+		}
+
+		const std::size_t i = segment(value);
+		const auto a = value - inputs[i];	// >= 0
+		if constexpr (FloatingPoint) {
+			return outputs[i] + OutputType(a) * slopes[i];
+		} else {
+			constexpr int64_t Round = int64_t(1) << (SlopeShift - 1);
+			return OutputType(outputs[i] + ((a * slopes[i] + Round) >> SlopeShift));
+		}
+	}
+
+	/**
+	 * \brief	Interpolate a block of values
+	 *
+	 * Only as many values as fit into \p results are interpolated.
+	 */
+	constexpr void
+	interpolate(std::span<const InputType> values, std::span<OutputType> results) const
+	{
+		const std::size_t size = std::min(values.size(), results.size());
+		for (std::size_t i = 0; i < size; ++i) {
+			results[i] = interpolate(values[i]);
+		}
+	}
+
+private:
+	// Index of the last supporting point not above the value, which must be
+	// within the table.
+	constexpr std::size_t
+	segment(InputType value) const
+	{
+		if (uniform)
+		{
+			std::size_t i = std::min(std::size_t(IndexType(value - inputs[0]) * inverseSpacing), N - 2);
+			// The rounded index may be off by one next to a supporting point
+			if (value < inputs[i]) {
+				--i;
+			} else if (not (value < inputs[i + 1])) {
+				++i;
+			}
+			return i;
+		}
+
+		// Branchless binary search, the point at 'base' is never above the value
+		const InputType* base = inputs;
+		std::size_t count = N - 1;
+		while (count > 1)
+		{
+			const std::size_t half = count / 2;
+			base = (base[half] <= value) ? base + half : base;
+			count -= half;
+		}
+		return base - inputs;
+	}
+
+	InputType inputs[N]{};
+	OutputType outputs[N]{};
+	SlopeType slopes[N > 1 ? N - 1 : 1]{};
+	IndexType inverseSpacing{};
+	bool uniform{false};
+};
+
+}	// namespace modm::interpolation
@@ -14,6 +14,8 @@
 #ifndef MODM_LU_DECOMPOSITION_HPP
 #define MODM_LU_DECOMPOSITION_HPP
 
+#include <algorithm>
+
 #include "matrix.hpp"
 #include "geometry/vector.hpp"
 
@@ -60,12 +62,42 @@ namespace modm
 				Vector<int8_t, N> *p);
 
 
+		/**
+		 * \brief	Decompose a matrix in place with partial pivoting
+		 *
+		 * Overwrites the matrix with L on and below the diagonal and U above
+		 * the diagonal, the diagonal of U is all ones. No further matrices
+		 * are allocated.
+		 *
+		 * \param	lu	Matrix A, replaced by the combined L and U matrix
+		 * \param	p	Row permutation, so that row i of P*A is row p[i] of A
+		 * \return	\c false if the matrix is singular
+		 */
+		template <typename T, uint8_t N>
+		static bool
+		decompose(Matrix<T, N, N> *lu,
+				Vector<int8_t, N> *p);
+
+
 		template <typename T, uint8_t N, uint8_t BXWIDTH>
 		static bool
 		solve(const Matrix<T, N, N> &l,
 				const Matrix<T, N, N> &u,
 				Matrix<T, N, BXWIDTH> *xb);
 
+		/**
+		 * \brief	Solve A*x = b with an in place decomposition of A
+		 *
+		 * \param	lu	Combined L and U matrix from decompose(lu, p)
+		 * \param	p	Row permutation from decompose(lu, p)
+		 * \param	xb	Right hand side b, replaced by the solution x
+		 */
+		template <typename T, uint8_t N, uint8_t BXWIDTH>
+		static bool
+		solve(const Matrix<T, N, N> &lu,
+				const Vector<int8_t, N> &p,
+				Matrix<T, N, BXWIDTH> *xb);
+
 		template <typename T, uint8_t N, uint8_t BXWIDTH>
 		static bool
 		solve(const Matrix<T, N, N> &A,
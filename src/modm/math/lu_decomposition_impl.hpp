@@ -64,6 +64,110 @@ modm::LUDecomposition::decompose(
 	return true;
 }
 
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE>
+bool
+modm::LUDecomposition::decompose(
+		modm::Matrix<T, SIZE, SIZE> *lu,
+		modm::Vector<int8_t, SIZE> *p)
+{
+	T *a = lu->ptr();
+	for (uint_fast8_t i = 0; i < SIZE; ++i)	{
+		(*p)[i] = i;
+	}
+
+	for (uint_fast8_t k = 0; k < SIZE; ++k)
+	{
+		// swap with a lower row so that we have the highest value factor
+		T max = std::abs(a[k*SIZE + k]);
+		uint_fast8_t maxRow = k;
+		for (uint_fast8_t j = k+1; j < SIZE; ++j)
+		{
+			T v = std::abs(a[j*SIZE + k]);
+			if (v > max)
+			{
+				max = v;
+				maxRow = j;
+			}
+		}
+		if (max == T(0)) {
+			return false;
+		}
+		if (maxRow != k)
+		{
+			std::swap((*p)[k], (*p)[maxRow]);
+			std::swap_ranges(&a[k*SIZE], &a[(k+1)*SIZE], &a[maxRow*SIZE]);
+		}
+
+		// normalize the row of U, the pivot remains as diagonal of L
+		T *rowK = &a[k*SIZE];
+		const T factor = T(1.0) / rowK[k];
+		for (uint_fast8_t c = k+1; c < SIZE; ++c) {
+			rowK[c] = rowK[c] * factor;
+		}
+
+		// eliminate the column below the pivot, which remains as column of L
+		for (uint_fast8_t j = k+1; j < SIZE; ++j)
+		{
+			T *rowJ = &a[j*SIZE];
+			const T f = -rowJ[k];
+			for (uint_fast8_t c = k+1; c < SIZE; ++c) {
+				rowJ[c] = rowJ[c] + rowK[c] * f;
+			}
+		}
+	}
+
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t SIZE, uint8_t BXWIDTH>
+bool
+modm::LUDecomposition::solve(
+		const modm::Matrix<T, SIZE, SIZE> &lu,
+		const modm::Vector<int8_t, SIZE> &p,
+		modm::Matrix<T, SIZE, BXWIDTH> *xb)
+{
+	const modm::Matrix<T, SIZE, BXWIDTH> b(*xb);
+	for (uint_fast8_t i = 0; i < SIZE; ++i) {
+		std::copy_n(b[p[i]], BXWIDTH, (*xb)[i]);
+	}
+
+	// solve L*y = P*b by forward substitution
+	for (uint_fast8_t k = 0; k < SIZE; ++k)
+	{
+		T *rowK = (*xb)[k];
+		const T factor = 1.0 / lu[k][k];
+		for (uint_fast8_t c = 0; c < BXWIDTH; ++c) {
+			rowK[c] = rowK[c] * factor;
+		}
+		for (uint_fast8_t j = k+1; j < SIZE; ++j)
+		{
+			T *rowJ = (*xb)[j];
+			const T f = -lu[j][k];
+			for (uint_fast8_t c = 0; c < BXWIDTH; ++c) {
+				rowJ[c] = rowJ[c] + rowK[c] * f;
+			}
+		}
+	}
+
+	// solve U*x = y by backward substitution, the diagonal of U is one
+	for (uint_fast8_t k = SIZE-1; k > 0; --k)
+	{
+		const T *rowK = (*xb)[k];
+		for (uint_fast8_t j = 0; j < k; ++j)
+		{
+			T *rowJ = (*xb)[j];
+			const T f = -lu[j][k];
+			for (uint_fast8_t c = 0; c < BXWIDTH; ++c) {
+				rowJ[c] = rowJ[c] + rowK[c] * f;
+			}
+		}
+	}
+
+	return true;
+}
+
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t SIZE, uint8_t BXWIDTH>
 bool
@@ -82,16 +186,12 @@ modm::LUDecomposition::solve(
 		const modm::Matrix<T, SIZE, SIZE> &A,
 		modm::Matrix<T, SIZE, BXWIDTH> *xb)
 {
-	modm::Matrix<T, SIZE, SIZE> l;
-	modm::Matrix<T, SIZE, SIZE> u;
-	modm::Matrix<T, SIZE, SIZE> p;
-	if(not(decompose(A, &l, &u, &p))){
+	modm::Matrix<T, SIZE, SIZE> lu(A);
+	modm::Vector<int8_t, SIZE> p;
+	if (not decompose(&lu, &p)) {
 		return false;
 	}
-	*xb = (p * (*xb));
-	if(not(solve(l, u, xb))){
-		return false;}
-	return true;
+	return solve(lu, p, xb);
 }
 
 //=============================================================================
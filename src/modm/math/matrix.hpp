@@ -21,6 +21,8 @@
 #include <modm/io/iostream.hpp>
 #include <modm/math/matrix.hpp>
 
+#include "matrix_kernel.hpp"
+
 namespace modm
 {
 	/// @ingroup	modm_math_matrix
@@ -160,6 +162,40 @@ namespace modm
 		Matrix<T, ROWS, RHSCOL>
 		operator * (const Matrix<T, COLUMNS, RHSCOL> &rhs) const;
 
+		/**
+		 * \brief	Fused multiply-add: (*this) * rhs + add
+		 *
+		 * Adds \p add while storing the product instead of creating a
+		 * temporary product matrix.
+		 */
+		template<uint8_t RHSCOL>
+		Matrix<T, ROWS, RHSCOL>
+		multiplyAdd(const Matrix<T, COLUMNS, RHSCOL> &rhs,
+				const Matrix<T, ROWS, RHSCOL> &add) const;
+
+		/**
+		 * \brief	Multiplication with a transposed matrix: (*this) * rhs^T
+		 *
+		 * Reads \p rhs along its rows instead of creating the transposed
+		 * matrix first.
+		 */
+		template<uint8_t RHSROW>
+		Matrix<T, ROWS, RHSROW>
+		multiplyTransposed(const Matrix<T, RHSROW, COLUMNS> &rhs) const;
+
+		/**
+		 * \brief	Fused multiply-add with a transposed matrix: (*this) * rhs^T + add
+		 *
+		 * Example for the covariance prediction of a Kalman filter:
+		 * \code
+		 * P = (F * P).multiplyTransposedAdd(F, Q);
+		 * \endcode
+		 */
+		template<uint8_t RHSROW>
+		Matrix<T, ROWS, RHSROW>
+		multiplyTransposedAdd(const Matrix<T, RHSROW, COLUMNS> &rhs,
+				const Matrix<T, ROWS, RHSROW> &add) const;
+
 		Matrix<T, COLUMNS, ROWS>
 		asTransposed() const;
 
@@ -228,7 +264,7 @@ namespace modm
 		getSize() const;
 
 		/// Number of elements in the Matrix (rows * columns)
-		inline uint8_t
+		inline uint16_t
 		getNumberOfElements() const;
 	};
 
@@ -19,7 +19,7 @@
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 modm::Matrix<T, ROWS, COLUMNS>::Matrix(const T *data)
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		element[i] = data[i];
 	}
 }
@@ -163,7 +163,7 @@ modm::Matrix<T, ROWS, COLUMNS>
 modm::Matrix<T, ROWS, COLUMNS>::operator - ()
 {
 	modm::Matrix<T, ROWS, COLUMNS> m;
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		m.element[i] = -this->element[i];
 	}
 
@@ -177,7 +177,7 @@ modm::Matrix<T, ROWS, COLUMNS>::operator - (const modm::Matrix<T, ROWS, COLUMNS>
 {
 	modm::Matrix<T, ROWS, COLUMNS> m;
 
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		m.element[i] = element[i] - rhs.element[i];
 	}
 
@@ -191,7 +191,7 @@ modm::Matrix<T, ROWS, COLUMNS>::operator + (const modm::Matrix<T, ROWS, COLUMNS>
 {
 	modm::Matrix<T, ROWS, COLUMNS> m;
 
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		m.element[i] = element[i] + rhs.element[i];
 	}
 
@@ -203,7 +203,7 @@ template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 modm::Matrix<T, ROWS, COLUMNS>&
 modm::Matrix<T, ROWS, COLUMNS>::operator += (const modm::Matrix<T, ROWS, COLUMNS> &rhs)
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		element[i] += rhs.element[i];
 	}
 
@@ -215,7 +215,7 @@ template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 modm::Matrix<T, ROWS, COLUMNS>&
 modm::Matrix<T, ROWS, COLUMNS>::operator -= (const modm::Matrix<T, ROWS, COLUMNS> &rhs)
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		element[i] -= rhs.element[i];
 	}
 
@@ -229,18 +229,46 @@ modm::Matrix<T, ROWS, RHSCOL>
 modm::Matrix<T, ROWS, COLUMNS>::operator * (const Matrix<T, COLUMNS, RHSCOL> &rhs) const
 {
 	modm::Matrix<T, ROWS, RHSCOL> m;
+	modm::detail::matrix::multiply<T, ROWS, COLUMNS, RHSCOL, false>(
+			element, rhs.element, m.element, m.element);
+	return m;
+}
 
-	for (uint_fast8_t i = 0; i < ROWS; ++i)
-	{
-		for (uint_fast8_t j = 0; j < RHSCOL; ++j)
-		{
-			m[i][j] = element[i * COLUMNS] * rhs[0][j];
-			for (uint_fast8_t x = 1; x < COLUMNS; ++x)
-			{
-				m[i][j] += element[i * COLUMNS + x] * rhs[x][j];
-			}
-		}
-	}
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template<uint8_t RHSCOL>
+modm::Matrix<T, ROWS, RHSCOL>
+modm::Matrix<T, ROWS, COLUMNS>::multiplyAdd(const Matrix<T, COLUMNS, RHSCOL> &rhs,
+		const Matrix<T, ROWS, RHSCOL> &add) const
+{
+	modm::Matrix<T, ROWS, RHSCOL> m;
+	modm::detail::matrix::multiply<T, ROWS, COLUMNS, RHSCOL, true>(
+			element, rhs.element, add.element, m.element);
+	return m;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template<uint8_t RHSROW>
+modm::Matrix<T, ROWS, RHSROW>
+modm::Matrix<T, ROWS, COLUMNS>::multiplyTransposed(const Matrix<T, RHSROW, COLUMNS> &rhs) const
+{
+	modm::Matrix<T, ROWS, RHSROW> m;
+	modm::detail::matrix::multiplyTransposed<T, ROWS, COLUMNS, RHSROW, false>(
+			element, rhs.element, m.element, m.element);
+	return m;
+}
+
+// ----------------------------------------------------------------------------
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+template<uint8_t RHSROW>
+modm::Matrix<T, ROWS, RHSROW>
+modm::Matrix<T, ROWS, COLUMNS>::multiplyTransposedAdd(const Matrix<T, RHSROW, COLUMNS> &rhs,
+		const Matrix<T, ROWS, RHSROW> &add) const
+{
+	modm::Matrix<T, ROWS, RHSROW> m;
+	modm::detail::matrix::multiplyTransposed<T, ROWS, COLUMNS, RHSROW, true>(
+			element, rhs.element, add.element, m.element);
 	return m;
 }
 
@@ -259,7 +287,7 @@ modm::Matrix<T, ROWS, COLUMNS>
 modm::Matrix<T, ROWS, COLUMNS>::operator * (const T &rhs) const
 {
 	modm::Matrix<T, ROWS, COLUMNS> m;
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		m.element[i] = element[i] * rhs;
 	}
 
@@ -271,7 +299,7 @@ template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 modm::Matrix<T, ROWS, COLUMNS>&
 modm::Matrix<T, ROWS, COLUMNS>::operator *= (const T &rhs)
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		element[i] *= rhs;
 	}
 
@@ -287,7 +315,7 @@ modm::Matrix<T, ROWS, COLUMNS>::operator / (const T &rhs) const
 
 	float oneOverRhs = 1.0f / rhs;
 
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		m.element[i] = element[i] * oneOverRhs;
 	}
 
@@ -301,7 +329,7 @@ modm::Matrix<T, ROWS, COLUMNS>::operator /= (const T &rhs)
 {
 	float oneOverRhs = 1.0f / rhs;
 
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		element[i] *= oneOverRhs;
 	}
 
@@ -349,7 +377,7 @@ template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 bool
 modm::Matrix<T, ROWS, COLUMNS>::hasNan() const
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		if (isnan(element[i])) {
 			return true;
 		}
@@ -363,7 +391,7 @@ template<typename T, uint8_t ROWS, uint8_t COLUMNS>
 bool
 modm::Matrix<T, ROWS, COLUMNS>::hasInf() const
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		if (isinf(element[i])) {
 			return true;
 		}
@@ -416,7 +444,7 @@ modm::Matrix<T, ROWS, COLUMNS>::getSize() const
 
 // ----------------------------------------------------------------------------
 template<typename T, uint8_t ROWS, uint8_t COLUMNS>
-uint8_t
+uint16_t
 modm::Matrix<T, ROWS, COLUMNS>::getNumberOfElements() const
 {
 	return ROWS * COLUMNS;
@@ -446,7 +474,7 @@ template<typename T, uint8_t ROWS, uint8_t COLUMNS> template<typename U>
 modm::Matrix<T, ROWS, COLUMNS>&
 modm::Matrix<T, ROWS, COLUMNS>::replace(const U *data)
 {
-	for (uint_fast8_t i = 0; i < getNumberOfElements(); ++i) {
+	for (uint_fast16_t i = 0; i < getNumberOfElements(); ++i) {
 		element[i] = data[i];
 	}
 
@@ -0,0 +1,141 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <modm/math/utils/simd.hpp>
+
+/// @cond
+namespace modm::detail::matrix
+{
+
+using simd::Lanes;
+using simd::Simd;
+
+// Computes Count vectors of a row of the product, which stay in registers
+// while walking down the columns of b.
+template< typename T, std::size_t L, std::size_t Count, std::size_t INNER, std::size_t STRIDE, bool Add >
+inline void
+multiplyBlock(const T* rowA, const T* b, const T* c, T* out)
+{
+	using S = Simd<T, L>;
+	typename S::Vector acc[Count];
+	// The loops over the accumulators must be unrolled to keep them in registers
+#pragma GCC unroll 4
+	for (std::size_t v = 0; v < Count; ++v)
+		acc[v] = rowA[0] * S::load(b + v * L);
+	for (std::size_t x = 1; x < INNER; ++x)
+	{
+		const T factor = rowA[x];
+#pragma GCC unroll 4
+		for (std::size_t v = 0; v < Count; ++v)
+			acc[v] += factor * S::load(b + x * STRIDE + v * L);
+	}
+#pragma GCC unroll 4
+	for (std::size_t v = 0; v < Count; ++v)
+	{
+		if constexpr (Add)
+			acc[v] = S::load(c + v * L) + acc[v];
+		S::store(out + v * L, acc[v]);
+	}
+}
+
+// Computes WIDTH columns of a row of the product from b with STRIDE elements per row.
+template< typename T, std::size_t INNER, std::size_t STRIDE, std::size_t WIDTH, bool Add >
+inline void
+multiplyColumns(const T* rowA, const T* b, const T* c, T* out)
+{
+	constexpr std::size_t L = Lanes<T>;
+	// Up to four accumulators are kept in registers
+	constexpr std::size_t Block = L * 4;
+	constexpr std::size_t Blocks = WIDTH / Block;
+	constexpr std::size_t Vectors = (WIDTH % Block) / L;
+	constexpr std::size_t Scalars = WIDTH % L;
+
+	for (std::size_t j = 0; j < Blocks * Block; j += Block)
+		multiplyBlock<T, L, 4, INNER, STRIDE, Add>(rowA, b + j, c + j, out + j);
+	if constexpr (Vectors)
+	{
+		constexpr std::size_t j = Blocks * Block;
+		multiplyBlock<T, L, Vectors, INNER, STRIDE, Add>(rowA, b + j, c + j, out + j);
+	}
+	if constexpr (Scalars)
+	{
+		constexpr std::size_t j = WIDTH - Scalars;
+		multiplyBlock<T, 1, Scalars, INNER, STRIDE, Add>(rowA, b + j, c + j, out + j);
+	}
+}
+
+/**
+ * out = a * b (+ c)
+ *
+ * Every element is accumulated in the same order as the naive triple loop, the
+ * vector lanes compute neighbouring columns of the same row. `c` may alias
+ * `out`, but `a` and `b` must not.
+ */
+template< typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLUMNS, bool Add >
+inline void
+multiply(const T* a, const T* b, const T* c, T* out)
+{
+	for (std::size_t i = 0; i < ROWS; ++i)
+	{
+		multiplyColumns<T, INNER, COLUMNS, COLUMNS, Add>(
+				a + i * INNER, b, c + i * COLUMNS, out + i * COLUMNS);
+	}
+}
+
+// Computes WIDTH columns of the product a * b^T. The rows of b are packed
+// into a transposed panel first, which is then multiplied like a * b.
+template< typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLUMNS, std::size_t WIDTH, bool Add >
+inline void
+multiplyTransposedPanel(const T* a, const T* b, const T* c, T* out)
+{
+	T panel[INNER * WIDTH];
+	for (std::size_t k = 0; k < WIDTH; ++k) {
+		for (std::size_t x = 0; x < INNER; ++x) {
+			panel[x * WIDTH + k] = b[k * INNER + x];
+		}
+	}
+	for (std::size_t i = 0; i < ROWS; ++i)
+	{
+		multiplyColumns<T, INNER, WIDTH, WIDTH, Add>(
+				a + i * INNER, panel, c + i * COLUMNS, out + i * COLUMNS);
+	}
+}
+
+/**
+ * out = a * b^T (+ c)
+ *
+ * Instead of the whole transposed matrix, only a panel of up to four vectors
+ * of columns is transposed at a time. The elements are accumulated in the same
+ * order as for a * b. `c` may alias `out`, but `a` and `b` must not.
+ */
+template< typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLUMNS, bool Add >
+inline void
+multiplyTransposed(const T* a, const T* b, const T* c, T* out)
+{
+	constexpr std::size_t Block = Lanes<T> * 4;
+	constexpr std::size_t Remainder = COLUMNS % Block;
+
+	for (std::size_t j = 0; j < COLUMNS - Remainder; j += Block)
+	{
+		multiplyTransposedPanel<T, ROWS, INNER, COLUMNS, Block, Add>(
+				a, b + j * INNER, c + j, out + j);
+	}
+	if constexpr (Remainder)
+	{
+		constexpr std::size_t j = COLUMNS - Remainder;
+		multiplyTransposedPanel<T, ROWS, INNER, COLUMNS, Remainder, Add>(
+				a, b + j * INNER, c + j, out + j);
+	}
+}
+
+}	// namespace modm::detail::matrix
+/// @endcond
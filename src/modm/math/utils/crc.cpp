@@ -0,0 +1,123 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "crc.hpp"
+#include <string.h>
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#elif defined(__x86_64__)
+#include <immintrin.h>
+
+namespace
+{
+
+inline __m128i
+load(const uint8_t *ptr)
+{
+	return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+}
+
+__attribute__((target("pclmul,sse4.1")))
+inline __m128i
+fold(__m128i x, __m128i k, __m128i y)
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), y),
+						 _mm_clmulepi64_si128(x, k, 0x00));
+}
+
+/// Folds 16 byte blocks with carry-less multiplication and reduces the result
+/// with a Barrett reduction, as described by Intel in "Fast CRC Computation for
+/// Generic Polynomials Using PCLMULQDQ Instruction".
+/// @pre length >= 64 and a multiple of 16.
+__attribute__((target("pclmul,sse4.1")))
+uint32_t
+crc32_pclmul(uint32_t crc, const uint8_t *data, size_t length)
+{
+	// Bit-reflected constants for the CRC32 polynomial
+	alignas(16) static constexpr uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+	alignas(16) static constexpr uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+	alignas(16) static constexpr uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+	alignas(16) static constexpr uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+	__m128i x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(crc));
+	__m128i x2 = load(data + 16);
+	__m128i x3 = load(data + 32);
+	__m128i x4 = load(data + 48);
+	data += 64;
+	length -= 64;
+
+	// Fold four blocks in parallel
+	__m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+	for (; length >= 64; data += 64, length -= 64)
+	{
+		x1 = fold(x1, k, load(data));
+		x2 = fold(x2, k, load(data + 16));
+		x3 = fold(x3, k, load(data + 32));
+		x4 = fold(x4, k, load(data + 48));
+	}
+
+	// Fold into a single block
+	k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+	x1 = fold(x1, k, x2);
+	x1 = fold(x1, k, x3);
+	x1 = fold(x1, k, x4);
+	for (; length >= 16; data += 16, length -= 16)
+		x1 = fold(x1, k, load(data));
+
+	// Fold 128 bits to 64 bits
+	const __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+	x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x00), x2);
+
+	// Barrett reduction to 32 bits
+	k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), k, 0x10);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), k, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return _mm_extract_epi32(x1, 1);
+}
+
+} // anonymous namespace
+#endif
+
+uint32_t
+modm::math::detail::crc32_hardware(uint32_t crc, const uint8_t *data, size_t length)
+{
+#if defined(__ARM_FEATURE_CRC32)
+	for (; length >= 8; length -= 8, data += 8)
+	{
+		uint64_t value;
+		memcpy(&value, data, 8);
+		crc = __crc32d(crc, value);
+	}
+	while (length--) crc = __crc32b(crc, *data++);
+	return crc;
+#else
+#	if defined(__x86_64__)
+	static const bool has_pclmul = []
+	{
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("pclmul") and __builtin_cpu_supports("sse4.1");
+	}();
+	if (has_pclmul and length >= 64)
+	{
+		const size_t blocks = length & ~size_t(15);
+		crc = crc32_pclmul(crc, data, blocks);
+		data += blocks;
+		length -= blocks;
+	}
+#	endif
+	return crc_table<uint32_t, crc32_bitwise, 8>(crc, data, length);
+#endif
+}
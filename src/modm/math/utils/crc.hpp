@@ -13,6 +13,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <array>
 #ifdef __AVR__
 #include <util/crc16.h>
 #endif
@@ -22,12 +23,34 @@ namespace modm::math
 /// @ingroup modm_math_utils
 /// @{
 
-inline uint8_t
-crc8_ccitt_update(uint8_t crc, uint8_t data)
+/**
+ * Strategy for computing a CRC over a buffer.
+ *
+ * The policy is selected per call site, so that code size can be traded for
+ * throughput only where it matters.
+ */
+enum class
+CrcPolicy : uint8_t
+{
+    /// Bit by bit without tables. Smallest code size.
+    /// This is the only policy used on AVR, since tables are placed in RAM.
+    Bitwise,
+    /// One lookup per byte in a 256 entry table.
+    Table,
+    /// Eight lookups per 8 bytes in eight 256 entry tables.
+    Slice8,
+    /// CRC32 instructions (ARMv8 CRC32, x86 PCLMUL) if available,
+    /// otherwise the same as Slice8.
+    Hardware,
+};
+
+/// @cond
+namespace detail
+{
+
+constexpr uint8_t
+crc8_ccitt_bitwise(uint8_t crc, uint8_t data)
 {
-#ifdef __AVR__
-    return _crc8_ccitt_update(crc, data);
-#else
     data ^= crc;
     for (uint8_t ii = 0; ii < 8; ii++)
     {
@@ -35,6 +58,93 @@ crc8_ccitt_update(uint8_t crc, uint8_t data)
         if (data & 0x80) data ^= 0x07;
     }
     return data;
+}
+
+constexpr uint16_t
+crc16_ccitt_bitwise(uint16_t crc, uint8_t data)
+{
+    data ^= uint8_t(crc); data ^= data << 4;
+    return (((uint16_t(data) << 8) | uint8_t(crc >> 8)) ^
+            uint8_t(data >> 4) ^ (uint16_t(data) << 3));
+}
+
+constexpr uint32_t
+crc32_bitwise(uint32_t crc, uint8_t data)
+{
+    constexpr uint32_t polynomial{0xEDB88320};
+    crc ^= data;
+    for (uint_fast8_t ii = 0; ii < 8; ii++)
+        crc = (crc >> 1) ^ (-int32_t(crc & 1) & polynomial);
+    return crc;
+}
+
+/// Lookup tables generated at compile time from the bitwise update function.
+/// Table k contains the CRC of a byte followed by k zero bytes.
+template< typename T, T(*Update)(T, uint8_t), size_t Slices >
+struct CrcTables
+{
+    static constexpr std::array<std::array<T, 256>, Slices> tables = []
+    {
+        std::array<std::array<T, 256>, Slices> tables{};
+        for (size_t ii = 0; ii < 256; ii++)
+        {
+            tables[0][ii] = Update(0, ii);
+            for (size_t ss = 1; ss < Slices; ss++)
+                tables[ss][ii] = Update(tables[ss - 1][ii], 0);
+        }
+        return tables;
+    }();
+};
+
+/// Works for all reflected CRCs and all CRCs that are 8 bit wide.
+template< typename T, T(*Update)(T, uint8_t), size_t Slices >
+T
+crc_table(T crc, const uint8_t *data, size_t length)
+{
+    static constexpr const auto& t = CrcTables<T, Update, Slices>::tables;
+    if constexpr (Slices == 8)
+    {
+        for (; length >= 8; length -= 8, data += 8)
+        {
+            const uint32_t lo = (uint32_t(data[0]) | (uint32_t(data[1]) << 8) |
+                    (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24)) ^ crc;
+            const uint32_t hi = uint32_t(data[4]) | (uint32_t(data[5]) << 8) |
+                    (uint32_t(data[6]) << 16) | (uint32_t(data[7]) << 24);
+            crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^
+                  t[5][(lo >> 16) & 0xff] ^ t[4][lo >> 24] ^
+                  t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+                  t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+        }
+    }
+    while (length--) crc = T(crc >> 8) ^ t[0][uint8_t(crc ^ *data++)];
+    return crc;
+}
+
+template< CrcPolicy Policy >
+constexpr size_t crc_slices = (Policy == CrcPolicy::Table) ? 1 : 8;
+
+#ifdef __AVR__
+// Tables would be copied into RAM, so always compute bit by bit
+template< CrcPolicy Policy >
+constexpr bool crc_bitwise = true;
+#else
+template< CrcPolicy Policy >
+constexpr bool crc_bitwise = (Policy == CrcPolicy::Bitwise);
+#endif
+
+uint32_t
+crc32_hardware(uint32_t crc, const uint8_t *data, size_t length);
+
+} // namespace detail
+/// @endcond
+
+inline uint8_t
+crc8_ccitt_update(uint8_t crc, uint8_t data)
+{
+#ifdef __AVR__
+    return _crc8_ccitt_update(crc, data);
+#else
+    return detail::crc8_ccitt_bitwise(crc, data);
 #endif
 }
 
@@ -44,9 +154,7 @@ crc16_ccitt_update(uint16_t crc, uint8_t data)
 #ifdef __AVR__
     return _crc_ccitt_update(crc, data);
 #else
-    data ^= uint8_t(crc); data ^= data << 4;
-    return (((uint16_t(data) << 8) | uint8_t(crc >> 8)) ^
-            uint8_t(data >> 4) ^ (uint16_t(data) << 3));
+    return detail::crc16_ccitt_bitwise(crc, data);
 #endif
 }
 
@@ -54,42 +162,80 @@ crc16_ccitt_update(uint16_t crc, uint8_t data)
 inline uint32_t
 crc32_update(uint32_t crc, uint8_t data)
 {
-    static constexpr uint32_t polynomial{0xEDB88320};
-    crc ^= data;
-    for (uint_fast8_t ii = 0; ii < 8; ii++)
-        crc = (crc >> 1) ^ (-int32_t(crc & 1) & polynomial);
-    return crc;
+    return detail::crc32_bitwise(crc, data);
+}
+
+/// Updates the CRC with a buffer for computing the CRC over multiple buffers.
+template< CrcPolicy Policy = CrcPolicy::Bitwise >
+uint8_t
+crc8_ccitt_update(uint8_t crc, const uint8_t *data, size_t length)
+{
+    if constexpr (detail::crc_bitwise<Policy>)
+    {
+        while (length--) crc = crc8_ccitt_update(crc, *data++);
+        return crc;
+    }
+    else return detail::crc_table<uint8_t, detail::crc8_ccitt_bitwise,
+                                  detail::crc_slices<Policy>>(crc, data, length);
+}
+
+/// Updates the CRC with a buffer for computing the CRC over multiple buffers.
+template< CrcPolicy Policy = CrcPolicy::Bitwise >
+uint16_t
+crc16_ccitt_update(uint16_t crc, const uint8_t *data, size_t length)
+{
+    if constexpr (detail::crc_bitwise<Policy>)
+    {
+        while (length--) crc = crc16_ccitt_update(crc, *data++);
+        return crc;
+    }
+    else return detail::crc_table<uint16_t, detail::crc16_ccitt_bitwise,
+                                  detail::crc_slices<Policy>>(crc, data, length);
+}
+
+/// Updates the CRC with a buffer for computing the CRC over multiple buffers.
+/// @note The CRC must be inverted after the last update.
+template< CrcPolicy Policy = CrcPolicy::Bitwise >
+uint32_t
+crc32_update(uint32_t crc, const uint8_t *data, size_t length)
+{
+    if constexpr (detail::crc_bitwise<Policy>)
+    {
+        while (length--) crc = crc32_update(crc, *data++);
+        return crc;
+    }
+    else if constexpr (Policy == CrcPolicy::Hardware)
+        return detail::crc32_hardware(crc, data, length);
+    else return detail::crc_table<uint32_t, detail::crc32_bitwise,
+                                  detail::crc_slices<Policy>>(crc, data, length);
 }
 
 static constexpr uint8_t crc8_ccitt_init{0xFFu};
 static constexpr uint16_t crc16_ccitt_init{0xFFFFu};
 static constexpr uint32_t crc32_init{0xFFFFFFFFul};
 
-inline uint8_t
+template< CrcPolicy Policy = CrcPolicy::Bitwise >
+uint8_t
 crc8_ccitt(const uint8_t *data, size_t length)
 {
-    uint8_t crc{crc8_ccitt_init};
-    while (length--) crc = crc8_ccitt_update(crc, *data++);
-    return crc;
+    return crc8_ccitt_update<Policy>(crc8_ccitt_init, data, length);
 }
 
-inline uint16_t
+template< CrcPolicy Policy = CrcPolicy::Bitwise >
+uint16_t
 crc16_ccitt(const uint8_t *data, size_t length)
 {
-    uint16_t crc{crc16_ccitt_init};
-    while (length--) crc = crc16_ccitt_update(crc, *data++);
-    return crc;
+    return crc16_ccitt_update<Policy>(crc16_ccitt_init, data, length);
 }
 
-/// Slow, but table-less computation of CRC32.
-inline uint32_t
+/// Table-less computation of CRC32 by default.
+/// Use `CrcPolicy::Slice8` or `CrcPolicy::Hardware` for large buffers.
+template< CrcPolicy Policy = CrcPolicy::Bitwise >
+uint32_t
 crc32(const uint8_t *data, size_t length)
 {
-    uint32_t crc{crc32_init};
-    while (length--) crc = crc32_update(crc, *data++);
-    return ~crc;
+    return ~crc32_update<Policy>(crc32_init, data, length);
 }
 
 /// @}
 } // namespace modm::math
-
@@ -0,0 +1,70 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+/// @cond
+namespace modm::detail::simd
+{
+
+// Vector registers are only used if the target has native SIMD instructions
+// for the element type, otherwise the compiler would emulate them.
+template< typename T >
+inline constexpr std::size_t Lanes = 1;
+
+#if defined(__SSE__) || defined(__ARM_NEON) || (defined(__ARM_FEATURE_MVE) && (__ARM_FEATURE_MVE & 2))
+template<>
+inline constexpr std::size_t Lanes<float> = 4;
+#endif
+#if defined(__SSE2__) || defined(__aarch64__)
+template<>
+inline constexpr std::size_t Lanes<double> = 2;
+#endif
+
+// L neighbouring elements as one vector of the GCC vector extensions, which
+// are lowered to the instruction set of the target.
+template< typename T, std::size_t L = Lanes<T> >
+struct Simd
+{
+	typedef T Vector __attribute__((vector_size(L * sizeof(T))));
+
+	static inline Vector
+	load(const T* data)
+	{
+		Vector v;
+		std::memcpy(&v, data, sizeof(v));
+		return v;
+	}
+
+	static inline void
+	store(T* data, Vector v)
+	{
+		std::memcpy(data, &v, sizeof(v));
+	}
+};
+
+template< typename T >
+struct Simd<T, 1>
+{
+	using Vector = T;
+
+	static inline T
+	load(const T* data)
+	{ return *data; }
+
+	static inline void
+	store(T* data, T v)
+	{ *data = v; }
+};
+
+}	// namespace modm::detail::simd
+/// @endcond
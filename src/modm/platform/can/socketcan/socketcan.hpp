@@ -13,20 +13,37 @@
 #ifndef MODM_HOSTED_SOCKETCAN_HPP
 #define MODM_HOSTED_SOCKETCAN_HPP
 
+#include <chrono>
 #include <iostream>
+#include <span>
 
 #include <modm/architecture/interface/can.hpp>
 
+#include <sys/socket.h>
+#include <linux/can.h>
+
 namespace modm
 {
 
 namespace platform
 {
 
-/// @ingroup modm_platform_socketcan
+/**
+ * SocketCAN driver with batched receive and transmit.
+ *
+ * Received frames are read with a single `recvmmsg()` call into a ring of up to
+ * `BatchSize` frames, from which they are converted on demand, so that
+ * `isMessageAvailable()` and `getMessage()` only issue a syscall when the ring
+ * is empty. Multiple messages can be sent with a single `sendmmsg()` call.
+ *
+ * @ingroup modm_platform_socketcan
+ */
 class SocketCan : public ::modm::Can
 {
 public:
+	/// Maximum number of frames per receive and transmit syscall
+	static constexpr std::size_t BatchSize = 32;
+
 	SocketCan() = default;
 
 	~SocketCan();
@@ -43,17 +60,55 @@ public:
 	bool
 	getMessage(can::Message& message);
 
+	/// Reads up to `messages.size()` available messages.
+	/// @returns the number of messages read.
+	std::size_t
+	getMessages(std::span<can::Message> messages);
+
+	/// Suspends the calling fiber until a message is available.
+	/// Outside of a fiber, the calling thread is blocked instead.
+	/// @warning Spurious wakeups are possible, so you must read all available
+	///          messages until `getMessage()` returns false before waiting.
+	void
+	waitForMessage();
+
 	inline bool
 	isReadyToSend() { return true; }
 
 	BusState
 	getBusState();
 
+	/// Sends the message without blocking.
+	/// @returns false if the socket buffer is full or the send failed.
 	bool
 	sendMessage(const can::Message& message);
 
+	/// Sends the message and waits up to `timeout` for space in the socket
+	/// buffer. The calling fiber yields while waiting, outside of a fiber the
+	/// calling thread is blocked instead.
+	/// @returns false if the timeout elapsed or the send failed.
+	bool
+	sendMessage(const can::Message& message, std::chrono::milliseconds timeout);
+
+	/// Sends the messages with one syscall per `BatchSize` messages without
+	/// blocking.
+	/// @returns the number of messages sent, which is less than
+	///          `messages.size()` if the socket buffer is full.
+	std::size_t
+	sendMessages(std::span<const can::Message> messages);
+
 private:
+	/// Reads a batch of frames into the empty receive ring.
+	bool
+	receive();
+
 	int skt{-1};
+	// Receive ring, filled by recvmmsg
+	canfd_frame rxFrames[BatchSize];
+	iovec rxVectors[BatchSize];
+	mmsghdr rxHeaders[BatchSize];
+	std::size_t rxIndex{0};
+	std::size_t rxCount{0};
 };
 
 } // namespace platform
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "multicore.hpp"
+#include <atomic>
+#include <pthread.h>
+
+namespace
+{
+thread_local uint8_t cpuId{0};
+thread_local uint16_t lockDepth{0};
+constinit std::atomic_flag lock = ATOMIC_FLAG_INIT;
+}
+
+namespace modm::platform::multicore
+{
+
+uint32_t
+Core::cpuId()
+{
+	return ::cpuId;
+}
+
+std::thread
+Core::run(uint8_t core, void(*function)())
+{
+	std::thread thread([core, function]
+	{
+		::cpuId = core;
+		function();
+	});
+	if (const unsigned cpus = std::thread::hardware_concurrency(); cpus)
+	{
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(core % cpus, &set);
+		pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+	}
+	return thread;
+}
+
+CoreLock::CoreLock()
+{
+	if (lockDepth++) return;
+	while (lock.test_and_set(std::memory_order_acquire))
+		std::this_thread::yield();
+}
+
+CoreLock::~CoreLock()
+{
+	if (--lockDepth) return;
+	lock.clear(std::memory_order_release);
+}
+
+} // namespace modm::platform::multicore
@@ -17,6 +17,7 @@
 #include <string>
 #include <stdint.h>
 #include <ostream>
+#include <span>
 
 #include <modm/io/iodevice.hpp>
 
@@ -134,6 +135,13 @@ namespace modm
 			virtual bool
 			read(char& c);
 
+			/**
+			 * Read the bytes that are available, up to `data.size()`.
+			 *
+			 * @return number of bytes read
+			 */
+			virtual std::size_t
+			read(std::span<uint8_t> data);
 
 			/**
 			 * Read length bytes from device.
@@ -153,6 +161,10 @@ namespace modm
 			virtual void
 			write(const char* str);
 
+			/// Write a block of bytes with as few system calls as possible.
+			virtual void
+			write(std::span<const uint8_t> data);
+
 			/**
 			 * Write length bytes to device.
 			 */
@@ -165,6 +177,16 @@ namespace modm
 			std::size_t
 			bytesAvailable() const;
 
+			/**
+			 * Suspend the calling fiber until data is available.
+			 *
+			 * Outside of a fiber, the calling thread is blocked instead.
+			 * Spurious wakeups are possible, so read all available data
+			 * before waiting again.
+			 */
+			void
+			waitForData();
+
 			virtual void
 			flush();
 
@@ -31,6 +31,14 @@ modm::platform::SerialPort::write(char c)
 	this->io_service.post(boost::bind(&modm::platform::SerialPort::doWrite, this, c));
 }
 
+void
+modm::platform::SerialPort::write(std::span<const uint8_t> data)
+{
+	// Post the whole block at once instead of one handler per character
+	this->io_service.post(boost::bind(&modm::platform::SerialPort::doWriteBlock, this,
+			std::string(reinterpret_cast<const char*>(data.data()), data.size())));
+}
+
 
 void
 modm::platform::SerialPort::flush()
@@ -61,6 +69,19 @@ modm::platform::SerialPort::read(char& value)
 	}
 }
 
+std::size_t
+modm::platform::SerialPort::read(std::span<uint8_t> data)
+{
+	MutexGuard queueGuard( this->readMutex);
+	std::size_t count = 0;
+	for (; count < data.size() and not this->readBuffer.empty(); count++)
+	{
+		data[count] = this->readBuffer.front();
+		this->readBuffer.pop();
+	}
+	return count;
+}
+
 bool
 modm::platform::SerialPort::open(std::string deviceName, unsigned int baudRate)
 {
@@ -171,6 +192,22 @@ modm::platform::SerialPort::doWrite(const char c) {
 	}
 }
 
+void
+modm::platform::SerialPort::doWriteBlock(const std::string& data) {
+	if (!this->shutdown and !data.empty())
+	{
+		MutexGuard mutex(this->writeMutex);
+		bool idle = this->writeBuffer.empty();
+		for (const char c : data) {
+			this->writeBuffer.push(c);
+		}
+
+		if (idle) {
+			this->writeStart();
+		}
+	}
+}
+
 void
 modm::platform::SerialPort::writeStart(void)
 {
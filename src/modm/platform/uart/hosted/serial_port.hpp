@@ -45,16 +45,23 @@ namespace modm
 			~SerialPort();
 
 			using IODevice::write;
+			using IODevice::read;
 
 			virtual void
 			write(char c);
 
+			virtual void
+			write(std::span<const uint8_t> data);
+
 			virtual void
 			flush();
 
 			virtual bool
 			read(char& value);
 
+			virtual std::size_t
+			read(std::span<uint8_t> data);
+
 			virtual bool
 			open( std::string deviceName, unsigned int baudRate );
 
@@ -103,6 +110,9 @@ namespace modm
 	        void
 	        doWrite(const char c);
 
+	        void
+	        doWriteBlock(const std::string& data);
+
 	        void
 	        writeStart(void);
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <modm/architecture/interface/fiber.hpp>
+#include "wait_queue.hpp"
 #include <limits>
 
 namespace modm::fiber
@@ -32,6 +33,7 @@ class barrier
 	count_t expected;
 	count_t count;
 	count_t sequence{};
+	mutable WaitQueue waiters;
 
 public:
 	using arrival_token = count_t;
@@ -55,6 +57,7 @@ public:
 			count = expected;
 			sequence++;
 			completion();
+			waiters.notify_all();
 		}
 		return last_arrival;
 	}
@@ -62,7 +65,8 @@ public:
 	void
 	wait(arrival_token arrival) const
 	{
-		while (arrival == sequence) modm::this_fiber::yield();
+		while (arrival == sequence)
+			waiters.wait([this, arrival]{ return arrival != sequence; });
 	}
 
 	void
@@ -13,6 +13,7 @@
 
 #include <modm/architecture/interface/fiber.hpp>
 #include "stop_token.hpp"
+#include "wait_queue.hpp"
 #include <atomic>
 
 
@@ -37,6 +38,7 @@ class condition_variable_any
 	condition_variable_any& operator=(const condition_variable_any&) = delete;
 
 	std::atomic<uint16_t> sequence{};
+	WaitQueue waiters;
 
 	const auto inline wait_on_sequence()
 	{
@@ -51,6 +53,15 @@ public:
 	notify_one()
 	{
 		sequence.fetch_add(1, std::memory_order_release);
+		waiters.notify_one();
+	}
+
+	/// @note This function can be called from an interrupt.
+	void inline
+	notify_all()
+	{
+		sequence.fetch_add(1, std::memory_order_release);
+		waiters.notify_all();
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -65,8 +76,10 @@ public:
 	void
 	wait(Lock& lock)
 	{
+		// capture the sequence before unlocking to not miss a notification
+		auto condition = wait_on_sequence();
 		lock.unlock();
-		this_fiber::poll(wait_on_sequence());
+		waiters.wait(condition);
 		lock.lock();
 	}
 
@@ -27,5 +27,22 @@ get_id()
 	return 0;
 }
 
+namespace detail
+{
+
+void inline
+sleep(modm::chrono::milli_clock::time_point start, modm::chrono::milli_clock::duration duration)
+{
+	while((modm::chrono::milli_clock::now() - start) < duration) ;
+}
+
+void inline
+sleep(modm::chrono::micro_clock::time_point start, modm::chrono::micro_clock::duration duration)
+{
+	while((modm::chrono::micro_clock::now() - start) < duration) ;
+}
+
+} // namespace detail
+
 } // namespace modm::this_fiber
 /// @endcond
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "reactor.hpp"
+#include "wait_queue.hpp"
+#include <modm/architecture/interface/clock.hpp>
+#include <unordered_map>
+#include <thread>
+#include <cerrno>
+#include <climits>
+#include <poll.h>
+#include <sys/epoll.h>
+
+namespace
+{
+
+struct Entry
+{
+	modm::fiber::WaitQueue readers;
+	modm::fiber::WaitQueue writers;
+	// Readiness that was reported while no fiber was waiting
+	bool readable{false};
+	bool writable{false};
+	// epoll does not support regular files, which are always ready
+	bool unsupported{false};
+};
+
+int epfd{-1};
+// Node-based, so that the wait queues do not move
+std::unordered_map<int, Entry> entries;
+std::atomic<uint32_t> lastUpdate{0};
+
+/// @note must be called with the lock held
+Entry&
+entry(int fd)
+{
+	auto [it, inserted] = entries.try_emplace(fd);
+	if (inserted)
+	{
+		if (epfd < 0) epfd = epoll_create1(EPOLL_CLOEXEC);
+		epoll_event event{};
+		event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+		event.data.fd = fd;
+		if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &event) < 0)
+			it->second.unsupported = true;
+	}
+	return it->second;
+}
+
+/// @note must be called with the lock held
+void
+notify(modm::fiber::WaitQueue& queue, bool& ready)
+{
+	// Remember the readiness for the next waiter, since the event is
+	// edge-triggered and will not be reported again
+	if (queue.empty()) ready = true;
+	else queue.notify_all();
+}
+
+}	// namespace
+
+void
+modm::fiber::Reactor::wait(int fd, bool readable)
+{
+	if (modm::this_fiber::get_id() == modm::fiber::id(0))
+	{
+		// Not inside a fiber, so block the thread
+		pollfd pfd{fd, short(readable ? POLLIN : POLLOUT), 0};
+		::poll(&pfd, 1, -1);
+		return;
+	}
+	Entry* e;
+	{
+		modm::atomic::Lock _;
+		e = &entry(fd);
+	}
+	if (e->unsupported) return modm::this_fiber::yield();
+
+	waiting.fetch_add(1, std::memory_order_relaxed);
+	if (readable) e->readers.wait([e] { return std::exchange(e->readable, false); });
+	else e->writers.wait([e] { return std::exchange(e->writable, false); });
+	waiting.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void
+modm::fiber::Reactor::wait_readable(int fd)
+{
+	wait(fd, true);
+}
+
+void
+modm::fiber::Reactor::wait_writable(int fd)
+{
+	wait(fd, false);
+}
+
+void
+modm::fiber::Reactor::remove(int fd)
+{
+	modm::atomic::Lock _;
+	if (auto it = entries.find(fd); it != entries.end())
+	{
+		epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr);
+		it->second.readers.notify_all();
+		it->second.writers.notify_all();
+		entries.erase(it);
+	}
+}
+
+size_t
+modm::fiber::Reactor::poll(std::chrono::microseconds timeout)
+{
+	if (epfd < 0)
+	{
+		if (timeout.count()) std::this_thread::sleep_for(timeout);
+		return 0;
+	}
+	const bool forever = timeout == std::chrono::microseconds::max();
+	epoll_event events[32];
+	int count{-1};
+#if __GLIBC_PREREQ(2, 35)
+	const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+	const timespec ts{time_t(seconds.count()), long((timeout - seconds).count() * 1000)};
+	count = epoll_pwait2(epfd, events, 32, forever ? nullptr : &ts, nullptr);
+	if (count < 0 and errno == ENOSYS)
+#endif
+	{
+		// Round the timeout up to milliseconds
+		const auto ms = std::chrono::ceil<std::chrono::milliseconds>(timeout).count();
+		count = epoll_wait(epfd, events, 32, forever ? -1 : int(std::min<int64_t>(ms, INT_MAX)));
+	}
+	if (count <= 0) return 0;
+
+	for (int ii = 0; ii < count; ii++)
+	{
+		modm::atomic::Lock _;
+		const auto it = entries.find(events[ii].data.fd);
+		if (it == entries.end()) continue;
+		Entry& e = it->second;
+		const uint32_t flags = events[ii].events;
+		const bool error = flags & (EPOLLERR | EPOLLHUP | EPOLLRDHUP);
+		if (error or (flags & EPOLLIN)) notify(e.readers, e.readable);
+		if (error or (flags & EPOLLOUT)) notify(e.writers, e.writable);
+	}
+	return count;
+}
+
+void
+modm::fiber::Reactor::update()
+{
+	const uint32_t now = modm::chrono::micro_clock::now().time_since_epoch().count();
+	uint32_t last = lastUpdate.load(std::memory_order_relaxed);
+	if (now - last < 100) return;
+	if (not lastUpdate.compare_exchange_strong(last, now, std::memory_order_relaxed)) return;
+	poll(std::chrono::microseconds(0));
+}
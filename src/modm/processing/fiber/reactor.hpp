@@ -0,0 +1,94 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace modm::fiber
+{
+
+/**
+ * Linux epoll reactor for waiting on file descriptors.
+ *
+ * A fiber waiting for a file descriptor is parked in a wait queue until epoll
+ * reports its readiness. The scheduler polls the reactor without blocking at
+ * most every 100us while other fibers are running, and blocks in epoll when no
+ * fiber is runnable.
+ *
+ * File descriptors are registered edge-triggered on their first wait, so they
+ * must be in non-blocking mode and must be read or written until they return
+ * `EAGAIN` before waiting again. Outside of a fiber, waiting blocks the thread
+ * in `poll(2)` instead.
+ *
+ * @ingroup modm_processing_fiber
+ */
+class Reactor
+{
+	friend class Scheduler;
+	// Number of fibers waiting on a file descriptor
+	static inline constinit std::atomic<size_t> waiting{0};
+
+	/// Polls without blocking, but at most every 100us.
+	static void
+	update();
+
+	static void
+	wait(int fd, bool readable);
+
+public:
+	/// Suspends the current fiber until `fd` is readable or closed.
+	/// @warning Spurious wakeups are possible.
+	static void
+	wait_readable(int fd);
+
+	/// Suspends the current fiber until `fd` is writable or closed.
+	/// @warning Spurious wakeups are possible.
+	static void
+	wait_writable(int fd);
+
+	/// Removes `fd` from the reactor and wakes up all fibers waiting on it.
+	/// Must be called before closing the file descriptor.
+	static void
+	remove(int fd);
+
+	/// Waits up to `timeout` for file descriptors to become ready and wakes up
+	/// the fibers waiting on them. This is called by the default
+	/// `modm::fiber::idle()` implementation, so you must call it yourself when
+	/// overriding that function.
+	/// @returns the number of ready file descriptors.
+	static size_t
+	poll(std::chrono::microseconds timeout);
+};
+
+}	// namespace modm::fiber
+
+namespace modm::this_fiber
+{
+
+/// Suspends the current fiber until the file descriptor is readable.
+/// @see modm::fiber::Reactor
+/// @ingroup modm_processing_fiber
+inline void
+wait_readable(int fd)
+{
+	modm::fiber::Reactor::wait_readable(fd);
+}
+
+/// Suspends the current fiber until the file descriptor is writable.
+/// @see modm::fiber::Reactor
+/// @ingroup modm_processing_fiber
+inline void
+wait_writable(int fd)
+{
+	modm::fiber::Reactor::wait_writable(fd);
+}
+
+}	// namespace modm::this_fiber
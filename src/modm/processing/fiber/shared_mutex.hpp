@@ -12,6 +12,7 @@
 #pragma once
 
 #include <modm/architecture/interface/fiber.hpp>
+#include "wait_queue.hpp"
 #include <atomic>
 #include <shared_mutex>
 
@@ -31,6 +32,8 @@ class shared_mutex
 	static constexpr fiber::id NoOwner{fiber::id(-1)};
 	static constexpr fiber::id SharedOwner{fiber::id(-2)};
 	std::atomic<fiber::id> owner{NoOwner};
+	WaitQueue waiters;
+
 public:
 	constexpr shared_mutex() = default;
 
@@ -48,7 +51,8 @@ public:
 	void inline
 	lock()
 	{
-		while(not try_lock()) modm::this_fiber::yield();
+		while(not try_lock())
+			waiters.wait([this]{ return owner.load(std::memory_order_relaxed) == NoOwner; });
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -56,6 +60,8 @@ public:
 	unlock()
 	{
 		owner.store(NoOwner, std::memory_order_release);
+		// wake up all shared waiters at once
+		waiters.notify_all();
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -73,7 +79,8 @@ public:
 	void inline
 	lock_shared()
 	{
-		while(not try_lock_shared()) modm::this_fiber::yield();
+		while(not try_lock_shared())
+			waiters.wait([this]{ return owner.load(std::memory_order_relaxed) >= SharedOwner; });
 	}
 
 	/// @note This function can be called from an interrupt.
@@ -81,6 +88,7 @@ public:
 	unlock_shared()
 	{
 		owner.store(NoOwner, std::memory_order_release);
+		waiters.notify_all();
 	}
 };
 
@@ -29,6 +29,7 @@ Task::Task(Stack<Size>& stack, T&& closure, Start start)
 		using Callable = std::conditional_t<with_stop_token, void(*)(stop_token), void(*)()>;
 		auto caller = (uintptr_t) +[](Callable fn)
 		{
+			fiber::Scheduler::instance().release();
 			if constexpr (with_stop_token) {
 				fn(fiber::Scheduler::instance().current->get_stop_token());
 			} else fn();
@@ -51,6 +52,7 @@ Task::Task(Stack<Size>& stack, T&& closure, Start start)
 		// Encapsulate the proper ABI function call into a simpler function
 		auto caller = (uintptr_t) +[](std::decay_t<T>* closure)
 		{
+			fiber::Scheduler::instance().release();
 			if constexpr (with_stop_token) {
 				(*closure)(fiber::Scheduler::instance().current->get_stop_token());
 			} else (*closure)();
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "task.hpp"
+#include <modm/architecture/interface/atomic_lock.hpp>
+
+namespace modm::fiber
+{
+
+/**
+ * Intrusive FIFO queue of fibers blocked on a synchronization primitive.
+ *
+ * Instead of polling a condition on every round of the scheduler, a waiting
+ * fiber is removed from the run ring and linked into this queue until it is
+ * notified, which places it back at the end of its scheduler's run ring.
+ * Blocked fibers therefore do not cost any scheduling time.
+ *
+ * Outside of a fiber, waiting falls back to polling the condition with
+ * `modm::this_fiber::yield()`.
+ *
+ * @ingroup modm_processing_fiber
+ */
+class WaitQueue
+{
+	WaitQueue(const WaitQueue&) = delete;
+	WaitQueue& operator=(const WaitQueue&) = delete;
+
+	Task* head{nullptr};
+	Task* tail{nullptr};
+
+public:
+	constexpr WaitQueue() = default;
+
+	/// Suspends the current fiber until it is notified, unless
+	/// `bool condition()` returns true. The condition is evaluated atomically
+	/// with enqueuing the fiber, so that notifications cannot get lost.
+	/// @warning Spurious wakeups are possible, so the condition must be
+	///          checked again after returning!
+	template< class Function >
+	requires requires { std::is_invocable_r_v<bool, Function, void>; }
+	void
+	wait(Function &&condition)
+	{
+		Scheduler& scheduler = Scheduler::instance();
+		if (scheduler.current == nullptr or Scheduler::isInsideInterrupt())
+		{
+			modm::this_fiber::poll(std::forward<Function>(condition));
+			return;
+		}
+		{
+			modm::atomic::Lock _;
+			if (std::forward<Function>(condition)()) return;
+			Task* task = scheduler.current;
+			task->wait_next = nullptr;
+			if (tail) tail->wait_next = task;
+			else head = task;
+			tail = task;
+		}
+		scheduler.suspend();
+	}
+
+	/// Wakes up the longest waiting fiber.
+	/// @returns if a fiber was woken up.
+	/// @note This function can be called from an interrupt.
+	bool inline
+	notify_one()
+	{
+		Task* task;
+		{
+			modm::atomic::Lock _;
+			if ((task = head) == nullptr) return false;
+			if ((head = task->wait_next) == nullptr) tail = nullptr;
+		}
+		Scheduler::wake(task);
+		return true;
+	}
+
+	/// Wakes up all waiting fibers.
+	/// @note This function can be called from an interrupt.
+	void inline
+	notify_all()
+	{
+		Task* task;
+		{
+			modm::atomic::Lock _;
+			task = head;
+			head = tail = nullptr;
+		}
+		while (task)
+		{
+			// wake() reuses the link, so advance first
+			Task* next = task->wait_next;
+			Scheduler::wake(task);
+			task = next;
+		}
+	}
+
+	/// @returns if no fiber is waiting.
+	/// @note This function can be called from an interrupt.
+	[[nodiscard]] bool inline
+	empty() const
+	{
+		return head == nullptr;
+	}
+};
+
+}	// namespace modm::fiber
@@ -5,6 +5,8 @@
 
 #include "graphic_display.hpp"
 
+#include <utility>
+
 namespace modm
 {
 
@@ -52,6 +54,15 @@ public:
 	}
 
 protected:
+	/// Draws the run in the background color with drawHorizontalLine().
+	void
+	clearHorizontalLine(glcd::Point start, uint16_t length) override
+	{
+		std::swap(foregroundColor, backgroundColor);
+		drawHorizontalLine(start, length);
+		std::swap(foregroundColor, backgroundColor);
+	}
+
 	color::Rgb565 foregroundColor;
 	color::Rgb565 backgroundColor;
 };
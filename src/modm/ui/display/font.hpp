@@ -19,11 +19,21 @@
  *
  * Various fonts for graphical displays.
  * The fonts are created with the "FontCreator 3.0", see `tools/font_creator`.
+ *
+ * `tools/font_creator/font_export.py --atlas` exports a font in the atlas
+ * format instead. It starts with a zero size, followed by flags and the
+ * same header as before. A table stores the data offset, width and advance
+ * of every character, so that drawing a character or measuring a string
+ * does not walk the width table. The characters are stored row by row,
+ * least significant bit first, which matches displays with a horizontally
+ * packed buffer. With `--rle` the rows are run-length encoded instead,
+ * which shrinks large fonts like `Numbers46x64Atlas` to less than half.
  */
 
 #include "font/scripto_narrow.hpp"
 #include "font/all_caps_3x5.hpp"
 #include "font/fixed_width_5x8.hpp"
+#include "font/fixed_width_5x8_atlas.hpp"
 #include "font/assertion.hpp"
 #include "font/arcade_classic.hpp"
 #include "font/ubuntu_36.hpp"
@@ -31,4 +41,5 @@
 #include "font/numbers_14x32.hpp"
 #include "font/numbers_40x56.hpp"
 #include "font/numbers_46x64.hpp"
+#include "font/numbers_46x64_atlas.hpp"
 #include "font/matrix_8x8.hpp"
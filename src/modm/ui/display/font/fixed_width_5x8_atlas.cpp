@@ -0,0 +1,227 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+// created with font_export.py --atlas
+
+#include <modm/architecture/interface/accessor.hpp>
+
+namespace modm
+{
+	namespace font
+	{
+		FLASH_STORAGE(uint8_t FixedWidth5x8Atlas[]) =
+		{
+			0x00, 0x00, // atlas format
+			0x00,	// flags
+			8,	// height
+			0,	// hspace
+			1, 	// vspace
+			32,	// first char
+			96,	// char count
+
+			// glyphs
+			// for each character the data offset (low, high), width and advance
+			0x00, 0x00,  5,  6, // 32
+			0x08, 0x00,  5,  6, // 33
+			0x10, 0x00,  5,  6, // 34
+			0x18, 0x00,  5,  6, // 35
+			0x20, 0x00,  5,  6, // 36
+			0x28, 0x00,  5,  6, // 37
+			0x30, 0x00,  5,  6, // 38
+			0x38, 0x00,  5,  6, // 39
+			0x40, 0x00,  5,  6, // 40
+			0x48, 0x00,  5,  6, // 41
+			0x50, 0x00,  5,  6, // 42
+			0x58, 0x00,  5,  6, // 43
+			0x60, 0x00,  5,  6, // 44
+			0x68, 0x00,  5,  6, // 45
+			0x70, 0x00,  5,  6, // 46
+			0x78, 0x00,  5,  6, // 47
+			0x80, 0x00,  5,  6, // 48
+			0x88, 0x00,  5,  6, // 49
+			0x90, 0x00,  5,  6, // 50
+			0x98, 0x00,  5,  6, // 51
+			0xA0, 0x00,  5,  6, // 52
+			0xA8, 0x00,  5,  6, // 53
+			0xB0, 0x00,  5,  6, // 54
+			0xB8, 0x00,  5,  6, // 55
+			0xC0, 0x00,  5,  6, // 56
+			0xC8, 0x00,  5,  6, // 57
+			0xD0, 0x00,  5,  6, // 58
+			0xD8, 0x00,  5,  6, // 59
+			0xE0, 0x00,  5,  6, // 60
+			0xE8, 0x00,  5,  6, // 61
+			0xF0, 0x00,  5,  6, // 62
+			0xF8, 0x00,  5,  6, // 63
+			0x00, 0x01,  5,  6, // 64
+			0x08, 0x01,  5,  6, // 65
+			0x10, 0x01,  5,  6, // 66
+			0x18, 0x01,  5,  6, // 67
+			0x20, 0x01,  5,  6, // 68
+			0x28, 0x01,  5,  6, // 69
+			0x30, 0x01,  5,  6, // 70
+			0x38, 0x01,  5,  6, // 71
+			0x40, 0x01,  5,  6, // 72
+			0x48, 0x01,  5,  6, // 73
+			0x50, 0x01,  5,  6, // 74
+			0x58, 0x01,  5,  6, // 75
+			0x60, 0x01,  5,  6, // 76
+			0x68, 0x01,  5,  6, // 77
+			0x70, 0x01,  5,  6, // 78
+			0x78, 0x01,  5,  6, // 79
+			0x80, 0x01,  5,  6, // 80
+			0x88, 0x01,  5,  6, // 81
+			0x90, 0x01,  5,  6, // 82
+			0x98, 0x01,  5,  6, // 83
+			0xA0, 0x01,  5,  6, // 84
+			0xA8, 0x01,  5,  6, // 85
+			0xB0, 0x01,  5,  6, // 86
+			0xB8, 0x01,  5,  6, // 87
+			0xC0, 0x01,  5,  6, // 88
+			0xC8, 0x01,  5,  6, // 89
+			0xD0, 0x01,  5,  6, // 90
+			0xD8, 0x01,  5,  6, // 91
+			0xE0, 0x01,  5,  6, // 92
+			0xE8, 0x01,  5,  6, // 93
+			0xF0, 0x01,  5,  6, // 94
+			0xF8, 0x01,  5,  6, // 95
+			0x00, 0x02,  5,  6, // 96
+			0x08, 0x02,  5,  6, // 97
+			0x10, 0x02,  5,  6, // 98
+			0x18, 0x02,  5,  6, // 99
+			0x20, 0x02,  5,  6, // 100
+			0x28, 0x02,  5,  6, // 101
+			0x30, 0x02,  5,  6, // 102
+			0x38, 0x02,  5,  6, // 103
+			0x40, 0x02,  5,  6, // 104
+			0x48, 0x02,  5,  6, // 105
+			0x50, 0x02,  5,  6, // 106
+			0x58, 0x02,  5,  6, // 107
+			0x60, 0x02,  5,  6, // 108
+			0x68, 0x02,  5,  6, // 109
+			0x70, 0x02,  5,  6, // 110
+			0x78, 0x02,  5,  6, // 111
+			0x80, 0x02,  5,  6, // 112
+			0x88, 0x02,  5,  6, // 113
+			0x90, 0x02,  5,  6, // 114
+			0x98, 0x02,  5,  6, // 115
+			0xA0, 0x02,  5,  6, // 116
+			0xA8, 0x02,  5,  6, // 117
+			0xB0, 0x02,  5,  6, // 118
+			0xB8, 0x02,  5,  6, // 119
+			0xC0, 0x02,  5,  6, // 120
+			0xC8, 0x02,  5,  6, // 121
+			0xD0, 0x02,  5,  6, // 122
+			0xD8, 0x02,  5,  6, // 123
+			0xE0, 0x02,  5,  6, // 124
+			0xE8, 0x02,  5,  6, // 125
+			0xF0, 0x02,  5,  6, // 126
+			0xF8, 0x02,  5,  6, // 127
+
+			// glyph data
+			// rows of all characters, least significant bit first
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 32
+			0x04, 0x0E, 0x0E, 0x04, 0x04, 0x00, 0x04, 0x00, // 33
+			0x1B, 0x1B, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, // 34
+			0x00, 0x0A, 0x1F, 0x0A, 0x0A, 0x1F, 0x0A, 0x00, // 35
+			0x04, 0x1E, 0x05, 0x0E, 0x14, 0x0F, 0x04, 0x00, // 36
+			0x03, 0x13, 0x08, 0x04, 0x02, 0x19, 0x18, 0x00, // 37
+			0x02, 0x05, 0x05, 0x02, 0x15, 0x09, 0x16, 0x00, // 38
+			0x0C, 0x0C, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, // 39
+			0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x00, // 40
+			0x02, 0x04, 0x04, 0x04, 0x04, 0x04, 0x02, 0x00, // 41
+			0x00, 0x0A, 0x0E, 0x1F, 0x0E, 0x0A, 0x00, 0x00, // 42
+			0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00, 0x00, // 43
+			0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x04, 0x02, // 44
+			0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, // 45
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, // 46
+			0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, // 47
+			0x0E, 0x11, 0x19, 0x15, 0x13, 0x11, 0x0E, 0x00, // 48
+			0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00, // 49
+			0x0E, 0x11, 0x10, 0x0C, 0x02, 0x01, 0x1F, 0x00, // 50
+			0x0E, 0x11, 0x10, 0x0E, 0x10, 0x11, 0x0E, 0x00, // 51
+			0x08, 0x0C, 0x0A, 0x09, 0x1F, 0x08, 0x08, 0x00, // 52
+			0x1F, 0x01, 0x01, 0x0F, 0x10, 0x11, 0x0E, 0x00, // 53
+			0x0C, 0x02, 0x01, 0x0F, 0x11, 0x11, 0x0E, 0x00, // 54
+			0x1F, 0x10, 0x08, 0x04, 0x02, 0x02, 0x02, 0x00, // 55
+			0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E, 0x00, // 56
+			0x0E, 0x11, 0x11, 0x1E, 0x10, 0x08, 0x06, 0x00, // 57
+			0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, // 58
+			0x00, 0x00, 0x04, 0x00, 0x00, 0x04, 0x04, 0x02, // 59
+			0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x00, // 60
+			0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00, 0x00, // 61
+			0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, 0x00, // 62
+			0x0E, 0x11, 0x10, 0x0C, 0x04, 0x00, 0x04, 0x00, // 63
+			0x0E, 0x11, 0x1D, 0x15, 0x1D, 0x01, 0x0E, 0x00, // 64
+			0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x00, // 65
+			0x0F, 0x11, 0x11, 0x0F, 0x11, 0x11, 0x0F, 0x00, // 66
+			0x0E, 0x11, 0x01, 0x01, 0x01, 0x11, 0x0E, 0x00, // 67
+			0x0F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x00, // 68
+			0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x1F, 0x00, // 69
+			0x1F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x01, 0x00, // 70
+			0x0E, 0x11, 0x01, 0x1D, 0x11, 0x11, 0x1E, 0x00, // 71
+			0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11, 0x00, // 72
+			0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E, 0x00, // 73
+			0x10, 0x10, 0x10, 0x10, 0x11, 0x11, 0x0E, 0x00, // 74
+			0x11, 0x09, 0x05, 0x03, 0x05, 0x09, 0x11, 0x00, // 75
+			0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x1F, 0x00, // 76
+			0x11, 0x1B, 0x15, 0x11, 0x11, 0x11, 0x11, 0x00, // 77
+			0x11, 0x13, 0x15, 0x19, 0x11, 0x11, 0x11, 0x00, // 78
+			0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, // 79
+			0x0F, 0x11, 0x11, 0x0F, 0x01, 0x01, 0x01, 0x00, // 80
+			0x0E, 0x11, 0x11, 0x11, 0x15, 0x09, 0x16, 0x00, // 81
+			0x0F, 0x11, 0x11, 0x0F, 0x09, 0x11, 0x11, 0x00, // 82
+			0x0E, 0x11, 0x01, 0x0E, 0x10, 0x11, 0x0E, 0x00, // 83
+			0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, // 84
+			0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, // 85
+			0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00, // 86
+			0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A, 0x00, // 87
+			0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11, 0x00, // 88
+			0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x00, // 89
+			0x1F, 0x10, 0x08, 0x04, 0x02, 0x01, 0x1F, 0x00, // 90
+			0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0C, 0x00, // 91
+			0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, // 92
+			0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x00, // 93
+			0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, // 94
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, // 95
+			0x06, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // 96
+			0x00, 0x00, 0x0E, 0x10, 0x1E, 0x11, 0x1E, 0x00, // 97
+			0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x0F, 0x00, // 98
+			0x00, 0x00, 0x0E, 0x11, 0x01, 0x11, 0x0E, 0x00, // 99
+			0x10, 0x10, 0x1E, 0x11, 0x11, 0x11, 0x1E, 0x00, // 100
+			0x00, 0x00, 0x0E, 0x11, 0x0F, 0x01, 0x0E, 0x00, // 101
+			0x0C, 0x02, 0x02, 0x0F, 0x02, 0x02, 0x02, 0x00, // 102
+			0x00, 0x00, 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x0E, // 103
+			0x01, 0x01, 0x01, 0x07, 0x09, 0x09, 0x09, 0x00, // 104
+			0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x0C, 0x00, // 105
+			0x08, 0x00, 0x0C, 0x08, 0x08, 0x08, 0x09, 0x06, // 106
+			0x01, 0x01, 0x09, 0x05, 0x03, 0x05, 0x09, 0x00, // 107
+			0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0C, 0x00, // 108
+			0x00, 0x00, 0x0B, 0x15, 0x15, 0x11, 0x11, 0x00, // 109
+			0x00, 0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x00, // 110
+			0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E, 0x00, // 111
+			0x00, 0x00, 0x0F, 0x11, 0x11, 0x0F, 0x01, 0x01, // 112
+			0x00, 0x00, 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, // 113
+			0x00, 0x00, 0x0D, 0x12, 0x02, 0x02, 0x07, 0x00, // 114
+			0x00, 0x00, 0x0E, 0x01, 0x0E, 0x10, 0x0E, 0x00, // 115
+			0x02, 0x0F, 0x02, 0x02, 0x02, 0x0A, 0x04, 0x00, // 116
+			0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x0E, 0x00, // 117
+			0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04, 0x00, // 118
+			0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A, 0x00, // 119
+			0x00, 0x00, 0x09, 0x09, 0x06, 0x09, 0x09, 0x00, // 120
+			0x00, 0x00, 0x11, 0x11, 0x11, 0x1E, 0x10, 0x0E, // 121
+			0x00, 0x00, 0x0F, 0x08, 0x06, 0x01, 0x0F, 0x00, // 122
+			0x0C, 0x02, 0x02, 0x03, 0x02, 0x02, 0x0C, 0x00, // 123
+			0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, // 124
+			0x06, 0x08, 0x08, 0x18, 0x08, 0x08, 0x06, 0x00, // 125
+			0x00, 0x00, 0x00, 0x0A, 0x05, 0x00, 0x00, 0x00, // 126
+			0x04, 0x0E, 0x1B, 0x11, 0x11, 0x11, 0x1F, 0x00, // 127
+		};
+	}
+}
@@ -0,0 +1,37 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_FONT_FIXED_WIDTH_5X8_ATLAS_HPP
+#define	MODM_FONT_FIXED_WIDTH_5X8_ATLAS_HPP
+
+#include <modm/architecture/interface/accessor.hpp>
+
+namespace modm
+{
+	namespace font
+	{
+		/**
+		 * \brief	Fixed Width 5x8 (Atlas)
+		 *
+		 * - maximum width   : 5
+		 * - height          : 8
+		 * - hspace          : 0
+		 * - vspace          : 1
+		 * - first char      : 32
+		 * - last char       : 128
+		 * - number of chars : 96
+		 * - size in bytes   : 1160
+		 *
+		 * \ingroup	modm_ui_display_font
+		 */
+		EXTERN_FLASH_STORAGE(uint8_t FixedWidth5x8Atlas[]);
+	}
+}
+
+#endif	// MODM_FONT_FIXED_WIDTH_5X8_ATLAS_HPP
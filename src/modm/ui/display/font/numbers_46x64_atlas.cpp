@@ -0,0 +1,55 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+// created with font_export.py --atlas
+
+#include <modm/architecture/interface/accessor.hpp>
+
+namespace modm
+{
+	namespace font
+	{
+		FLASH_STORAGE(uint8_t Numbers46x64Atlas[]) =
+		{
+			0x00, 0x00, // atlas format
+			0x01,	// flags
+			64,	// height
+			4,	// hspace
+			4, 	// vspace
+			48,	// first char
+			10,	// char count
+
+			// glyphs
+			// for each character the data offset (low, high), width and advance
+			0x00, 0x00, 46, 50, // 48
+			0xB7, 0x00, 46, 50, // 49
+			0x44, 0x01, 46, 50, // 50
+			0xD1, 0x01, 46, 50, // 51
+			0x60, 0x02, 46, 50, // 52
+			0xF7, 0x02, 46, 50, // 53
+			0x7E, 0x03, 46, 50, // 54
+			0x19, 0x04, 46, 50, // 55
+			0x9A, 0x04, 46, 50, // 56
+			0x5D, 0x05, 46, 50, // 57
+
+			// glyph data
+			// runs of alternating background and foreground pixels
+			0x12, 0x0A, 0x21, 0x11, 0x1B, 0x15, 0x17, 0x18, 0x15, 0x1B, 0x12, 0x1D, 0x10, 0x1F, 0x0E, 0x20, 0x0D, 0x22, 0x0B, 0x24, 0x0A, 0x24, 0x09, 0x10, 0x06, 0x10, 0x08, 0x0E, 0x0A, 0x0E, 0x07, 0x0E, 0x0C, 0x0E, 0x06, 0x0D, 0x0E, 0x0D, 0x05, 0x0E, 0x0E, 0x0E, 0x04, 0x0D, 0x10, 0x0D, 0x04, 0x0D, 0x10, 0x0D, 0x04, 0x0D, 0x10, 0x0E, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0C, 0x14, 0x0C, 0x01, 0x0D, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x0D, 0x01, 0x0C, 0x14, 0x0C, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x11, 0x0E, 0x03, 0x0D, 0x10, 0x0D, 0x04, 0x0D, 0x10, 0x0D, 0x04, 0x0E, 0x0E, 0x0E, 0x05, 0x0D, 0x0E, 0x0D, 0x06, 0x0E, 0x0C, 0x0E, 0x06, 0x0F, 0x0A, 0x0E, 0x08, 0x10, 0x06, 0x10, 0x09, 0x24, 0x0A, 0x24, 0x0B, 0x22, 0x0D, 0x20, 0x0E, 0x20, 0x0F, 0x1E, 0x11, 0x1C, 0x14, 0x18, 0x17, 0x16, 0x1A, 0x12, 0x20, 0x0A, 0x12, // 48
+			0x1D, 0x09, 0x23, 0x0B, 0x22, 0x0C, 0x21, 0x0D, 0x20, 0x0E, 0x1E, 0x10, 0x1D, 0x11, 0x1B, 0x13, 0x19, 0x15, 0x18, 0x16, 0x16, 0x18, 0x13, 0x1B, 0x11, 0x1D, 0x10, 0x1E, 0x10, 0x1E, 0x11, 0x1D, 0x11, 0x1D, 0x12, 0x0E, 0x01, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x13, 0x0A, 0x04, 0x0D, 0x13, 0x07, 0x07, 0x0D, 0x13, 0x05, 0x09, 0x0D, 0x14, 0x01, 0x0C, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x08, // 49
+			0x10, 0x0B, 0x1F, 0x13, 0x19, 0x18, 0x14, 0x1B, 0x11, 0x1F, 0x0E, 0x21, 0x0B, 0x24, 0x09, 0x25, 0x08, 0x27, 0x08, 0x26, 0x09, 0x26, 0x08, 0x0E, 0x07, 0x11, 0x09, 0x0B, 0x0C, 0x0E, 0x0A, 0x08, 0x0F, 0x0E, 0x0A, 0x05, 0x11, 0x0E, 0x0A, 0x04, 0x13, 0x0D, 0x0B, 0x02, 0x14, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x20, 0x0E, 0x1F, 0x0F, 0x1F, 0x0E, 0x1F, 0x0F, 0x1E, 0x0F, 0x1E, 0x10, 0x1D, 0x10, 0x1D, 0x10, 0x1D, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1C, 0x11, 0x1D, 0x10, 0x1D, 0x11, 0x1C, 0x11, 0x1D, 0x10, 0x1D, 0x10, 0x1E, 0x0F, 0x1E, 0x10, 0x1E, 0x0F, 0x1F, 0x28, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x02, // 50
+			0x0F, 0x0B, 0x1F, 0x13, 0x18, 0x18, 0x14, 0x1C, 0x10, 0x1F, 0x0D, 0x23, 0x0B, 0x23, 0x0C, 0x23, 0x0B, 0x24, 0x0B, 0x23, 0x0B, 0x24, 0x0B, 0x0A, 0x08, 0x11, 0x0B, 0x07, 0x0D, 0x0F, 0x0C, 0x04, 0x10, 0x0F, 0x0B, 0x02, 0x13, 0x0E, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x20, 0x0E, 0x1F, 0x0E, 0x1D, 0x11, 0x13, 0x1A, 0x14, 0x19, 0x15, 0x18, 0x16, 0x17, 0x17, 0x15, 0x19, 0x17, 0x17, 0x19, 0x15, 0x1A, 0x14, 0x1C, 0x12, 0x1C, 0x12, 0x1D, 0x1C, 0x13, 0x1E, 0x10, 0x20, 0x0F, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x20, 0x0E, 0x1F, 0x0E, 0x07, 0x01, 0x17, 0x0F, 0x06, 0x05, 0x13, 0x10, 0x06, 0x09, 0x0C, 0x12, 0x07, 0x27, 0x07, 0x26, 0x07, 0x27, 0x07, 0x26, 0x08, 0x25, 0x09, 0x24, 0x09, 0x24, 0x0A, 0x22, 0x0E, 0x1E, 0x14, 0x17, 0x1D, 0x0D, 0x14, // 51
+			0x1B, 0x0C, 0x21, 0x0D, 0x20, 0x0E, 0x1F, 0x0F, 0x1E, 0x10, 0x1D, 0x11, 0x1C, 0x12, 0x1C, 0x12, 0x1B, 0x13, 0x1A, 0x14, 0x19, 0x15, 0x18, 0x16, 0x18, 0x16, 0x17, 0x17, 0x16, 0x18, 0x15, 0x19, 0x15, 0x19, 0x14, 0x1A, 0x13, 0x0D, 0x01, 0x0D, 0x13, 0x0C, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x11, 0x0D, 0x03, 0x0D, 0x11, 0x0C, 0x04, 0x0D, 0x10, 0x0D, 0x04, 0x0D, 0x0F, 0x0D, 0x05, 0x0D, 0x0F, 0x0C, 0x06, 0x0D, 0x0E, 0x0C, 0x07, 0x0D, 0x0D, 0x0D, 0x07, 0x0D, 0x0D, 0x0C, 0x08, 0x0D, 0x0C, 0x0C, 0x09, 0x0D, 0x0C, 0x0C, 0x09, 0x0D, 0x0B, 0x0C, 0x0A, 0x0D, 0x0A, 0x0D, 0x0A, 0x0D, 0x0A, 0x0C, 0x0B, 0x0D, 0x09, 0x0D, 0x0B, 0x0D, 0x09, 0x0C, 0x0C, 0x0D, 0x08, 0x0D, 0x0C, 0x0D, 0x08, 0x0C, 0x0D, 0x0D, 0x07, 0xFF, 0x00, 0xFB, 0x1A, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x07, // 52
+			0x08, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0B, 0x23, 0x0B, 0x23, 0x0B, 0x23, 0x0B, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0B, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x0C, 0x22, 0x11, 0x1D, 0x16, 0x18, 0x19, 0x15, 0x1C, 0x12, 0x1D, 0x11, 0x1F, 0x0F, 0x20, 0x0D, 0x22, 0x0C, 0x23, 0x0B, 0x24, 0x0A, 0x25, 0x14, 0x1A, 0x1A, 0x15, 0x1C, 0x12, 0x1E, 0x10, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x1F, 0x0E, 0x06, 0x01, 0x18, 0x0F, 0x06, 0x04, 0x14, 0x10, 0x06, 0x09, 0x0C, 0x12, 0x07, 0x27, 0x06, 0x27, 0x07, 0x26, 0x08, 0x26, 0x08, 0x25, 0x09, 0x24, 0x09, 0x23, 0x0B, 0x22, 0x0E, 0x1E, 0x14, 0x17, 0x1C, 0x0E, 0x14, // 53
+			0x4F, 0x07, 0x21, 0x0D, 0x1E, 0x10, 0x1B, 0x13, 0x19, 0x16, 0x16, 0x18, 0x14, 0x1A, 0x13, 0x1B, 0x11, 0x1D, 0x10, 0x1E, 0x0F, 0x1F, 0x0E, 0x19, 0x14, 0x15, 0x18, 0x13, 0x1A, 0x12, 0x1C, 0x10, 0x1D, 0x10, 0x1E, 0x0F, 0x1E, 0x0E, 0x20, 0x0E, 0x1F, 0x0E, 0x20, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x03, 0x0C, 0x12, 0x20, 0x0D, 0x23, 0x0B, 0x25, 0x09, 0x26, 0x08, 0x28, 0x06, 0x29, 0x04, 0x2A, 0x04, 0x2B, 0x03, 0x2C, 0x02, 0x2C, 0x02, 0x10, 0x0B, 0x12, 0x01, 0x0D, 0x10, 0x10, 0x01, 0x0D, 0x12, 0x0E, 0x01, 0x0D, 0x13, 0x1B, 0x13, 0x1B, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x1A, 0x14, 0x0D, 0x01, 0x0D, 0x13, 0x0D, 0x01, 0x0D, 0x13, 0x0D, 0x01, 0x0D, 0x13, 0x0D, 0x01, 0x0D, 0x12, 0x0E, 0x01, 0x0E, 0x11, 0x0D, 0x03, 0x0E, 0x0F, 0x0E, 0x03, 0x0E, 0x0E, 0x0F, 0x03, 0x10, 0x0B, 0x0F, 0x05, 0x11, 0x07, 0x11, 0x05, 0x28, 0x07, 0x27, 0x08, 0x25, 0x09, 0x24, 0x0B, 0x22, 0x0D, 0x20, 0x0F, 0x1E, 0x12, 0x1B, 0x14, 0x18, 0x19, 0x13, 0x1E, 0x0C, 0x11, // 54
+			0x01, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x1F, 0x0E, 0x1F, 0x0F, 0x1E, 0x0F, 0x1F, 0x0E, 0x1F, 0x0F, 0x1E, 0x0F, 0x1F, 0x0E, 0x1F, 0x0F, 0x1F, 0x0E, 0x1F, 0x0E, 0x20, 0x0E, 0x1F, 0x0E, 0x20, 0x0E, 0x1F, 0x0E, 0x20, 0x0E, 0x1F, 0x0E, 0x20, 0x0E, 0x20, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x21, 0x0D, 0x20, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x20, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x20, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x17, // 55
+			0x12, 0x0A, 0x20, 0x12, 0x1A, 0x16, 0x16, 0x1A, 0x13, 0x1C, 0x10, 0x1F, 0x0E, 0x21, 0x0D, 0x22, 0x0B, 0x24, 0x09, 0x25, 0x09, 0x26, 0x07, 0x11, 0x05, 0x11, 0x07, 0x0F, 0x09, 0x0F, 0x07, 0x0E, 0x0B, 0x0F, 0x05, 0x0E, 0x0D, 0x0E, 0x05, 0x0D, 0x0F, 0x0D, 0x05, 0x0D, 0x0F, 0x0D, 0x05, 0x0D, 0x0F, 0x0D, 0x05, 0x0D, 0x0F, 0x0D, 0x05, 0x0D, 0x0F, 0x0D, 0x05, 0x0E, 0x0E, 0x0D, 0x05, 0x0E, 0x0D, 0x0D, 0x07, 0x0E, 0x0C, 0x0D, 0x07, 0x0F, 0x0A, 0x0D, 0x08, 0x10, 0x08, 0x0E, 0x09, 0x11, 0x05, 0x0E, 0x0A, 0x13, 0x02, 0x0E, 0x0C, 0x22, 0x0D, 0x20, 0x0F, 0x1D, 0x12, 0x1B, 0x14, 0x1B, 0x13, 0x1D, 0x0F, 0x20, 0x0D, 0x22, 0x0B, 0x24, 0x09, 0x0F, 0x02, 0x15, 0x08, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x09, 0x11, 0x05, 0x0E, 0x0C, 0x10, 0x04, 0x0E, 0x0D, 0x0F, 0x04, 0x0D, 0x0F, 0x0E, 0x03, 0x0E, 0x10, 0x0E, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0E, 0x10, 0x0E, 0x02, 0x0E, 0x10, 0x0E, 0x02, 0x0F, 0x0E, 0x0E, 0x04, 0x0F, 0x0C, 0x0F, 0x04, 0x11, 0x08, 0x11, 0x05, 0x28, 0x06, 0x28, 0x07, 0x26, 0x08, 0x26, 0x09, 0x24, 0x0B, 0x22, 0x0D, 0x20, 0x10, 0x1C, 0x14, 0x18, 0x18, 0x14, 0x1E, 0x0C, 0x11, // 56
+			0x11, 0x0B, 0x20, 0x11, 0x1B, 0x16, 0x16, 0x19, 0x14, 0x1C, 0x10, 0x1F, 0x0E, 0x21, 0x0D, 0x22, 0x0B, 0x23, 0x0A, 0x25, 0x09, 0x25, 0x08, 0x10, 0x07, 0x10, 0x07, 0x0F, 0x09, 0x0F, 0x06, 0x0E, 0x0D, 0x0E, 0x05, 0x0E, 0x0D, 0x0E, 0x05, 0x0D, 0x0F, 0x0E, 0x03, 0x0E, 0x0F, 0x0E, 0x03, 0x0D, 0x11, 0x0D, 0x03, 0x0D, 0x11, 0x0D, 0x03, 0x0D, 0x11, 0x0D, 0x03, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0D, 0x12, 0x0D, 0x02, 0x0E, 0x11, 0x0D, 0x02, 0x0E, 0x11, 0x0D, 0x03, 0x0E, 0x10, 0x0D, 0x03, 0x0F, 0x0F, 0x0D, 0x03, 0x12, 0x09, 0x10, 0x04, 0x2A, 0x04, 0x2A, 0x05, 0x29, 0x05, 0x29, 0x06, 0x28, 0x07, 0x27, 0x08, 0x25, 0x0A, 0x24, 0x0C, 0x22, 0x0E, 0x12, 0x01, 0x0D, 0x12, 0x0B, 0x03, 0x0E, 0x20, 0x0D, 0x21, 0x0D, 0x20, 0x0E, 0x1F, 0x0E, 0x20, 0x0E, 0x1F, 0x0F, 0x1E, 0x0F, 0x1D, 0x11, 0x1C, 0x11, 0x1B, 0x12, 0x19, 0x15, 0x14, 0x19, 0x0D, 0x20, 0x0E, 0x1F, 0x10, 0x1D, 0x11, 0x1C, 0x12, 0x1A, 0x14, 0x19, 0x15, 0x17, 0x17, 0x15, 0x19, 0x12, 0x1C, 0x0E, 0x20, 0x08, 0x20, // 57
+		};
+	}
+}
@@ -18,6 +18,7 @@
 
 #include "graphic_display.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <modm/math/utils/bit_operation.hpp>
 
@@ -36,12 +37,12 @@ modm::GraphicDisplay::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 	{
 		// x1|y1 must be the upper point
 		if (y1 > y2) { modm::swap(y1, y2); }
-		this->drawVerticalLine(glcd::Point(x1, y1), y2 - y1 + 1);
+		this->drawVerticalRun(glcd::Point(x1, y1), y2 - y1 + 1);
 	} else if (y1 == y2)
 	{
 		// x1|y1 must be the left point
 		if (x1 > x2) { modm::swap(x1, x2); }
-		this->drawHorizontalLine(glcd::Point(x1, y1), x2 - x1 + 1);
+		this->drawHorizontalRun(glcd::Point(x1, y1), x2 - x1 + 1);
 	} else
 	{
 		// bresenham algorithm
@@ -70,15 +71,21 @@ modm::GraphicDisplay::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 		else
 			yStep = -1;
 
+		// Consecutive pixels on the same row (or column if steep) are drawn as one run
+		int_fast16_t run = x1;
 		for (int_fast16_t x = x1; x <= x2; ++x)
 		{
-			if (steep)
-				this->setPixel(y, x);
-			else
-				this->setPixel(x, y);
-
 			error = error - deltaY;
 
+			if (error < 0 or x == x2)
+			{
+				if (steep)
+					this->drawVerticalRun(glcd::Point(y, run), x - run + 1);
+				else
+					this->drawHorizontalRun(glcd::Point(run, y), x - run + 1);
+				run = x + 1;
+			}
+
 			if (error < 0)
 			{
 				y += yStep;
@@ -106,16 +113,50 @@ modm::GraphicDisplay::drawVerticalLine(glcd::Point start, uint16_t length)
 	}
 }
 
+void
+modm::GraphicDisplay::clearHorizontalLine(glcd::Point start, uint16_t length)
+{
+	for (int_fast16_t i = start.x; i < static_cast<int16_t>(start.x + length); ++i)
+	{
+		this->clearPixel(i, start.y);
+	}
+}
+
+void
+modm::GraphicDisplay::drawHorizontalRun(glcd::Point start, int16_t length, bool set)
+{
+	if (start.y < 0 or start.y >= int16_t(getHeight())) { return; }
+	const int16_t x1 = std::max<int16_t>(start.x, 0);
+	const int16_t x2 = std::min<int32_t>(start.x + length, getWidth());
+	if (x1 >= x2) { return; }
+
+	if (set)
+		this->drawHorizontalLine(glcd::Point(x1, start.y), x2 - x1);
+	else
+		this->clearHorizontalLine(glcd::Point(x1, start.y), x2 - x1);
+}
+
+void
+modm::GraphicDisplay::drawVerticalRun(glcd::Point start, int16_t length)
+{
+	if (start.x < 0 or start.x >= int16_t(getWidth())) { return; }
+	const int16_t y1 = std::max<int16_t>(start.y, 0);
+	const int16_t y2 = std::min<int32_t>(start.y + length, getHeight());
+	if (y1 >= y2) { return; }
+
+	this->drawVerticalLine(glcd::Point(start.x, y1), y2 - y1);
+}
+
 void
 modm::GraphicDisplay::drawRectangle(glcd::Point start, uint16_t width, uint16_t height)
 {
 	uint16_t x2 = start.x + width - 1;
 	uint16_t y2 = start.y + height - 1;
 
-	this->drawHorizontalLine(start, width);
-	this->drawHorizontalLine(glcd::Point(start.x, y2), width);
-	this->drawVerticalLine(start, height);
-	this->drawVerticalLine(glcd::Point(x2, start.y), height);
+	this->drawHorizontalRun(start, width);
+	this->drawHorizontalRun(glcd::Point(start.x, y2), width);
+	this->drawVerticalRun(start, height);
+	this->drawVerticalRun(glcd::Point(x2, start.y), height);
 }
 
 void
@@ -127,37 +168,13 @@ modm::GraphicDisplay::drawRoundedRectangle(glcd::Point start, uint16_t width, ui
 	const int16_t x = start.x;
 	const int16_t y = start.y;
 
-	int16_t x1 = 0;
-	int16_t y1 = radius;
-	int16_t f = 3 - 2 * radius;
-
-	while (x1 <= y1)
-	{
-		this->setPixel(x + radius - x1, y + radius - y1);
-		this->setPixel(x + radius - x1, y + height - radius + y1);
-		this->setPixel(x + radius - y1, y + radius - x1);
-		this->setPixel(x + radius - y1, y + height - radius + x1);
-
-		this->setPixel(x + width - radius + x1, y + radius - y1);
-		this->setPixel(x + width - radius + x1, y + height - radius + y1);
-		this->setPixel(x + width - radius + y1, y + radius - x1);
-		this->setPixel(x + width - radius + y1, y + height - radius + x1);
-
-		if (f < 0)
-		{
-			f += (4 * x1 + 6);
-		} else
-		{
-			f += (4 * (x1 - y1) + 10);
-			y1--;
-		}
-		x1++;
-	}
+	this->drawArcs(glcd::Point(x + radius, y + radius),
+				   glcd::Point(x + width - radius, y + height - radius), radius);
 
-	this->drawHorizontalLine(glcd::Point(x + radius, y), width - (2 * radius));
-	this->drawHorizontalLine(glcd::Point(x + radius, y + height), width - (2 * radius));
-	this->drawVerticalLine(glcd::Point(x, y + radius), height - (2 * radius));
-	this->drawVerticalLine(glcd::Point(x + width, y + radius), height - (2 * radius));
+	this->drawHorizontalRun(glcd::Point(x + radius, y), width - (2 * radius));
+	this->drawHorizontalRun(glcd::Point(x + radius, y + height), width - (2 * radius));
+	this->drawVerticalRun(glcd::Point(x, y + radius), height - (2 * radius));
+	this->drawVerticalRun(glcd::Point(x + width, y + radius), height - (2 * radius));
 }
 
 void
@@ -165,19 +182,32 @@ modm::GraphicDisplay::drawCircle(glcd::Point center, uint16_t radius)
 {
 	if (radius == 0) { return; }
 
+	this->drawArcs(center, center, radius);
+}
+
+void
+modm::GraphicDisplay::drawArcs(glcd::Point topLeft, glcd::Point bottomRight, uint16_t radius)
+{
 	int16_t error = -radius;
 	int16_t x = radius;
 	int16_t y = 0;
+	// First y of the run of pixels with the same x
+	int16_t run = 0;
 
 	while (x > y)
 	{
-		this->drawCircle4(center, x, y);
-		this->drawCircle4(center, y, x);
+		const int16_t last = y;
 
 		error += y;
 		++y;
 		error += y;
 
+		if (error >= 0 or x <= y)
+		{
+			this->drawArcRuns(topLeft, bottomRight, x, run, last);
+			run = y;
+		}
+
 		if (error >= 0)
 		{
 			--x;
@@ -185,7 +215,50 @@ modm::GraphicDisplay::drawCircle(glcd::Point center, uint16_t radius)
 			error -= x;
 		}
 	}
-	this->drawCircle4(center, x, y);
+
+	// The last pixel on the diagonal
+	const int16_t left = topLeft.x - x;
+	const int16_t right = bottomRight.x + x;
+	const int16_t top = topLeft.y - y;
+	const int16_t bottom = bottomRight.y + y;
+
+	this->setPixel(right, bottom);
+	this->setPixel(left, top);
+	if (x != 0 or left != right) { this->setPixel(left, bottom); }
+	if (y != 0 or top != bottom) { this->setPixel(right, top); }
+}
+
+void
+modm::GraphicDisplay::drawArcRuns(glcd::Point topLeft, glcd::Point bottomRight, int16_t x,
+								  int16_t y1, int16_t y2)
+{
+	const int16_t length = y2 - y1 + 1;
+
+	// Steep octants are vertical runs left and right of the arc centers
+	if (y1 == 0 and topLeft.y == bottomRight.y)
+	{
+		this->drawVerticalRun(glcd::Point(topLeft.x - x, topLeft.y - y2), 2 * y2 + 1);
+		this->drawVerticalRun(glcd::Point(bottomRight.x + x, topLeft.y - y2), 2 * y2 + 1);
+	} else
+	{
+		this->drawVerticalRun(glcd::Point(topLeft.x - x, topLeft.y - y2), length);
+		this->drawVerticalRun(glcd::Point(topLeft.x - x, bottomRight.y + y1), length);
+		this->drawVerticalRun(glcd::Point(bottomRight.x + x, topLeft.y - y2), length);
+		this->drawVerticalRun(glcd::Point(bottomRight.x + x, bottomRight.y + y1), length);
+	}
+
+	// Flat octants are horizontal runs above and below the arc centers
+	if (y1 == 0 and topLeft.x == bottomRight.x)
+	{
+		this->drawHorizontalRun(glcd::Point(topLeft.x - y2, topLeft.y - x), 2 * y2 + 1);
+		this->drawHorizontalRun(glcd::Point(topLeft.x - y2, bottomRight.y + x), 2 * y2 + 1);
+	} else
+	{
+		this->drawHorizontalRun(glcd::Point(topLeft.x - y2, topLeft.y - x), length);
+		this->drawHorizontalRun(glcd::Point(bottomRight.x + y1, topLeft.y - x), length);
+		this->drawHorizontalRun(glcd::Point(topLeft.x - y2, bottomRight.y + x), length);
+		this->drawHorizontalRun(glcd::Point(bottomRight.x + y1, bottomRight.y + x), length);
+	}
 }
 
 void
@@ -290,3 +363,18 @@ modm::GraphicDisplay::drawImageRaw(glcd::Point start, uint16_t width, uint16_t h
 		}
 	}
 }
+
+void
+modm::GraphicDisplay::drawImageRow(glcd::Point start, uint16_t width, const uint8_t *row)
+{
+	uint16_t x = 0;
+	while (x < width)
+	{
+		const bool set = row[x / 8] & (1 << (x % 8));
+		uint16_t end = x + 1;
+		while (end < width and bool(row[end / 8] & (1 << (end % 8))) == set) { end++; }
+
+		this->drawHorizontalRun(glcd::Point(start.x + x, start.y), end - x, set);
+		x = end;
+	}
+}
@@ -299,6 +299,10 @@ public:
 	/**
 	 * Draw an image.
 	 *
+	 * Set bits are drawn in the foreground, cleared bits in the background
+	 * color. This is also used to blit the glyphs of fonts, so drivers
+	 * should override it to write the whole image into one address window.
+	 *
 	 * \param start		Upper left corner
 	 * \param width		Image width
 	 * \param height	Image height
@@ -362,7 +366,8 @@ public:
 	/**
 	 * Set a new font.
 	 *
-	 * Default font is modm::font::FixedWidth5x8.
+	 * Default font is modm::font::FixedWidth5x8. Fonts in the atlas format
+	 * are detected and drawn row by row with drawImageRow().
 	 *
 	 * \param	newFont	Active font
 	 * \see		modm::font
@@ -404,16 +409,71 @@ public:
 	write(char c);
 
 protected:
-	/// helper method for drawCircle() and drawEllipse()
+	/// helper method for drawEllipse()
 	void
 	drawCircle4(glcd::Point center, int16_t x, int16_t y);
 
+	/// helper method for drawCircle() and drawRoundedRectangle(), draws the
+	/// four quarters of a circle around two centers as horizontal and vertical runs.
+	void
+	drawArcs(glcd::Point topLeft, glcd::Point bottomRight, uint16_t radius);
+
+	/// helper method for drawArcs()
+	void
+	drawArcRuns(glcd::Point topLeft, glcd::Point bottomRight, int16_t x, int16_t y1, int16_t y2);
+
+	/**
+	 * Draw a horizontal run of pixels in the foreground color.
+	 *
+	 * All primitives are rasterized into horizontal and vertical runs
+	 * wherever possible, which are clipped to the display beforehand. The
+	 * default implementation calls setPixel() for every pixel, drivers
+	 * should override it to set an address window once and write all
+	 * pixels in a single burst.
+	 */
 	virtual void
 	drawHorizontalLine(glcd::Point start, uint16_t length);
 
+	/// Draw a vertical run of pixels in the foreground color.
+	/// \see drawHorizontalLine()
 	virtual void
 	drawVerticalLine(glcd::Point start, uint16_t length);
 
+	/// Draw a horizontal run of pixels in the background color.
+	/// \see drawHorizontalLine()
+	virtual void
+	clearHorizontalLine(glcd::Point start, uint16_t length);
+
+	/// Clips the run to the display and draws the visible part with
+	/// drawHorizontalLine(), or clearHorizontalLine() if `set` is false.
+	/// Runs outside of the display are dropped.
+	void
+	drawHorizontalRun(glcd::Point start, int16_t length, bool set = true);
+
+	/// Clips the run to the display and draws the visible part with
+	/// drawVerticalLine().
+	void
+	drawVerticalRun(glcd::Point start, int16_t length);
+
+	/**
+	 * Draw a row of an image packed least significant bit first.
+	 *
+	 * Set bits are drawn in the foreground, cleared bits in the background
+	 * color. This is used to blit the glyphs of atlas fonts, the default
+	 * implementation draws both as horizontal runs. Displays with a
+	 * horizontally packed buffer override it to merge whole bytes.
+	 *
+	 * \param start	Left end of the row
+	 * \param width	Number of pixels
+	 * \param row		Row data in RAM
+	 */
+	virtual void
+	drawImageRow(glcd::Point start, uint16_t width, const uint8_t *row);
+
+	/// helper method for write(), draws a character of an atlas font
+	void
+	drawGlyph(uint16_t offset, uint8_t width);
+
 protected:
 	// Interface class for the IOStream
 	class Writer : public IODevice
@@ -14,14 +14,22 @@
 
 #include "graphic_display.hpp"
 
+#include <algorithm>
+
 // ----------------------------------------------------------------------------
 void
 modm::GraphicDisplay::fillRectangle(glcd::Point start,
 		uint16_t width, uint16_t height)
 {
-	for (uint16_t i = start.x; (i < start.x + width) && (i < getWidth()); ++i)
-		for (uint16_t k = start.y; (k < start.y + height) && (k < getHeight()); ++k)
-			this->setPixel(i, k);
+	// Clip to the display and draw one run per row
+	const int16_t x1 = std::max<int16_t>(start.x, 0);
+	const int16_t x2 = std::min<int16_t>(start.x + width, getWidth());
+	const int16_t y1 = std::max<int16_t>(start.y, 0);
+	const int16_t y2 = std::min<int16_t>(start.y + height, getHeight());
+	if (x1 >= x2) return;
+
+	for (int16_t k = y1; k < y2; ++k)
+		this->drawHorizontalLine(glcd::Point(x1, k), x2 - x1);
 }
 
 void
@@ -33,7 +41,7 @@ modm::GraphicDisplay::fillCircle(glcd::Point center, uint16_t radius)
 	uint16_t x = 0;
 	uint16_t y = radius;
 
-	this->drawVerticalLine(glcd::Point(center.x, center.y - radius), 2 * radius);
+	this->drawVerticalRun(glcd::Point(center.x, center.y - radius), 2 * radius);
 
 	while(x < y)
 	{
@@ -47,9 +55,9 @@ modm::GraphicDisplay::fillCircle(glcd::Point center, uint16_t radius)
 		ddF_x += 2;
 		f += ddF_x + 1;
 
-		this->drawVerticalLine(glcd::Point(center.x + x, center.y - y), 2 * y);
-		this->drawVerticalLine(glcd::Point(center.x + y, center.y - x), 2 * x);
-		this->drawVerticalLine(glcd::Point(center.x - x, center.y - y), 2 * y);
-		this->drawVerticalLine(glcd::Point(center.x - y, center.y - x), 2 * x);
+		this->drawVerticalRun(glcd::Point(center.x + x, center.y - y), 2 * y);
+		this->drawVerticalRun(glcd::Point(center.x + y, center.y - x), 2 * x);
+		this->drawVerticalRun(glcd::Point(center.x - x, center.y - y), 2 * y);
+		this->drawVerticalRun(glcd::Point(center.x - y, center.y - x), 2 * x);
 	}
 }
@@ -13,6 +13,25 @@
 
 #include "graphic_display.hpp"
 
+#include <algorithm>
+
+namespace
+{
+
+// Atlas fonts start with a zero size, which a font in the FontCreator format
+// never has. The remaining header has the same layout in both formats.
+constexpr uint8_t offsetGlyphTable = 8;
+constexpr uint8_t glyphSize = 4;
+constexpr uint8_t flagRunLength = 0x01;
+
+inline bool
+isAtlas(const modm::accessor::Flash<uint8_t> &font)
+{
+	return font[0] == 0 and font[1] == 0;
+}
+
+}
+
 // ----------------------------------------------------------------------------
 uint8_t
 modm::GraphicDisplay::getFontHeight() const
@@ -49,6 +68,19 @@ modm::GraphicDisplay::getStringWidth(const char* s, const modm::accessor::Flash<
 
 	uint16_t width = 0;
 
+	if (isAtlas(*font))
+	{
+		const uint8_t count = (*font)[7];
+		for (; *s; s++)
+		{
+			const uint8_t index = static_cast<uint8_t>(*s) - first;
+			if (index < count) {
+				width += (*font)[offsetGlyphTable + index * glyphSize + 3];
+			}
+		}
+		return width;
+	}
+
 	while(*s) {
 		width += (*font)[offsetWidthTable + (static_cast<uint8_t>(*s) - first)];
 		width += vspace;
@@ -83,6 +115,14 @@ modm::GraphicDisplay::write(char c)
 		return;
 	}
 
+	if (isAtlas(font))
+	{
+		const uint16_t glyph = offsetGlyphTable + (character - first) * glyphSize;
+		this->drawGlyph(font[glyph] | (font[glyph + 1] << 8), font[glyph + 2]);
+		cursor.setX(cursor.x + font[glyph + 3]);
+		return;
+	}
+
 	const uint8_t offsetWidthTable = 8;
 
 	uint16_t offset = count + offsetWidthTable;
@@ -115,6 +155,61 @@ modm::GraphicDisplay::write(char c)
 	}
 }
 
+void
+modm::GraphicDisplay::drawGlyph(uint16_t offset, uint8_t width)
+{
+	const uint8_t height = font[3];
+	const uint8_t count = font[7];
+	const auto data = accessor::asFlash(font.getPointer() + offsetGlyphTable + count * glyphSize + offset);
+	const uint8_t rowSize = (width + 7) / 8;
+	uint8_t row[32];
+
+	if (not (font[2] & flagRunLength))
+	{
+		for (uint8_t y = 0; y < height; y++)
+		{
+			for (uint8_t i = 0; i < rowSize; i++) {
+				row[i] = data[y * rowSize + i];
+			}
+			this->drawImageRow(glcd::Point(cursor.x, cursor.y + y), width, row);
+		}
+		return;
+	}
+
+	// The runs alternate between background and foreground and continue
+	// across the rows, so they are split at the end of each row.
+	uint16_t index = 0;
+	uint8_t remaining = data[index++];
+	bool set = false;
+	for (uint8_t y = 0; y < height; y++)
+	{
+		std::fill_n(row, rowSize, 0);
+		for (uint8_t x = 0; x < width;)
+		{
+			while (remaining == 0)
+			{
+				remaining = data[index++];
+				set = not set;
+			}
+			uint8_t length = std::min<uint8_t>(remaining, width - x);
+			remaining -= length;
+			if (not set)
+			{
+				x += length;
+				continue;
+			}
+			while (length)
+			{
+				const uint8_t bits = std::min<uint8_t>(length, 8 - x % 8);
+				row[x / 8] |= ((1 << bits) - 1) << (x % 8);
+				x += bits;
+				length -= bits;
+			}
+		}
+		this->drawImageRow(glcd::Point(cursor.x, cursor.y + y), width, row);
+	}
+}
+
 // ----------------------------------------------------------------------------
 void
 modm::GraphicDisplay::Writer::write(char c)
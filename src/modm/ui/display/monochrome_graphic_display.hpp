@@ -28,6 +28,12 @@ namespace modm
  * Every operation works on the internal RAM buffer, therefore the content
  * of the real display is not changed until a call of update().
  *
+ * All drawing operations extend a dirty area of the buffer, so that drivers
+ * only need to transfer the changed window to the display. The dirty area
+ * is counted in buffer bytes, i.e. in pages of 8 pixels for vertical and in
+ * columns of 8 pixels for horizontal displays. To profit from this, redraw
+ * only the changed parts of the screen instead of clearing it every frame.
+ *
  * \tparam	Width			Horizontal number of Pixels
  * \tparam	Height			Vertical number of Pixels
  * \tparam	BufferWidth		Horizontal (first) dimension of Buffer
@@ -75,8 +81,55 @@ public:
 	void
 	clear() final;
 
+	/// Area of the buffer changed since the last update in buffer bytes,
+	/// the end coordinates are exclusive.
+	struct DirtyArea
+	{
+		uint16_t x0;
+		uint16_t y0;
+		uint16_t x1;
+		uint16_t y1;
+
+		inline bool
+		isEmpty() const
+		{
+			return (x0 >= x1) or (y0 >= y1);
+		}
+	};
+
+	inline DirtyArea
+	getDirtyArea() const
+	{
+		return dirty;
+	}
+
+	/// Marks the whole buffer as changed, so that the next update()
+	/// transfers all of it, e.g. after the display was reset.
+	inline void
+	invalidate()
+	{
+		dirty = {0, 0, BufferWidth, BufferHeight};
+	}
+
 protected:
+	/// Extends the dirty area by the buffer bytes [x0, x1) x [y0, y1).
+	void
+	markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+	/// Extends the dirty area by a single buffer byte.
+	inline void
+	markDirty(int16_t x, int16_t y)
+	{
+		markDirty(x, y, x + 1, y + 1);
+	}
+
+	/// Returns the dirty area and resets it, to be called by update().
+	DirtyArea
+	takeDirtyArea();
+
 	uint8_t buffer[BufferHeight][BufferWidth]{};
+	// The first update transfers the whole buffer
+	DirtyArea dirty{0, 0, BufferWidth, BufferHeight};
 };
 }  // namespace modm
 
@@ -12,6 +12,7 @@
 #define MODM_MONOCHROME_GRAPHIC_DISPLAY_HORIZONTAL_HPP
 
 #include <stdlib.h>
+#include <algorithm>
 
 #include "monochrome_graphic_display.hpp"
 
@@ -50,6 +51,10 @@ protected:
 
 	bool
 	getPixel(int16_t x, int16_t y) const final;
+
+	// Merges the row bytes into the RAM buffer
+	void
+	drawImageRow(glcd::Point start, uint16_t width, const uint8_t *row) final;
 };
 }  // namespace modm
 
@@ -18,23 +18,64 @@ template<int16_t Width, int16_t Height>
 void
 MonochromeGraphicDisplayHorizontal<Width, Height>::setPixel(int16_t x, int16_t y)
 {
-	if ((x < Width) and (y < Height)) { this->buffer[y][x / 8] |= (1 << (x % 8)); }
+	if ((x >= 0) and (y >= 0) and (x < Width) and (y < Height))
+	{
+		this->buffer[y][x / 8] |= (1 << (x % 8));
+		this->markDirty(x / 8, y);
+	}
 }
 
 template<int16_t Width, int16_t Height>
 void
 MonochromeGraphicDisplayHorizontal<Width, Height>::clearPixel(int16_t x, int16_t y)
 {
-	if ((x < Width) and (y < Height)) { this->buffer[y][x / 8] &= ~(1 << (x % 8)); }
+	if ((x >= 0) and (y >= 0) and (x < Width) and (y < Height))
+	{
+		this->buffer[y][x / 8] &= ~(1 << (x % 8));
+		this->markDirty(x / 8, y);
+	}
 }
 
 template<int16_t Width, int16_t Height>
 bool
 MonochromeGraphicDisplayHorizontal<Width, Height>::getPixel(int16_t x, int16_t y) const
 {
-	if ((x < Width) and (y < Height))
+	if ((x >= 0) and (y >= 0) and (x < Width) and (y < Height))
 		return (this->buffer[y][x / 8] & (1 << (x % 8)));
 	else
 		return false;
 }
+
+template<int16_t Width, int16_t Height>
+void
+MonochromeGraphicDisplayHorizontal<Width, Height>::drawImageRow(glcd::Point start, uint16_t width,
+																const uint8_t *row)
+{
+	if (start.y < 0 or start.y >= Height or width == 0) { return; }
+	if (start.x < 0 or start.x + width > Width)
+	{
+		// Clip the row pixel by pixel
+		for (uint16_t i = 0; i < width; i++)
+		{
+			const int16_t x = start.x + i;
+			if (x < 0 or x >= Width) { continue; }
+			if (row[i / 8] & (1 << (i % 8)))
+				setPixel(x, start.y);
+			else
+				clearPixel(x, start.y);
+		}
+		return;
+	}
+
+	uint8_t *line = this->buffer[start.y] + start.x / 8;
+	const uint8_t shift = start.x % 8;
+	for (uint16_t i = 0; i < width; i += 8, line++)
+	{
+		const uint16_t mask = ((1 << std::min<uint16_t>(width - i, 8)) - 1) << shift;
+		const uint16_t bits = (row[i / 8] << shift) & mask;
+		line[0] = (line[0] & ~mask) | bits;
+		if (mask >> 8) { line[1] = (line[1] & ~(mask >> 8)) | (bits >> 8); }
+	}
+	this->markDirty(start.x / 8, start.y, (start.x + width - 1) / 8 + 1, start.y + 1);
+}
 }  // namespace modm
@@ -24,4 +24,37 @@ modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::clear(
 {
 	std::fill(&buffer[0][0], &buffer[0][0] + sizeof(buffer), 0);
 	this->cursor = modm::glcd::Point{0, 0};
+	invalidate();
+}
+
+template<int16_t Width, int16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+void
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::markDirty(
+	int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	x0 = std::max<int16_t>(x0, 0);
+	y0 = std::max<int16_t>(y0, 0);
+	x1 = std::min<int16_t>(x1, BufferWidth);
+	y1 = std::min<int16_t>(y1, BufferHeight);
+	if (x0 >= x1 or y0 >= y1) { return; }
+
+	if (dirty.isEmpty())
+	{
+		dirty = {uint16_t(x0), uint16_t(y0), uint16_t(x1), uint16_t(y1)};
+	} else
+	{
+		dirty.x0 = std::min<uint16_t>(dirty.x0, x0);
+		dirty.y0 = std::min<uint16_t>(dirty.y0, y0);
+		dirty.x1 = std::max<uint16_t>(dirty.x1, x1);
+		dirty.y1 = std::max<uint16_t>(dirty.y1, y1);
+	}
+}
+
+template<int16_t Width, int16_t Height, std::size_t BufferWidth, std::size_t BufferHeight>
+typename modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::DirtyArea
+modm::MonochromeGraphicDisplay<Width, Height, BufferWidth, BufferHeight>::takeDirtyArea()
+{
+	const DirtyArea area = dirty;
+	dirty = {};
+	return area;
 }
\ No newline at end of file
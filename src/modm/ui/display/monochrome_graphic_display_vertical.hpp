@@ -65,6 +65,10 @@ protected:
 	// Faster version adapted for the RAM buffer
 	void
 	drawVerticalLine(glcd::Point start, uint16_t length) final;
+
+	// Faster version adapted for the RAM buffer
+	void
+	clearHorizontalLine(glcd::Point start, uint16_t length) final;
 };
 }  // namespace modm
 
@@ -26,9 +26,28 @@ modm::MonochromeGraphicDisplayVertical<Width, Height>::drawHorizontalLine(glcd::
 		const int16_t y = start.y / 8;
 
 		const uint8_t byte = 1 << (start.y % 8);
+		this->markDirty(start.x, y, start.x + length, y + 1);
 		for (int_fast16_t x = start.x; x < static_cast<int16_t>(start.x + length); ++x)
 		{
-			if (x < Width) { this->buffer[y][x] |= byte; }
+			if (x >= 0 and x < Width) { this->buffer[y][x] |= byte; }
+		}
+	}
+}
+
+template<int16_t Width, int16_t Height>
+void
+modm::MonochromeGraphicDisplayVertical<Width, Height>::clearHorizontalLine(glcd::Point start,
+																		   uint16_t length)
+{
+	if (start.y >= 0 and start.y < Height)
+	{
+		const int16_t y = start.y / 8;
+
+		const uint8_t byte = ~(1 << (start.y % 8));
+		this->markDirty(start.x, y, start.x + length, y + 1);
+		for (int_fast16_t x = start.x; x < static_cast<int16_t>(start.x + length); ++x)
+		{
+			if (x >= 0 and x < Width) { this->buffer[y][x] &= byte; }
 		}
 	}
 }
@@ -40,12 +59,16 @@ modm::MonochromeGraphicDisplayVertical<Width, Height>::drawVerticalLine(glcd::Po
 {
 	if (start.x >= 0 and start.x < Width)
 	{
-		const int8_t end_y = start.y + length;
+		// Clip to the buffer
+		const int16_t start_y = std::max<int16_t>(start.y, 0);
+		const int16_t end_y = std::min<int32_t>(start.y + length, Height);
+		if (start_y >= end_y) { return; }
 		const uint8_t y_last = end_y / 8;
 
-		uint_fast8_t y = start.y / 8;
+		uint_fast8_t y = start_y / 8;
+		this->markDirty(start.x, y, start.x + 1, (end_y + 7) / 8);
 		// Mask out start
-		uint_fast8_t byte = 0xFF << start.y % 8;
+		uint_fast8_t byte = 0xFF << start_y % 8;
 		while (y != y_last)
 		{
 			if (y < Height / 8)
@@ -76,6 +99,7 @@ modm::MonochromeGraphicDisplayVertical<Width, Height>::drawImageRaw(
 
 		if ((height % 8) == 0)
 		{
+			this->markDirty(start.x, row, start.x + width, row + rowCount);
 			for (uint_fast16_t i = 0; i < width; i++)
 			{
 				for (uint_fast16_t k = 0; k < rowCount; k++)
@@ -83,7 +107,7 @@ modm::MonochromeGraphicDisplayVertical<Width, Height>::drawImageRaw(
 					uint16_t x = start.x + i;
 					uint16_t y = k + row;
 
-					if (x < Width and y < Height)
+					if (x < Width and y < Height / 8)
 					{
 						this->buffer[y][x] = data[i + k * width];
 					}
@@ -100,21 +124,29 @@ template<int16_t Width, int16_t Height>
 void
 modm::MonochromeGraphicDisplayVertical<Width, Height>::setPixel(int16_t x, int16_t y)
 {
-	if (x < Width and y < Height) { this->buffer[y / 8][x] |= (1 << y % 8); }
+	if (x >= 0 and y >= 0 and x < Width and y < Height)
+	{
+		this->buffer[y / 8][x] |= (1 << y % 8);
+		this->markDirty(x, y / 8);
+	}
 }
 
 template<int16_t Width, int16_t Height>
 void
 modm::MonochromeGraphicDisplayVertical<Width, Height>::clearPixel(int16_t x, int16_t y)
 {
-	if (x < Width and y < Height) { this->buffer[y / 8][x] &= ~(1 << y % 8); }
+	if (x >= 0 and y >= 0 and x < Width and y < Height)
+	{
+		this->buffer[y / 8][x] &= ~(1 << y % 8);
+		this->markDirty(x, y / 8);
+	}
 }
 
 template<int16_t Width, int16_t Height>
 bool
 modm::MonochromeGraphicDisplayVertical<Width, Height>::getPixel(int16_t x, int16_t y) const
 {
-	if (x < Width and y < Height)
+	if (x >= 0 and y >= 0 and x < Width and y < Height)
 	{
 		return (this->buffer[y / 8][x] & (1 << y % 8));
 	} else
@@ -16,6 +16,7 @@
 
 #include <modm/ui/display.hpp>
 #include <modm/container/dynamic_array.hpp>
+#include <modm/container/small_dynamic_array.hpp>
 #include <modm/container/linked_list.hpp>
 #include <modm/container/queue.hpp>
 #include <modm/container/doubly_linked_list.hpp>
@@ -41,7 +42,7 @@ class Widget;
 
 /// Container used in view to store widgets
 /// @ingroup modm_ui_gui
-typedef modm::DynamicArray<Widget*> WidgetContainer;
+typedef modm::SmallDynamicArray<Widget*, 4> WidgetContainer;
 /// @ingroup modm_ui_gui
 typedef void (*genericCallback)(void*);
 
@@ -0,0 +1,165 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/driver/atomic/ring.hpp>
+
+#include "atomic_ring_test.hpp"
+
+void
+AtomicRingTest::testSpsc()
+{
+	modm::atomic::SpscRing<int16_t, 4> ring;
+
+	TEST_ASSERT_TRUE(ring.isEmpty());
+	TEST_ASSERT_EQUALS(ring.getMaxSize(), 4);
+
+	TEST_ASSERT_TRUE(ring.push(1));
+	TEST_ASSERT_TRUE(ring.push(2));
+	TEST_ASSERT_TRUE(ring.push(3));
+	TEST_ASSERT_TRUE(ring.push(4));
+	TEST_ASSERT_FALSE(ring.push(5));
+	TEST_ASSERT_TRUE(ring.isFull());
+	TEST_ASSERT_EQUALS(ring.getSize(), 4);
+
+	int16_t value;
+	TEST_ASSERT_EQUALS(ring.get(), 1);
+	TEST_ASSERT_TRUE(ring.pop(value));
+	TEST_ASSERT_EQUALS(value, 1);
+	TEST_ASSERT_TRUE(ring.pop(value));
+	TEST_ASSERT_EQUALS(value, 2);
+
+	TEST_ASSERT_TRUE(ring.push(5));
+	TEST_ASSERT_TRUE(ring.push(6));
+	TEST_ASSERT_TRUE(ring.isFull());
+
+	for (int16_t expected = 3; expected <= 6; expected++)
+	{
+		TEST_ASSERT_TRUE(ring.pop(value));
+		TEST_ASSERT_EQUALS(value, expected);
+	}
+	TEST_ASSERT_FALSE(ring.pop(value));
+	TEST_ASSERT_TRUE(ring.isEmpty());
+}
+
+void
+AtomicRingTest::testSpscBulk()
+{
+	modm::atomic::SpscRing<uint8_t, 8> ring;
+	const uint8_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	uint8_t output[10]{};
+
+	TEST_ASSERT_EQUALS(ring.push(std::span{input, 5}), 5u);
+	TEST_ASSERT_EQUALS(ring.pop(std::span{output, 3}), 3u);
+	TEST_ASSERT_EQUALS(output[0], 1);
+	TEST_ASSERT_EQUALS(output[2], 3);
+
+	// Wraps around and is truncated to the free space
+	TEST_ASSERT_EQUALS(ring.push(std::span{input + 5, 5}), 5u);
+	TEST_ASSERT_EQUALS(ring.push(std::span{input, 5}), 1u);
+	TEST_ASSERT_TRUE(ring.isFull());
+
+	TEST_ASSERT_EQUALS(ring.pop(output), 8u);
+	const uint8_t expected[] = {4, 5, 6, 7, 8, 9, 10, 1};
+	TEST_ASSERT_EQUALS_ARRAY(output, expected, 8);
+	TEST_ASSERT_EQUALS(ring.pop(output), 0u);
+}
+
+void
+AtomicRingTest::testSpscRegion()
+{
+	modm::atomic::SpscRing<uint8_t, 8> ring;
+
+	auto write = ring.getWriteRegion();
+	TEST_ASSERT_EQUALS(write.size(), 8u);
+	for (uint8_t ii = 0; ii < 6; ii++) write[ii] = ii;
+	ring.commitWrite(6);
+
+	auto read = ring.getReadRegion();
+	TEST_ASSERT_EQUALS(read.size(), 6u);
+	TEST_ASSERT_EQUALS(read[5], 5);
+	ring.commitRead(4);
+
+	// The free region is split by the end of the storage
+	write = ring.getWriteRegion();
+	TEST_ASSERT_EQUALS(write.size(), 2u);
+	write[0] = 6; write[1] = 7;
+	ring.commitWrite(2);
+	write = ring.getWriteRegion();
+	TEST_ASSERT_EQUALS(write.size(), 4u);
+	write[0] = 8;
+	ring.commitWrite(1);
+
+	read = ring.getReadRegion();
+	TEST_ASSERT_EQUALS(read.size(), 4u);
+	TEST_ASSERT_EQUALS(read[0], 4);
+	TEST_ASSERT_EQUALS(read[3], 7);
+	ring.commitRead(4);
+	read = ring.getReadRegion();
+	TEST_ASSERT_EQUALS(read.size(), 1u);
+	TEST_ASSERT_EQUALS(read[0], 8);
+}
+
+void
+AtomicRingTest::testMpsc()
+{
+	modm::atomic::MpscRing<int16_t, 4> ring;
+
+	TEST_ASSERT_TRUE(ring.isEmpty());
+	TEST_ASSERT_EQUALS(ring.getMaxSize(), 4);
+
+	int16_t value;
+	TEST_ASSERT_FALSE(ring.pop(value));
+
+	// Several laps to check the sequence numbers
+	for (int16_t lap = 0; lap < 3; lap++)
+	{
+		TEST_ASSERT_TRUE(ring.push(lap + 1));
+		TEST_ASSERT_TRUE(ring.push(lap + 2));
+		TEST_ASSERT_TRUE(ring.push(lap + 3));
+		TEST_ASSERT_TRUE(ring.pop(value));
+		TEST_ASSERT_EQUALS(value, lap + 1);
+		TEST_ASSERT_TRUE(ring.push(lap + 4));
+		TEST_ASSERT_TRUE(ring.push(lap + 5));
+		TEST_ASSERT_FALSE(ring.push(lap + 6));
+		TEST_ASSERT_TRUE(ring.isFull());
+
+		for (int16_t expected = lap + 2; expected <= lap + 5; expected++)
+		{
+			TEST_ASSERT_TRUE(ring.pop(value));
+			TEST_ASSERT_EQUALS(value, expected);
+		}
+		TEST_ASSERT_TRUE(ring.isEmpty());
+	}
+}
+
+void
+AtomicRingTest::testMpscBulk()
+{
+	modm::atomic::MpscRing<uint8_t, 8> ring;
+	const uint8_t input[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	uint8_t output[10]{};
+
+	TEST_ASSERT_EQUALS(ring.push(std::span{input, 6}), 6u);
+	TEST_ASSERT_EQUALS(ring.pop(std::span{output, 5}), 5u);
+	TEST_ASSERT_EQUALS(ring.push(std::span{input + 6, 4}), 4u);
+	TEST_ASSERT_EQUALS(ring.push(std::span{input, 4}), 3u);
+	TEST_ASSERT_EQUALS(ring.push(std::span{input, 4}), 0u);
+
+	// The read region ends at the end of the storage
+	auto read = ring.getReadRegion();
+	TEST_ASSERT_EQUALS(read.size(), 3u);
+	TEST_ASSERT_EQUALS(read[0], 6);
+	TEST_ASSERT_EQUALS(read[2], 8);
+	ring.commitRead(3);
+
+	TEST_ASSERT_EQUALS(ring.pop(output), 5u);
+	const uint8_t expected[] = {9, 10, 1, 2, 3};
+	TEST_ASSERT_EQUALS_ARRAY(output, expected, 5);
+	TEST_ASSERT_TRUE(ring.isEmpty());
+}
@@ -1,6 +1,4 @@
 /*
- * Copyright (c) 2023, Niklas Hauser
- *
  * This file is part of the modm project.
  *
  * This Source Code Form is subject to the terms of the Mozilla Public
@@ -9,23 +7,24 @@
  */
 // ----------------------------------------------------------------------------
 
-#include "scheduler.hpp"
+#include <unittest/testsuite.hpp>
 
-/// @cond
-namespace modm::this_fiber
+/// @ingroup modm_test_test_architecture
+class AtomicRingTest : public unittest::TestSuite
 {
+public:
+	void
+	testSpsc();
 
-void
-yield()
-{
-	modm::fiber::Scheduler::instance().yield();
-}
+	void
+	testSpscBulk();
 
-modm::fiber::id
-get_id()
-{
-	return modm::fiber::Scheduler::instance().get_id();
-}
+	void
+	testSpscRegion();
+
+	void
+	testMpsc();
 
-} // namespace modm::this_fiber
-/// @endcond
+	void
+	testMpscBulk();
+};
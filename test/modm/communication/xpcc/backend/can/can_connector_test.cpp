@@ -257,3 +257,47 @@ CanConnectorTest::testReceiveFragmentedMessage()
 
 	TEST_ASSERT_FALSE(connector->isPacketAvailable());
 }
+
+void
+CanConnectorTest::testReceiveInterleavedFragmentedMessages()
+{
+	// Sources that are a multiple of the number of reassembly slots apart
+	// share the same home slot, so the packets must be probed for.
+	const uint8_t sources[] = {0x34, 0x3c, 0x44, 0x01, 0x09, 0x11, 0x02, 0x35};
+	this->messageCounter = 0x20;
+	modm::can::Message message;
+
+	// send all fragments interleaved, complete the packets in a different
+	// order than they were started
+	for (uint8_t fragment : {1, 0, 2})
+	{
+		for (uint8_t ii = 0; ii < 8; ++ii)
+		{
+			const uint8_t source = sources[(fragment == 2) ? (7 - ii) : ii];
+			createMessage(message, fragment);
+			message.identifier = (fragmentedIdentifier & ~0xff00UL) | (source << 8);
+			// tag the first payload byte with the source
+			if (fragment == 0) message.data[2] = source;
+			driver->receiveList.append(message);
+		}
+		connector->update();
+	}
+
+	for (uint8_t ii = 0; ii < 8; ++ii)
+	{
+		TEST_ASSERT_TRUE(connector->isPacketAvailable());
+
+		const uint8_t source = sources[7 - ii];
+		TEST_ASSERT_EQUALS(connector->getPacketHeader().source, source);
+		TEST_ASSERT_EQUALS(connector->getPacketHeader().packetIdentifier, 0x56);
+		TEST_ASSERT_EQUALS(connector->getPacketPayload().getSize(), sizeof(fragmentedPayload));
+		TEST_ASSERT_EQUALS(connector->getPacketPayload().getPointer()[0], source);
+		TEST_ASSERT_EQUALS_ARRAY(
+				connector->getPacketPayload().getPointer() + 1,
+				fragmentedPayload + 1,
+				sizeof(fragmentedPayload) - 1);
+		connector->dropPacket();
+	}
+	TEST_ASSERT_FALSE(connector->isPacketAvailable());
+	TEST_ASSERT_EQUALS(driver->receiveList.getSize(), 0U);
+}
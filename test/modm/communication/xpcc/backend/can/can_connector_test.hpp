@@ -59,6 +59,9 @@ public:
     void
     testReceiveFragmentedMessage();
 
+    void
+    testReceiveInterleavedFragmentedMessages();
+
 private:
 	TestingCanConnector *connector;
 	modm_test::platform::CanDriver *driver;
@@ -528,3 +528,35 @@ DispatcherTest::testResponseRetransmission()
 
 	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 0U);
 }
+
+void
+DispatcherTest::testManyPendingActions()
+{
+	for (uint8_t id = 0x20; id < 0x40; id++)
+		component1->callAction(10, id);
+
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 32U);
+	backend->messagesSend.removeAll();
+
+	// acknowledge every second action in reverse order
+	for (uint8_t id = 0x3f; id >= 0x20; id -= 2)
+	{
+		backend->messagesToReceive.append(
+				Message(xpcc::Header(xpcc::Header::Type::REQUEST, true, 1, 10, id),
+						modm::SmartPointer()));
+	}
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 0U);
+
+	// only the unacknowledged actions are retransmitted in order
+	test_clock::increment(500);
+	dispatcher->update();
+	TEST_ASSERT_EQUALS(backend->messagesSend.getSize(), 16U);
+	for (uint8_t id = 0x20; id < 0x40; id += 2)
+	{
+		TEST_ASSERT_EQUALS(backend->messagesSend.getFront().header,
+				xpcc::Header(xpcc::Header::Type::REQUEST, false, 10, 1, id));
+		backend->messagesSend.removeFront();
+	}
+}
@@ -112,6 +112,10 @@ public:
 	void
 	testResponseRetransmission();
 
+	// Acknowledges received out of order for many pending actions
+	void
+	testManyPendingActions();
+
 private:
 	xpcc::Dispatcher *dispatcher;
 	FakeBackend *backend;
@@ -0,0 +1,76 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/block_pool.hpp>
+
+#include "block_pool_test.hpp"
+
+void
+BlockPoolTest::testAllocate()
+{
+	modm::BlockPool<6, 3> pool;
+	void *blocks[3];
+	for (auto& block : blocks)
+	{
+		block = pool.allocate();
+		TEST_ASSERT_TRUE(block != nullptr);
+		TEST_ASSERT_TRUE(pool.contains(block));
+		TEST_ASSERT_EQUALS(reinterpret_cast<uintptr_t>(block) % 4, 0u);
+	}
+	TEST_ASSERT_TRUE(blocks[0] != blocks[1]);
+	TEST_ASSERT_TRUE(blocks[1] != blocks[2]);
+	TEST_ASSERT_TRUE(blocks[0] != blocks[2]);
+	TEST_ASSERT_TRUE(pool.allocate() == nullptr);
+
+	int value;
+	TEST_ASSERT_FALSE(pool.contains(&value));
+}
+
+void
+BlockPoolTest::testReuse()
+{
+	modm::BlockPool<4, 2> pool;
+	void *first = pool.allocate();
+	void *second = pool.allocate();
+	TEST_ASSERT_TRUE(pool.allocate() == nullptr);
+
+	pool.deallocate(first);
+	TEST_ASSERT_TRUE(pool.allocate() == first);
+
+	pool.deallocate(second);
+	pool.deallocate(first);
+	// released blocks are reused in LIFO order
+	TEST_ASSERT_TRUE(pool.allocate() == first);
+	TEST_ASSERT_TRUE(pool.allocate() == second);
+	TEST_ASSERT_TRUE(pool.allocate() == nullptr);
+}
+
+void
+BlockPoolTest::testStatistics()
+{
+	modm::BlockPool<12, 4> pool;
+	modm::BlockPoolStatistics stats = pool.getStatistics();
+	TEST_ASSERT_EQUALS(stats.size, 12u);
+	TEST_ASSERT_EQUALS(stats.capacity, 4u);
+	TEST_ASSERT_EQUALS(stats.used, 0u);
+	TEST_ASSERT_EQUALS(stats.highWater, 0u);
+	TEST_ASSERT_EQUALS(stats.exhausted, 0u);
+
+	void *blocks[4];
+	for (auto& block : blocks) block = pool.allocate();
+	pool.allocate();
+	pool.allocate();
+	pool.deallocate(blocks[0]);
+	pool.deallocate(blocks[1]);
+
+	stats = pool.getStatistics();
+	TEST_ASSERT_EQUALS(stats.used, 2u);
+	TEST_ASSERT_EQUALS(stats.highWater, 4u);
+	TEST_ASSERT_EQUALS(stats.exhausted, 2u);
+}
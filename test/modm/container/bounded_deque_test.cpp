@@ -368,3 +368,131 @@ BoundedDequeTest::testElementAccess()
 	TEST_ASSERT_EQUALS(deque.rget(2), 2);
 
 }
+
+void
+BoundedDequeTest::testContiguousFront()
+{
+	modm::BoundedDeque<uint8_t, 5> deque;
+
+	TEST_ASSERT_EQUALS(deque.getContiguousFront().size(), 0U);
+	for (uint8_t ii = 1; ii <= 5; ii++) {
+		deque.append(ii);
+	}
+	TEST_ASSERT_EQUALS(deque.getContiguousFront().size(), 4U);
+	TEST_ASSERT_EQUALS(deque.getContiguousFront()[0], 1);
+	TEST_ASSERT_EQUALS(deque.getContiguousFront()[3], 4);
+
+	deque.consume(4);
+	TEST_ASSERT_EQUALS(deque.getSize(), 1U);
+	TEST_ASSERT_EQUALS(deque.getFront(), 5);
+	TEST_ASSERT_EQUALS(deque.getContiguousFront().size(), 1U);
+
+	// The front wraps around the end of the buffer
+	deque.append(6);
+	deque.append(7);
+	TEST_ASSERT_EQUALS(deque.getContiguousFront().size(), 3U);
+	TEST_ASSERT_EQUALS(deque.getContiguousFront()[0], 5);
+	TEST_ASSERT_EQUALS(deque.getContiguousFront()[2], 7);
+	deque.consume(3);
+	TEST_ASSERT_TRUE(deque.isEmpty());
+}
+
+void
+BoundedDequeTest::testContiguousBack()
+{
+	modm::BoundedDeque<uint8_t, 5> deque;
+
+	std::span<uint8_t> back = deque.getContiguousBack();
+	TEST_ASSERT_EQUALS(back.size(), 4U);
+	back[0] = 1;
+	back[1] = 2;
+	back[2] = 3;
+	deque.commit(3);
+	TEST_ASSERT_EQUALS(deque.getSize(), 3U);
+	TEST_ASSERT_EQUALS(deque.getFront(), 1);
+	TEST_ASSERT_EQUALS(deque.getBack(), 3);
+
+	back = deque.getContiguousBack();
+	TEST_ASSERT_EQUALS(back.size(), 1U);
+	back[0] = 4;
+	deque.commit(1);
+	deque.removeFront();
+
+	// The free space wraps around the end of the buffer
+	back = deque.getContiguousBack();
+	TEST_ASSERT_EQUALS(back.size(), 2U);
+	back[0] = 5;
+	back[1] = 6;
+	deque.commit(2);
+	TEST_ASSERT_TRUE(deque.isFull());
+	TEST_ASSERT_EQUALS(deque.getContiguousBack().size(), 0U);
+
+	for (uint8_t ii = 0; ii < 5; ii++) {
+		TEST_ASSERT_EQUALS(deque[ii], ii + 2);
+	}
+}
+
+void
+BoundedDequeTest::testBulk()
+{
+	modm::BoundedDeque<int16_t, 4> deque;
+	const int16_t values[] = {1, 2, 3, 4, 5, 6};
+
+	TEST_ASSERT_EQUALS(deque.append(std::span{values, 3}), 3U);
+	deque.removeFront(2);
+	TEST_ASSERT_EQUALS(deque.getFront(), 3);
+
+	// Only three values fit, which wrap around
+	TEST_ASSERT_EQUALS(deque.append(std::span{values + 3, 3}), 3U);
+	TEST_ASSERT_EQUALS(deque.append(std::span{values, 1}), 0U);
+	TEST_ASSERT_TRUE(deque.isFull());
+	TEST_ASSERT_EQUALS(deque[0], 3);
+	TEST_ASSERT_EQUALS(deque[3], 6);
+
+	deque.removeBack(2);
+	TEST_ASSERT_EQUALS(deque.getSize(), 2U);
+	TEST_ASSERT_EQUALS(deque.getBack(), 4);
+	TEST_ASSERT_TRUE(deque.append(7));
+	TEST_ASSERT_EQUALS(deque.getBack(), 7);
+
+	deque.removeFront(3);
+	TEST_ASSERT_TRUE(deque.isEmpty());
+}
+
+void
+BoundedDequeTest::testBulkTransfer()
+{
+	modm::BoundedDeque<uint8_t, 100> elementwise;
+	modm::BoundedDeque<uint8_t, 100> bulk;
+	uint8_t input[37];
+	uint32_t checksum1 = 0;
+	uint32_t checksum2 = 0;
+
+	for (uint16_t round = 0; round < 200; round++)
+	{
+		for (uint8_t ii = 0; ii < sizeof(input); ii++) {
+			input[ii] = round + ii;
+		}
+
+		for (uint8_t value : input) {
+			if (not elementwise.append(value)) break;
+		}
+		while (elementwise.getSize() > 30) {
+			checksum1 = checksum1 * 31 + elementwise.getFront();
+			elementwise.removeFront();
+		}
+
+		bulk.append(input);
+		while (bulk.getSize() > 30)
+		{
+			std::span<uint8_t> front = bulk.getContiguousFront();
+			front = front.first(std::min<std::size_t>(front.size(), bulk.getSize() - 30));
+			for (uint8_t value : front) {
+				checksum2 = checksum2 * 31 + value;
+			}
+			bulk.consume(front.size());
+		}
+		TEST_ASSERT_EQUALS(checksum1, checksum2);
+	}
+	TEST_ASSERT_EQUALS(elementwise.getSize(), bulk.getSize());
+}
@@ -46,4 +46,17 @@ public:
 
 	void
 	testElementAccess();
+
+	void
+	testContiguousFront();
+
+	void
+	testContiguousBack();
+
+	void
+	testBulk();
+
+	// Moves a stream through the deque element-wise and in bulk
+	void
+	testBulkTransfer();
 };
@@ -15,6 +15,7 @@
 
 #include <unittest/type/count_type.hpp>
 #include <modm/container/linked_list.hpp>
+#include <modm/container/pool_allocator.hpp>
 
 #include "linked_list_test.hpp"
 
@@ -419,3 +420,32 @@ LinkedListTest::testInsert()
 		ii += 1;
 	}
 }
+
+void
+LinkedListTest::testPoolAllocator()
+{
+	using Allocator = modm::PoolAllocator<int16_t, 3>;
+	modm::LinkedList<int16_t, Allocator> list;
+
+	for (int16_t ii = 0; ii < 5; ii++) {
+		list.append(ii);
+	}
+	// The nodes beyond the pool capacity are allocated on the heap
+	modm::BlockPoolStatistics statistics = Allocator::getStatistics();
+	TEST_ASSERT_EQUALS(statistics.used, 3u);
+	TEST_ASSERT_EQUALS(statistics.exhausted, 2u);
+
+	int16_t ii = 0;
+	for(const auto value : list) {
+		TEST_ASSERT_EQUALS(value, ii++);
+	}
+
+	list.removeFront();
+	list.append(5);
+	TEST_ASSERT_EQUALS(Allocator::getStatistics().used, 3u);
+
+	list.removeAll();
+	statistics = Allocator::getStatistics();
+	TEST_ASSERT_EQUALS(statistics.used, 0u);
+	TEST_ASSERT_EQUALS(statistics.highWater, 3u);
+}
@@ -0,0 +1,172 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/type/count_type.hpp>
+#include <modm/container/small_dynamic_array.hpp>
+
+#include "small_dynamic_array_test.hpp"
+
+using Container = modm::SmallDynamicArray<int16_t, 4>;
+
+void
+SmallDynamicArrayTest::setUp()
+{
+	unittest::CountType::reset();
+}
+
+void
+SmallDynamicArrayTest::testInline()
+{
+	Container array;
+
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 4U);
+
+	for (int16_t ii = 0; ii < 4; ii++) {
+		array.append(ii);
+	}
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getSize(), 4U);
+	TEST_ASSERT_EQUALS(array.getFront(), 0);
+	TEST_ASSERT_EQUALS(array.getBack(), 3);
+
+	array.removeBack();
+	TEST_ASSERT_EQUALS(array.getSize(), 3U);
+	TEST_ASSERT_EQUALS(array.getBack(), 2);
+	TEST_ASSERT_TRUE(array.find(1) == array.begin() + 1);
+	TEST_ASSERT_TRUE(array.find(5) == array.end());
+}
+
+void
+SmallDynamicArrayTest::testGrow()
+{
+	{
+		modm::SmallDynamicArray<unittest::CountType, 2> array;
+		unittest::CountType value;
+
+		array.append(value);
+		array.append(value);
+		TEST_ASSERT_TRUE(array.isInline());
+		TEST_ASSERT_EQUALS(unittest::CountType::numberOfCopyConstructorCalls, 2U);
+
+		// The elements are moved to the heap
+		array.append(value);
+		TEST_ASSERT_FALSE(array.isInline());
+		TEST_ASSERT_EQUALS(array.getSize(), 3U);
+		TEST_ASSERT_EQUALS(array.getCapacity(), 4U);
+	}
+	TEST_ASSERT_EQUALS(unittest::CountType::numberOfDefaultConstructorCalls +
+					   unittest::CountType::numberOfCopyConstructorCalls,
+					   unittest::CountType::numberOfDestructorCalls);
+
+	Container array;
+	for (int16_t ii = 0; ii < 16; ii++) {
+		array.append(ii);
+	}
+	TEST_ASSERT_EQUALS(array.getCapacity(), 16U);
+	for (int16_t ii = 0; ii < 16; ii++) {
+		TEST_ASSERT_EQUALS(array[ii], ii);
+	}
+	// Appending an element of the array itself while growing
+	array.append(array[3]);
+	TEST_ASSERT_EQUALS(array.getCapacity(), 32U);
+	TEST_ASSERT_EQUALS(array.getBack(), 3);
+}
+
+void
+SmallDynamicArrayTest::testConstructors()
+{
+	Container sequence(6, 123);
+	TEST_ASSERT_FALSE(sequence.isInline());
+	TEST_ASSERT_EQUALS(sequence.getSize(), 6U);
+	for (int16_t value : sequence) {
+		TEST_ASSERT_EQUALS(value, 123);
+	}
+
+	Container list{1, 2, 3};
+	TEST_ASSERT_TRUE(list.isInline());
+	TEST_ASSERT_EQUALS(list.getSize(), 3U);
+	TEST_ASSERT_EQUALS(list[2], 3);
+}
+
+void
+SmallDynamicArrayTest::testCopyAndMove()
+{
+	Container small{1, 2};
+	Container large{1, 2, 3, 4, 5, 6};
+
+	Container copy(large);
+	TEST_ASSERT_EQUALS(copy.getSize(), 6U);
+	TEST_ASSERT_EQUALS(copy[5], 6);
+	TEST_ASSERT_TRUE(copy.begin() != large.begin());
+
+	Container moved(std::move(large));
+	TEST_ASSERT_EQUALS(moved.getSize(), 6U);
+	TEST_ASSERT_TRUE(large.isEmpty());
+	TEST_ASSERT_TRUE(large.isInline());
+
+	Container movedSmall(std::move(small));
+	TEST_ASSERT_TRUE(movedSmall.isInline());
+	TEST_ASSERT_EQUALS(movedSmall[1], 2);
+
+	copy = movedSmall;
+	TEST_ASSERT_EQUALS(copy.getSize(), 2U);
+	TEST_ASSERT_EQUALS(copy[0], 1);
+
+	movedSmall = std::move(moved);
+	TEST_ASSERT_EQUALS(movedSmall.getSize(), 6U);
+	TEST_ASSERT_FALSE(movedSmall.isInline());
+	TEST_ASSERT_EQUALS(movedSmall[4], 5);
+}
+
+void
+SmallDynamicArrayTest::testInsertErase()
+{
+	Container array{1, 2, 4};
+
+	auto it = array.insert(array.begin() + 2, 3);
+	TEST_ASSERT_EQUALS(*it, 3);
+	TEST_ASSERT_TRUE(array.isInline());
+
+	// Grows the array
+	it = array.insert(array.begin(), 0);
+	TEST_ASSERT_EQUALS(*it, 0);
+	it = array.insert(array.end(), 5);
+	TEST_ASSERT_EQUALS(*it, 5);
+	TEST_ASSERT_EQUALS(array.getSize(), 6U);
+	for (int16_t ii = 0; ii < 6; ii++) {
+		TEST_ASSERT_EQUALS(array[ii], ii);
+	}
+
+	it = array.erase(array.begin() + 1);
+	TEST_ASSERT_EQUALS(*it, 2);
+	it = array.erase(array.end() - 1);
+	TEST_ASSERT_TRUE(it == array.end());
+	TEST_ASSERT_EQUALS(array.getSize(), 4U);
+	TEST_ASSERT_EQUALS(array[0], 0);
+	TEST_ASSERT_EQUALS(array[3], 4);
+}
+
+void
+SmallDynamicArrayTest::testClear()
+{
+	Container array{1, 2, 3, 4, 5};
+	TEST_ASSERT_FALSE(array.isInline());
+
+	array.removeAll();
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_FALSE(array.isInline());
+
+	array.append(1);
+	array.clear();
+	TEST_ASSERT_TRUE(array.isEmpty());
+	TEST_ASSERT_TRUE(array.isInline());
+	TEST_ASSERT_EQUALS(array.getCapacity(), 4U);
+}
@@ -0,0 +1,106 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/container/smart_pointer.hpp>
+
+#include "smart_pointer_test.hpp"
+#include <vector>
+
+namespace
+{
+struct Payload
+{
+	uint32_t a;
+	uint16_t b;
+	uint8_t c;
+} modm_packed;
+}
+
+void
+SmartPointerTest::testEmpty()
+{
+	modm::SmartPointer ptr;
+	TEST_ASSERT_EQUALS(ptr.getSize(), 0u);
+	TEST_ASSERT_TRUE(ptr.getPointer() != nullptr);
+
+	modm::SmartPointer ptr2(uint16_t(0));
+	TEST_ASSERT_EQUALS(ptr2.getSize(), 0u);
+	// empty payloads share the same storage
+	TEST_ASSERT_TRUE(ptr == ptr2);
+}
+
+void
+SmartPointerTest::testPayload()
+{
+	const Payload payload{0x12345678, 0xabcd, 0x42};
+	modm::SmartPointer ptr(&payload);
+	TEST_ASSERT_EQUALS(ptr.getSize(), sizeof(Payload));
+	TEST_ASSERT_EQUALS(ptr.get<Payload>().a, 0x12345678u);
+	TEST_ASSERT_EQUALS(ptr.get<Payload>().b, 0xabcdu);
+	TEST_ASSERT_EQUALS(ptr.get<Payload>().c, 0x42u);
+
+	uint32_t wrong;
+	TEST_ASSERT_FALSE(ptr.get(wrong));
+	Payload value{};
+	TEST_ASSERT_TRUE(ptr.get(value));
+	TEST_ASSERT_EQUALS(value.a, 0x12345678u);
+
+	modm::SmartPointer large(uint16_t(200));
+	TEST_ASSERT_EQUALS(large.getSize(), 200u);
+	large.getPointer()[199] = 0x55;
+	TEST_ASSERT_EQUALS(large.getPointer()[199], 0x55);
+}
+
+void
+SmartPointerTest::testCopy()
+{
+	const uint16_t data = 0x1234;
+	modm::SmartPointer ptr(&data);
+	{
+		modm::SmartPointer copy(ptr);
+		TEST_ASSERT_TRUE(copy == ptr);
+
+		modm::SmartPointer other;
+		other = copy;
+		TEST_ASSERT_TRUE(other == ptr);
+
+		const modm::SmartPointer& self = other;
+		other = self;
+		TEST_ASSERT_EQUALS(other.get<uint16_t>(), 0x1234u);
+	}
+	TEST_ASSERT_EQUALS(ptr.get<uint16_t>(), 0x1234u);
+
+	modm::SmartPointer empty;
+	ptr = empty;
+	TEST_ASSERT_EQUALS(ptr.getSize(), 0u);
+}
+
+void
+SmartPointerTest::testPool()
+{
+	if (modm::SmartPointer::getPoolCount() == 0) return;
+
+	const modm::BlockPoolStatistics before = modm::SmartPointer::getPoolStatistics(0);
+	const uint16_t size = before.size - 4;
+	{
+		modm::SmartPointer ptr(size);
+		modm::SmartPointer copy(ptr);
+		TEST_ASSERT_EQUALS(modm::SmartPointer::getPoolStatistics(0).used, before.used + 1);
+	}
+	TEST_ASSERT_EQUALS(modm::SmartPointer::getPoolStatistics(0).used, before.used);
+	TEST_ASSERT_TRUE(modm::SmartPointer::getPoolStatistics(0).highWater > before.used);
+
+	// exhausting the pool falls back to larger pools or the heap
+	std::vector<modm::SmartPointer> ptrs;
+	for (uint16_t ii = before.used; ii <= before.capacity; ii++)
+		ptrs.emplace_back(size);
+	for (auto& ptr : ptrs) TEST_ASSERT_EQUALS(ptr.getSize(), size);
+	TEST_ASSERT_EQUALS(modm::SmartPointer::getPoolStatistics(0).used, before.capacity);
+	TEST_ASSERT_TRUE(modm::SmartPointer::getPoolStatistics(0).exhausted > before.exhausted);
+}
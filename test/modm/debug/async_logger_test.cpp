@@ -0,0 +1,272 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug/logger/async.hpp>
+#include <modm-test/mock/clock.hpp>
+#include <modm-test/mock/iodevice.hpp>
+
+#include "async_logger_test.hpp"
+
+using test_clock = modm_test::chrono::milli_clock;
+
+namespace
+{
+	// Gives access to the record headers
+	class TestBuffer : public modm::log::AsyncBuffer
+	{
+	public:
+		using AsyncBuffer::AsyncBuffer;
+		using AsyncBuffer::header;
+	};
+
+	bool
+	write(modm::log::AsyncBuffer& buffer, const char* str)
+	{
+		return buffer.write(std::span{reinterpret_cast<const uint8_t*>(str), std::strlen(str)});
+	}
+
+	bool
+	isCleared(const uint32_t* words, std::size_t size)
+	{
+		return std::all_of(words, words + size, [](uint32_t word) { return word == 0; });
+	}
+}
+
+void
+AsyncLoggerTest::testBufferDrain()
+{
+	uint32_t words[8]{};
+	modm::log::AsyncBuffer buffer{words};
+	modm_test::platform::IODevice device;
+	device.clear();
+
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+	TEST_ASSERT_EQUALS(buffer.drain(device), 0u);
+
+	// 1+2 and 1+1 words
+	TEST_ASSERT_TRUE(write(buffer, "hello"));
+	TEST_ASSERT_TRUE(write(buffer, "ab"));
+	TEST_ASSERT_FALSE(buffer.isEmpty());
+
+	TEST_ASSERT_EQUALS(buffer.drain(device), 2u);
+	TEST_ASSERT_EQUALS(device.writeCalls, 2u);
+	TEST_ASSERT_EQUALS(device.bytesWritten, 7u);
+	TEST_ASSERT_EQUALS_ARRAY(device.buffer, "helloab", 7);
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+	TEST_ASSERT_TRUE(isCleared(words, 8));
+	TEST_ASSERT_EQUALS(buffer.getDropped(), 0u);
+}
+
+void
+AsyncLoggerTest::testBufferPadding()
+{
+	uint32_t words[8]{};
+	modm::log::AsyncBuffer buffer{words};
+	modm_test::platform::IODevice device;
+	device.clear();
+
+	// Move the head to word 7
+	TEST_ASSERT_TRUE(write(buffer, "0123456789ab"));
+	TEST_ASSERT_TRUE(write(buffer, "01234567"));
+	TEST_ASSERT_EQUALS(buffer.drain(device), 2u);
+	device.clear();
+
+	// The record does not fit into the last word, so a padding record is
+	// placed in front of it and the record starts at the beginning
+	TEST_ASSERT_TRUE(write(buffer, "wrap"));
+	TEST_ASSERT_EQUALS(words[7], 0xc000'0001u);
+	TEST_ASSERT_EQUALS(words[0], 0x8000'0004u);
+	TEST_ASSERT_EQUALS(words[1], 0x70617277u);
+
+	// Padding is not written to the device
+	TEST_ASSERT_EQUALS(buffer.drain(device), 1u);
+	TEST_ASSERT_EQUALS(device.writeCalls, 1u);
+	TEST_ASSERT_EQUALS(device.bytesWritten, 4u);
+	TEST_ASSERT_EQUALS_ARRAY(device.buffer, "wrap", 4);
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+	TEST_ASSERT_TRUE(isCleared(words, 8));
+	TEST_ASSERT_EQUALS(buffer.getDropped(), 0u);
+}
+
+void
+AsyncLoggerTest::testBufferDropWhenFull()
+{
+	uint32_t words[8]{};
+	modm::log::AsyncBuffer buffer{words};
+	modm_test::platform::IODevice device;
+	device.clear();
+
+	// One word is kept free, so only three records of two words fit
+	TEST_ASSERT_TRUE(write(buffer, "aaaa"));
+	TEST_ASSERT_TRUE(write(buffer, "bbbb"));
+	TEST_ASSERT_TRUE(write(buffer, "cccc"));
+	TEST_ASSERT_FALSE(write(buffer, "dddd"));
+	TEST_ASSERT_FALSE(write(buffer, "e"));
+	TEST_ASSERT_EQUALS(buffer.getDropped(), 2u);
+
+	TEST_ASSERT_EQUALS(buffer.drain(device), 3u);
+	TEST_ASSERT_EQUALS_ARRAY(device.buffer, "aaaabbbbcccc", 12);
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+
+	// The empty ring could hold seven words at the start, however the
+	// padding of the two words at the end counts against the free space
+	TEST_ASSERT_FALSE(write(buffer, "0123456789abcdefghijklmn"));
+	TEST_ASSERT_EQUALS(buffer.getDropped(), 3u);
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+	TEST_ASSERT_TRUE(write(buffer, "0123456789abcdef"));
+	TEST_ASSERT_EQUALS(buffer.getDropped(), 3u);
+
+	device.clear();
+	TEST_ASSERT_EQUALS(buffer.drain(device), 1u);
+	TEST_ASSERT_EQUALS(device.bytesWritten, 16u);
+	TEST_ASSERT_EQUALS_ARRAY(device.buffer, "0123456789abcdef", 16);
+	TEST_ASSERT_TRUE(isCleared(words, 8));
+}
+
+void
+AsyncLoggerTest::testBufferUnpublished()
+{
+	uint32_t words[8]{};
+	TestBuffer buffer{words};
+	modm_test::platform::IODevice device;
+	device.clear();
+
+	TEST_ASSERT_TRUE(write(buffer, "one"));
+	TEST_ASSERT_TRUE(write(buffer, "two"));
+
+	// Simulates a producer that reserved the first record, but was
+	// interrupted before publishing it
+	const uint32_t header = buffer.header(0).load();
+	buffer.header(0).store(0);
+	TEST_ASSERT_EQUALS(buffer.drain(device), 0u);
+	TEST_ASSERT_EQUALS(device.writeCalls, 0u);
+	TEST_ASSERT_FALSE(buffer.isEmpty());
+
+	buffer.header(0).store(header);
+	TEST_ASSERT_EQUALS(buffer.drain(device), 2u);
+	TEST_ASSERT_EQUALS_ARRAY(device.buffer, "onetwo", 6);
+	TEST_ASSERT_TRUE(buffer.isEmpty());
+}
+
+void
+AsyncLoggerTest::testRateLimit()
+{
+	test_clock::setTime(0);
+
+	// Disabled
+	modm::log::RateLimit unlimited;
+	for (int ii = 0; ii < 100; ii++) {
+		TEST_ASSERT_TRUE(unlimited.acquire());
+	}
+
+	// One token every 100ms, starting with a full bucket
+	modm::log::RateLimit limit{10, 3};
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_FALSE(limit.acquire());
+
+	// Partial tokens are kept across calls
+	test_clock::increment(60);
+	TEST_ASSERT_FALSE(limit.acquire());
+	test_clock::increment(39);
+	TEST_ASSERT_FALSE(limit.acquire());
+	test_clock::increment(1);
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_FALSE(limit.acquire());
+
+	test_clock::increment(250);
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_FALSE(limit.acquire());
+	test_clock::increment(50);
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_FALSE(limit.acquire());
+
+	// The bucket does not fill beyond the burst
+	test_clock::increment(10'000);
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_TRUE(limit.acquire());
+	TEST_ASSERT_FALSE(limit.acquire());
+
+	// Rate above 1000/s refills multiple tokens per millisecond
+	modm::log::RateLimit fast{5000, 10};
+	for (int ii = 0; ii < 10; ii++) {
+		TEST_ASSERT_TRUE(fast.acquire());
+	}
+	TEST_ASSERT_FALSE(fast.acquire());
+	test_clock::increment(1);
+	for (int ii = 0; ii < 5; ii++) {
+		TEST_ASSERT_TRUE(fast.acquire());
+	}
+	TEST_ASSERT_FALSE(fast.acquire());
+}
+
+void
+AsyncLoggerTest::testRateLimitOverflow()
+{
+	// The maximum rate and burst do not overflow the token count
+	test_clock::setTime(0);
+	modm::log::RateLimit limit{0xffff, 0xffff};
+	for (uint32_t ii = 0; ii < 0xffff; ii++) {
+		if (not limit.acquire()) {
+			TEST_FAIL("Bucket must hold the whole burst");
+			break;
+		}
+	}
+	TEST_ASSERT_FALSE(limit.acquire());
+	test_clock::increment(100'000);
+	TEST_ASSERT_TRUE(limit.acquire());
+
+	// The elapsed time is computed across the overflow of the clock
+	modm::log::RateLimit slow{10, 1};
+	test_clock::setTime(0xffff'ff00);
+	TEST_ASSERT_TRUE(slow.acquire());
+	TEST_ASSERT_FALSE(slow.acquire());
+	test_clock::increment(0x100 - 2);
+	TEST_ASSERT_TRUE(slow.acquire());
+	TEST_ASSERT_FALSE(slow.acquire());
+	test_clock::increment(99);
+	TEST_ASSERT_FALSE(slow.acquire());
+	test_clock::increment(1);
+	TEST_ASSERT_TRUE(slow.acquire());
+}
+
+void
+AsyncLoggerTest::testDevice()
+{
+	test_clock::setTime(0);
+	uint32_t words[16]{};
+	modm::log::AsyncBuffer buffer{words};
+	modm::log::AsyncDevice async{buffer, modm::log::RateLimit{1, 1}};
+	modm_test::platform::IODevice device;
+	device.clear();
+
+	async.write("a");
+	async.write('b');
+	async.write("\n");
+	// No token left, the whole line is discarded
+	async.write("c");
+	async.write("d\n");
+	TEST_ASSERT_EQUALS(async.getLimited(), 1u);
+
+	test_clock::increment(1000);
+	async.write("e\n");
+	async.write("");
+	TEST_ASSERT_EQUALS(async.getLimited(), 1u);
+	async.write("f\n");
+	TEST_ASSERT_EQUALS(async.getLimited(), 2u);
+
+	// Every write is one record
+	TEST_ASSERT_EQUALS(buffer.drain(device), 4u);
+	TEST_ASSERT_EQUALS(device.bytesWritten, 5u);
+	TEST_ASSERT_EQUALS_ARRAY(device.buffer, "ab\ne\n", 5);
+	TEST_ASSERT_EQUALS(buffer.getDropped(), 0u);
+}
@@ -0,0 +1,198 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/debug/binary_logger.hpp>
+#include <modm-test/mock/clock.hpp>
+#include <modm-test/mock/iodevice.hpp>
+
+#include "binary_logger_test.hpp"
+
+using test_clock = modm_test::chrono::micro_clock;
+
+namespace
+{
+	// Record with a 4 byte argument, 14 bytes in total
+	constexpr std::size_t RecordSize = 14;
+
+	void
+	writeRecord(modm::log::BinaryLogger& logger, uint32_t value)
+	{
+		logger.write<0x11223344>(value);
+	}
+
+	// Checks a record as written by writeRecord()
+	bool
+	isRecord(const uint8_t* data, uint32_t time, uint32_t value)
+	{
+		const uint8_t expected[RecordSize] = {
+			0x44, 0x33, 0x22, 0x11,
+			uint8_t(time), uint8_t(time >> 8), uint8_t(time >> 16), uint8_t(time >> 24),
+			4, 0,
+			uint8_t(value), uint8_t(value >> 8), uint8_t(value >> 16), uint8_t(value >> 24)};
+		return std::memcmp(data, expected, RecordSize) == 0;
+	}
+}
+
+void
+BinaryLoggerTest::testRecordLayout()
+{
+	uint8_t buffer[128];
+	modm::log::BinaryLogger logger{buffer};
+	TEST_ASSERT_EQUALS(logger.getSize(), 0u);
+
+	test_clock::setTime(0x0a0b0c0d);
+	logger.write<0xdeadbeef>(uint16_t(0x1234), "abc", int8_t(-2), true);
+
+	const uint8_t expected[] = {
+		0xef, 0xbe, 0xad, 0xde,		// ID
+		0x0d, 0x0c, 0x0b, 0x0a,		// timestamp
+		8, 0,						// length of the arguments
+		0x34, 0x12,					// uint16_t
+		3, 'a', 'b', 'c',			// string
+		0xfe,						// int8_t
+		1};							// bool
+	TEST_ASSERT_EQUALS(logger.getSize(), sizeof(expected));
+
+	uint8_t data[128]{};
+	TEST_ASSERT_EQUALS(logger.read(data), sizeof(expected));
+	TEST_ASSERT_EQUALS_ARRAY(data, expected, sizeof(expected));
+	TEST_ASSERT_EQUALS(logger.getSize(), 0u);
+	TEST_ASSERT_EQUALS(logger.read(data), 0u);
+
+	// Strings are truncated
+	const char long_string[] = "0123456789012345678901234567890123456789012345678901234567890123456789";
+	logger.write<0>(long_string);
+	TEST_ASSERT_EQUALS(logger.read(data), 10u + 1 + 63);
+	TEST_ASSERT_EQUALS(data[8], 64);
+	TEST_ASSERT_EQUALS(data[10], 63);
+	TEST_ASSERT_EQUALS(std::memcmp(data + 11, long_string, 63), 0);
+	TEST_ASSERT_EQUALS(logger.getDropped(), 0u);
+}
+
+void
+BinaryLoggerTest::testSplitRead()
+{
+	uint8_t buffer[64];
+	modm::log::BinaryLogger logger{buffer};
+
+	test_clock::setTime(100);
+	writeRecord(logger, 0xcafe);
+	test_clock::setTime(200);
+	writeRecord(logger, 0xf00d);
+	TEST_ASSERT_EQUALS(logger.getSize(), 2 * RecordSize);
+
+	// Read in chunks that do not align with the records
+	uint8_t data[2 * RecordSize];
+	std::size_t count{0};
+	for (const std::size_t chunk : {3u, 8u, 5u, 100u})
+	{
+		const std::size_t read = logger.read({data + count, std::min(chunk, sizeof(data) - count)});
+		TEST_ASSERT_EQUALS(read, std::min(chunk, sizeof(data) - count));
+		count += read;
+		TEST_ASSERT_EQUALS(logger.getSize(), sizeof(data) - count);
+	}
+	TEST_ASSERT_EQUALS(count, sizeof(data));
+	TEST_ASSERT_TRUE(isRecord(data, 100, 0xcafe));
+	TEST_ASSERT_TRUE(isRecord(data + RecordSize, 200, 0xf00d));
+}
+
+void
+BinaryLoggerTest::testDropWhenFull()
+{
+	// One byte is kept free, so only two records fit
+	uint8_t buffer[2 * RecordSize + 1];
+	modm::log::BinaryLogger logger{buffer};
+
+	test_clock::setTime(1);
+	writeRecord(logger, 1);
+	writeRecord(logger, 2);
+	TEST_ASSERT_EQUALS(logger.getDropped(), 0u);
+	writeRecord(logger, 3);
+	writeRecord(logger, 4);
+	TEST_ASSERT_EQUALS(logger.getDropped(), 2u);
+	TEST_ASSERT_EQUALS(logger.getSize(), 2 * RecordSize);
+
+	// Records are dropped as a whole, even if part of them would fit
+	uint8_t data[RecordSize];
+	TEST_ASSERT_EQUALS(logger.read({data, 4}), 4u);
+	writeRecord(logger, 5);
+	TEST_ASSERT_EQUALS(logger.getDropped(), 3u);
+
+	TEST_ASSERT_EQUALS(logger.read({data + 4, RecordSize - 4}), RecordSize - 4);
+	TEST_ASSERT_TRUE(isRecord(data, 1, 1));
+	writeRecord(logger, 6);
+	TEST_ASSERT_EQUALS(logger.getDropped(), 3u);
+
+	TEST_ASSERT_EQUALS(logger.read(data), RecordSize);
+	TEST_ASSERT_TRUE(isRecord(data, 1, 2));
+	TEST_ASSERT_EQUALS(logger.read(data), RecordSize);
+	TEST_ASSERT_TRUE(isRecord(data, 1, 6));
+	TEST_ASSERT_EQUALS(logger.getSize(), 0u);
+}
+
+void
+BinaryLoggerTest::testWrapAround()
+{
+	uint8_t buffer[32];
+	modm::log::BinaryLogger logger{buffer};
+	uint8_t data[RecordSize];
+
+	// Walk the records around the ring several times, so that they are
+	// split at every offset of the buffer
+	uint32_t written{0}, read{0};
+	for (int ii = 0; ii < 40; ii++)
+	{
+		test_clock::setTime(written * 1000);
+		writeRecord(logger, 0x10000 + written++);
+		test_clock::setTime(written * 1000);
+		writeRecord(logger, 0x10000 + written++);
+		TEST_ASSERT_EQUALS(logger.getSize(), 2 * RecordSize);
+
+		for (int jj = 0; jj < 2; jj++)
+		{
+			// Split the read at a different point for every record
+			const std::size_t split = (ii + jj) % RecordSize;
+			TEST_ASSERT_EQUALS(logger.read({data, split}), split);
+			TEST_ASSERT_EQUALS(logger.read({data + split, RecordSize - split}), RecordSize - split);
+			TEST_ASSERT_TRUE(isRecord(data, read * 1000, 0x10000 + read));
+			read++;
+		}
+	}
+	TEST_ASSERT_EQUALS(logger.getSize(), 0u);
+	TEST_ASSERT_EQUALS(logger.getDropped(), 0u);
+}
+
+void
+BinaryLoggerTest::testDrain()
+{
+	uint8_t buffer[32];
+	modm::log::BinaryLogger logger{buffer};
+	modm_test::platform::IODevice device;
+
+	// Move the ring position close to the end of the buffer
+	test_clock::setTime(7);
+	writeRecord(logger, 0);
+	writeRecord(logger, 0);
+	uint8_t data[2 * RecordSize];
+	TEST_ASSERT_EQUALS(logger.read(data), 2 * RecordSize);
+
+	// The first record is split at the end of the buffer
+	writeRecord(logger, 0xabc);
+	writeRecord(logger, 0xdef);
+	logger.drain(device);
+	TEST_ASSERT_EQUALS(device.bytesWritten, 2 * RecordSize);
+	TEST_ASSERT_EQUALS(device.writeCalls, 2u);
+	TEST_ASSERT_TRUE(isRecord(reinterpret_cast<uint8_t*>(device.buffer), 7, 0xabc));
+	TEST_ASSERT_TRUE(isRecord(reinterpret_cast<uint8_t*>(device.buffer) + RecordSize, 7, 0xdef));
+	TEST_ASSERT_EQUALS(logger.getSize(), 0u);
+
+	// Nothing is written when empty
+	logger.drain(device);
+	TEST_ASSERT_EQUALS(device.writeCalls, 2u);
+}
@@ -623,3 +623,27 @@ IoStreamTest::testPointer()
 	TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, bytesWritten);
 	TEST_ASSERT_EQUALS(device.bytesWritten, bytesWritten);
 }
+
+void
+IoStreamTest::testBlockWrite()
+{
+	// formatted values are passed to the device in one call
+	(*stream) << int32_t(-1234567);
+	TEST_ASSERT_EQUALS_ARRAY("-1234567", device.buffer, 8);
+	TEST_ASSERT_EQUALS(device.writeCalls, 1U);
+
+	device.clear();
+	(*stream) << modm::hex << uint32_t(0x12AB34CD) << modm::ascii;
+	TEST_ASSERT_EQUALS_ARRAY("12AB34CD", device.buffer, 8);
+	TEST_ASSERT_EQUALS(device.writeCalls, 1U);
+
+	device.clear();
+	(*stream) << modm::bin << uint16_t(0x8001) << modm::ascii;
+	TEST_ASSERT_EQUALS_ARRAY("1000000000000001", device.buffer, 16);
+	TEST_ASSERT_EQUALS(device.writeCalls, 1U);
+
+	device.clear();
+	(*stream).printf("%s = %d;", "abc", 42);
+	TEST_ASSERT_EQUALS_ARRAY("abc = 42;", device.buffer, 9);
+	TEST_ASSERT_EQUALS(device.writeCalls, 1U);
+}
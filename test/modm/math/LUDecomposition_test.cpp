@@ -74,3 +74,66 @@ LUDecompositionTest::testLUD()
 	TEST_ASSERT_EQUALS(b[2][0],  4.f);
 }
 
+void
+LUDecompositionTest::testInPlace()
+{
+	const float m[] = {
+		1.f, 2.f, 3.f,
+		0.f, 1.f, 2.f,
+		3.f, 4.f, 6.f
+	};
+
+	// the in place decomposition matches the separate matrices
+	modm::Matrix<float, 3, 3> lu(m);
+	modm::Vector<int8_t, 3> p;
+	TEST_ASSERT_TRUE(modm::LUDecomposition::decompose(&lu, &p));
+
+	modm::Matrix<float, 3, 3> l;
+	modm::Matrix<float, 3, 3> u;
+	modm::Vector<int8_t, 3> pv;
+	TEST_ASSERT_TRUE(modm::LUDecomposition::decompose(modm::Matrix<float, 3, 3>(m), &l, &u, &pv));
+	for (uint_fast8_t i = 0; i < 3; ++i)
+	{
+		TEST_ASSERT_EQUALS(p[i], pv[i]);
+		for (uint_fast8_t j = 0; j < 3; ++j)
+		{
+			if (j <= i) {
+				TEST_ASSERT_EQUALS(lu[i][j], l[i][j]);
+			} else {
+				TEST_ASSERT_EQUALS(lu[i][j], u[i][j]);
+			}
+		}
+	}
+
+	const float n[] = {
+		0.f,
+		1.f,
+		2.f
+	};
+	modm::Matrix<float, 3, 1> b(n);
+	TEST_ASSERT_TRUE(modm::LUDecomposition::solve(lu, p, &b));
+	TEST_ASSERT_EQUALS(b[0][0],  2.f);
+	TEST_ASSERT_EQUALS(b[1][0], -7.f);
+	TEST_ASSERT_EQUALS(b[2][0],  4.f);
+
+	// inverse of a larger matrix
+	modm::Matrix<double, 12, 12> A;
+	for (uint_fast8_t i = 0; i < 12; ++i) {
+		for (uint_fast8_t j = 0; j < 12; ++j) {
+			A[i][j] = (i == j) ? 20 : ((i * 5 + j * 3) % 7) - 3;
+		}
+	}
+	modm::Matrix<double, 12, 12> AI = modm::Matrix<double, 12, 12>::identityMatrix();
+	TEST_ASSERT_TRUE(modm::LUDecomposition::solve(A, &AI));
+	const modm::Matrix<double, 12, 12> E = A * AI;
+	for (uint_fast8_t i = 0; i < 12; ++i) {
+		for (uint_fast8_t j = 0; j < 12; ++j) {
+			TEST_ASSERT_EQUALS_DELTA(E[i][j], (i == j) ? 1.0 : 0.0, 1e-12);
+		}
+	}
+
+	// singular matrices are detected
+	modm::Matrix<float, 3, 3> s = modm::Matrix<float, 3, 3>::zeroMatrix();
+	s[0][0] = 1;
+	TEST_ASSERT_FALSE(modm::LUDecomposition::decompose(&s, &p));
+}
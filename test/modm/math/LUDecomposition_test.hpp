@@ -16,4 +16,7 @@ class LUDecompositionTest : public unittest::TestSuite
 public:
 	void
 	testLUD();
+
+	void
+	testInPlace();
 };
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/filter/biquad.hpp>
+
+#include "biquad_test.hpp"
+
+using Biquad = modm::filter::Biquad<double>;
+
+void
+BiquadTest::testDirectForm()
+{
+	// Compare with the difference equation in direct form I
+	const Biquad::Coefficients c{0.2, 0.3, 0.1, -0.5, 0.25};
+	Biquad filter({c});
+
+	double x[3] = {0, 0, 0};
+	double y[3] = {0, 0, 0};
+	for (int n = 0; n < 50; ++n)
+	{
+		x[2] = x[1]; x[1] = x[0]; x[0] = (n % 7) - 3;
+		y[2] = y[1]; y[1] = y[0];
+		y[0] = c.b0 * x[0] + c.b1 * x[1] + c.b2 * x[2] - c.a1 * y[1] - c.a2 * y[2];
+
+		filter.update(x[0]);
+		TEST_ASSERT_EQUALS_DELTA(filter.getValue(), y[0], 1e-12);
+	}
+
+	filter.reset();
+	TEST_ASSERT_EQUALS(filter.getValue(), 0.0);
+	filter.update(1);
+	TEST_ASSERT_EQUALS(filter.getValue(), 0.2);
+}
+
+void
+BiquadTest::testCascade()
+{
+	const Biquad::Coefficients first{0.2, 0.3, 0.1, -0.5, 0.25};
+	const Biquad::Coefficients second{1, -1, 0.5, 0.1, 0.2};
+	Biquad a({first});
+	Biquad b({second});
+	modm::filter::Biquad<double, 2> cascade({first, second});
+
+	// Blocks of different sizes, partially in place
+	double input[64];
+	double output[64];
+	for (int n = 0; n < 64; ++n) {
+		input[n] = output[n] = (n * 13) % 9 - 4;
+	}
+	cascade.process(std::span{input, 10}, std::span{output, 10});
+	cascade.process(std::span{output + 10, 54}, std::span{output + 10, 54});
+
+	for (int n = 0; n < 64; ++n)
+	{
+		a.update(input[n]);
+		b.update(a.getValue());
+		TEST_ASSERT_EQUALS_DELTA(output[n], b.getValue(), 1e-12);
+	}
+	TEST_ASSERT_EQUALS(cascade.getValue(), output[63]);
+}
+
+void
+BiquadTest::testLowpass()
+{
+	using Filter = modm::filter::Biquad<float, 2>;
+	Filter lowpass({Filter::lowpass(1000, 8000, 0.5412f), Filter::lowpass(1000, 8000, 1.3066f)});
+	Filter highpass({Filter::highpass(1000, 8000, 0.5412f), Filter::highpass(1000, 8000, 1.3066f)});
+
+	// DC passes the lowpass and is blocked by the highpass
+	float dc[256];
+	float low[256];
+	float high[256];
+	std::fill_n(dc, 256, 1.f);
+	lowpass.process(dc, low);
+	highpass.process(dc, high);
+	TEST_ASSERT_EQUALS_DELTA(low[255], 1.f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(high[255], 0.f, 1e-4f);
+
+	// Nyquist is blocked by the lowpass and passes the highpass
+	float nyquist[256];
+	for (int n = 0; n < 256; ++n) {
+		nyquist[n] = (n & 1) ? -1.f : 1.f;
+	}
+	lowpass.reset();
+	highpass.reset();
+	lowpass.process(nyquist, low);
+	highpass.process(nyquist, high);
+	TEST_ASSERT_EQUALS_DELTA(low[255], 0.f, 1e-4f);
+	TEST_ASSERT_EQUALS_DELTA(high[255], -1.f, 1e-3f);
+}
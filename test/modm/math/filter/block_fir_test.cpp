@@ -0,0 +1,158 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/filter/block_fir.hpp>
+
+#include "block_fir_test.hpp"
+
+namespace
+{
+
+constexpr std::size_t Samples = 100;
+
+template< typename T, std::size_t N >
+T
+convolve(const T (&h)[N], const T* x, std::size_t n)
+{
+	T sum = 0;
+	for (std::size_t k = 0; k < N and k <= n; ++k) {
+		sum += h[k] * x[n - k];
+	}
+	return sum;
+}
+
+}
+
+void
+BlockFirTest::testDelayLine()
+{
+	const int16_t coefficients[5] = {0, 0, 0, 0, 0x7fff};
+	const int16_t input[7] = {1000, -2000, 3000, -4000, 5000, 6000, -7000};
+	modm::filter::BlockFir<int16_t, 5, 4> filter(coefficients);
+
+	int16_t output[7];
+	filter.process(input, output);
+	for (std::size_t n = 0; n < 4; ++n) {
+		TEST_ASSERT_EQUALS(output[n], 0);
+	}
+	TEST_ASSERT_EQUALS(output[4], 1000);
+	TEST_ASSERT_EQUALS(output[5], -2000);
+	TEST_ASSERT_EQUALS(output[6], 3000);
+
+	filter.reset();
+	filter.process(std::span{input + 4, 3}, std::span{output, 3});
+	TEST_ASSERT_EQUALS(output[0], 0);
+	TEST_ASSERT_EQUALS(output[2], 0);
+}
+
+void
+BlockFirTest::testFloat()
+{
+	const float coefficients[13] = {
+		0.01f, -0.02f, 0.05f, 0.1f, 0.15f, 0.2f, 0.25f, 0.2f, 0.15f, 0.1f, 0.05f, -0.02f, 0.01f
+	};
+	float input[Samples];
+	for (std::size_t n = 0; n < Samples; ++n) {
+		input[n] = ((n * 37) % 17) - 8.f;
+	}
+
+	// Blocks of different sizes, also longer than the buffer
+	modm::filter::BlockFir<float, 13, 16> filter(coefficients);
+	float output[Samples];
+	const std::size_t blocks[] = {1, 3, 16, 20, 7, 53};
+	std::size_t offset = 0;
+	for (std::size_t size : blocks)
+	{
+		filter.process(std::span{input + offset, size}, std::span{output + offset, size});
+		offset += size;
+	}
+	TEST_ASSERT_EQUALS(offset, Samples);
+
+	for (std::size_t n = 0; n < Samples; ++n) {
+		TEST_ASSERT_EQUALS_DELTA(output[n], convolve(coefficients, input, n), 1e-5f);
+	}
+
+	// Only as many samples as fit into the output are processed
+	const double h[3] = {0.25, 0.5, 0.25};
+	modm::filter::BlockFir<double, 3> smooth(h);
+	const double x[4] = {4, 8, 4, 100};
+	double y[3] = {};
+	smooth.process(x, y);
+	TEST_ASSERT_EQUALS(y[0], 1.0);
+	TEST_ASSERT_EQUALS(y[1], 4.0);
+	TEST_ASSERT_EQUALS(y[2], 6.0);
+}
+
+void
+BlockFirTest::testInPlace()
+{
+	const float coefficients[4] = {0.5f, 0.25f, 0.125f, 0.125f};
+	float input[Samples];
+	float data[Samples];
+	for (std::size_t n = 0; n < Samples; ++n) {
+		data[n] = input[n] = float(n % 10);
+	}
+
+	modm::filter::BlockFir<float, 4, 8> filter(coefficients);
+	filter.process(data, data);
+	for (std::size_t n = 0; n < Samples; ++n) {
+		TEST_ASSERT_EQUALS(data[n], convolve(coefficients, input, n));
+	}
+}
+
+void
+BlockFirTest::testQ15()
+{
+	// 0.5 and 0.25
+	const int16_t coefficients[2] = {0x4000, 0x2000};
+	modm::filter::BlockFir<int16_t, 2> filter(coefficients);
+
+	const int16_t input[5] = {1000, 1001, -1001, -32768, 32767};
+	int16_t output[5];
+	filter.process(input, output);
+	TEST_ASSERT_EQUALS(output[0], 500);
+	// 500.5 + 250 is rounded up
+	TEST_ASSERT_EQUALS(output[1], 751);
+	TEST_ASSERT_EQUALS(output[2], -250);
+	TEST_ASSERT_EQUALS(output[3], -16634);
+	TEST_ASSERT_EQUALS(output[4], 8192);
+
+	// a gain above one saturates
+	const int16_t gain[2] = {0x7fff, 0x7fff};
+	modm::filter::BlockFir<int16_t, 2> amplifier(gain);
+	const int16_t loud[3] = {20000, 20000, -20000};
+	amplifier.process(loud, output);
+	TEST_ASSERT_EQUALS(output[0], 19999);
+	TEST_ASSERT_EQUALS(output[1], 32767);
+	TEST_ASSERT_EQUALS(output[2], 0);
+	const int16_t quiet[1] = {-20000};
+	amplifier.process(quiet, output);
+	TEST_ASSERT_EQUALS(output[0], -32768);
+}
+
+void
+BlockFirTest::testQ31()
+{
+	// 0.5 and 0.25
+	const int32_t coefficients[2] = {0x4000'0000, 0x2000'0000};
+	modm::filter::BlockFir<int32_t, 2> filter(coefficients);
+
+	const int32_t input[3] = {1'000'000, 2'000'000, -0x7fff'ffff};
+	int32_t output[3];
+	filter.process(input, output);
+	TEST_ASSERT_EQUALS(output[0], 500'000);
+	TEST_ASSERT_EQUALS(output[1], 1'250'000);
+	TEST_ASSERT_EQUALS(output[2], -0x3fff'ffff + 500'000);
+
+	const int32_t gain[2] = {0x7fff'ffff, 0x7fff'ffff};
+	modm::filter::BlockFir<int32_t, 2> amplifier(gain);
+	const int32_t loud[2] = {0x6000'0000, 0x6000'0000};
+	amplifier.process(loud, output);
+	TEST_ASSERT_EQUALS(output[1], 0x7fff'ffff);
+}
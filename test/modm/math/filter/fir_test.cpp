@@ -13,6 +13,7 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/math/filter/fir.hpp>
+#include <modm/math/fixed_point/fixed.hpp>
 
 #include "fir_test.hpp"
 
@@ -44,6 +45,25 @@ FirTest::testFir()
 	testFilter<int, 5, 2, 10>(delay_line_coeffs, delay_line_taps, 5, delay_line_results);
 }
 
+void
+FirTest::testFixedPoint()
+{
+	using q16 = modm::fixed<15, 16>;
+	const float coeffs[4] = {0.125f, 0.375f, 0.375f, 0.125f};
+	modm::filter::Fir<float, 4, 2> reference(coeffs);
+	modm::filter::Fir<q16, 4, 2> filter(coeffs);
+
+	for (int i = 0; i < 20; i++)
+	{
+		const float input = (i % 3) * 10.5f - (i % 7);
+		reference.append(input);
+		filter.append(q16(input));
+		reference.update();
+		filter.update();
+		TEST_ASSERT_EQUALS_DELTA(float(filter.getValue()), reference.getValue(), 1e-4f);
+	}
+}
+
 /* Length of results array needs to be len(taps) + len(coeff) */
 template<typename T, int N, int BLOCK_SIZE, unsigned int ScaleFactor>
 void FirTest::testFilter(const float (&coeff)[N],
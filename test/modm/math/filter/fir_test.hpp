@@ -23,6 +23,9 @@ public:
 	void
 	testFir();
 
+	void
+	testFixedPoint();
+
 private:
 	/* Length of results array needs to be len(taps) + len(coeff) */
 	template<typename T, int N, int BLOCK_SIZE, unsigned int ScaleFactor>
@@ -100,3 +100,28 @@ MedianTest::testMedian()
 		TEST_ASSERT_EQUALS(filter9.getValue(), testData[i].median9);
 	}
 }
+
+void
+MedianTest::testGenericMedian()
+{
+	modm::filter::Median<uint8_t, 11> filter11(5);
+	modm::filter::Median<uint8_t, 4> filter4(5);
+
+	TEST_ASSERT_EQUALS(filter11.getValue(), 5);
+	TEST_ASSERT_EQUALS(filter4.getValue(), 5);
+
+	const uint8_t input[] = { 100, 100, 100, 100, 100, 7, 100, 200, 200, 200, 200, 200, 200 };
+	const uint8_t median11[] = { 5, 5, 5, 5, 5, 7, 100, 100, 100, 100, 100, 100, 200 };
+	const uint8_t median4[] = { 5, 5, 100, 100, 100, 100, 100, 100, 100, 200, 200, 200, 200 };
+	for (unsigned int i = 0; i < sizeof(input); ++i)
+	{
+		filter11.append(input[i]);
+		filter4.append(input[i]);
+		TEST_ASSERT_EQUALS(filter11.getValue(), i ? median11[i - 1] : 5);
+
+		filter11.update();
+		filter4.update();
+		TEST_ASSERT_EQUALS(filter11.getValue(), median11[i]);
+		TEST_ASSERT_EQUALS(filter4.getValue(), median4[i]);
+	}
+}
@@ -22,4 +22,7 @@ public:
 
 	void
 	testMedian();
+
+	void
+	testGenericMedian();
 };
@@ -0,0 +1,168 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include <modm/math/filter/order_statistic.hpp>
+
+#include "order_statistic_test.hpp"
+
+namespace
+{
+	// Sorts a copy of the window for every value
+	template<typename T, std::size_t N>
+	class Reference
+	{
+	public:
+		Reference(T initialValue)
+		{
+			std::fill_n(window, N, initialValue);
+		}
+
+		void
+		update(T input)
+		{
+			window[index] = input;
+			index = (index + 1) % N;
+		}
+
+		T
+		getValue(std::size_t rank) const
+		{
+			T sorted[N];
+			std::copy_n(window, N, sorted);
+			std::nth_element(sorted, sorted + rank, sorted + N);
+			return sorted[rank];
+		}
+
+	private:
+		T window[N];
+		std::size_t index{0};
+	};
+
+	// Pseudo-random samples with many duplicates
+	int16_t
+	sample(uint32_t& state)
+	{
+		state = state * 1664525 + 1013904223;
+		return int16_t(state >> 16) / 64;
+	}
+}
+
+void
+OrderStatisticTest::testDefaultConstructor()
+{
+	modm::filter::OrderStatistic<int16_t, 9> filter9;
+	modm::filter::OrderStatistic<int16_t, 64> filter64;
+
+	TEST_ASSERT_EQUALS(filter9.getValue(), 0);
+	TEST_ASSERT_EQUALS(filter9.getRank(), 4u);
+	TEST_ASSERT_EQUALS(filter64.getValue(), 0);
+	TEST_ASSERT_EQUALS(filter64.getRank(), 31u);
+}
+
+void
+OrderStatisticTest::testMedian()
+{
+	modm::filter::OrderStatistic<int16_t, 1> filter1(7);
+	modm::filter::OrderStatistic<int16_t, 9> filter9(7);
+	modm::filter::OrderStatistic<int16_t, 64> filter64(7);
+	Reference<int16_t, 9> reference9(7);
+	Reference<int16_t, 64> reference64(7);
+
+	TEST_ASSERT_EQUALS(filter9.getValue(), 7);
+	TEST_ASSERT_EQUALS(filter64.getValue(), 7);
+
+	uint32_t state = 42;
+	for (int i = 0; i < 500; ++i)
+	{
+		const int16_t input = sample(state);
+		filter1.update(input);
+		filter9.update(input);
+		filter64.update(input);
+		reference9.update(input);
+		reference64.update(input);
+
+		TEST_ASSERT_EQUALS(filter1.getValue(), input);
+		TEST_ASSERT_EQUALS(filter9.getValue(), reference9.getValue(4));
+		TEST_ASSERT_EQUALS(filter64.getValue(), reference64.getValue(31));
+	}
+}
+
+void
+OrderStatisticTest::testRank()
+{
+	modm::filter::OrderStatistic<int16_t, 33> filter(0, 0);
+	Reference<int16_t, 33> reference(0);
+
+	uint32_t state = 1;
+	for (std::size_t rank : {0, 32, 10, 16, 31, 1, 40})
+	{
+		filter.setRank(rank);
+		rank = std::min<std::size_t>(rank, 32);
+		TEST_ASSERT_EQUALS(filter.getRank(), rank);
+		TEST_ASSERT_EQUALS(filter.getValue(), reference.getValue(rank));
+
+		for (int i = 0; i < 100; ++i)
+		{
+			const int16_t input = sample(state);
+			filter.update(input);
+			reference.update(input);
+			TEST_ASSERT_EQUALS(filter.getValue(), reference.getValue(rank));
+		}
+	}
+}
+
+void
+OrderStatisticTest::testPercentile()
+{
+	modm::filter::OrderStatistic<float, 101> filter;
+	for (int i = 100; i >= 0; --i) {
+		filter.update(i * 0.5f);
+	}
+	TEST_ASSERT_EQUALS(filter.getValue(), 25.f);
+
+	filter.setPercentile(95);
+	TEST_ASSERT_EQUALS(filter.getRank(), 95u);
+	TEST_ASSERT_EQUALS(filter.getValue(), 47.5f);
+
+	filter.setPercentile(0);
+	TEST_ASSERT_EQUALS(filter.getValue(), 0.f);
+
+	filter.setPercentile(150);
+	TEST_ASSERT_EQUALS(filter.getRank(), 100u);
+	TEST_ASSERT_EQUALS(filter.getValue(), 50.f);
+
+	// Replaces the oldest value 50
+	filter.update(-1.f);
+	TEST_ASSERT_EQUALS(filter.getValue(), 49.5f);
+}
+
+void
+OrderStatisticTest::testReset()
+{
+	modm::filter::OrderStatistic<int16_t, 16> filter(0, 15);
+	uint32_t state = 3;
+	for (int i = 0; i < 20; ++i) {
+		filter.update(sample(state));
+	}
+
+	filter.reset(-5);
+	TEST_ASSERT_EQUALS(filter.getValue(), -5);
+	TEST_ASSERT_EQUALS(filter.getRank(), 15u);
+
+	filter.update(3);
+	TEST_ASSERT_EQUALS(filter.getValue(), 3);
+	for (int i = 0; i < 15; ++i) {
+		filter.update(-10);
+	}
+	TEST_ASSERT_EQUALS(filter.getValue(), 3);
+	filter.update(-10);
+	TEST_ASSERT_EQUALS(filter.getValue(), -10);
+}
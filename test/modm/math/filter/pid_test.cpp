@@ -13,6 +13,7 @@
 // ----------------------------------------------------------------------------
 
 #include <modm/math/filter/pid.hpp>
+#include <modm/math/fixed_point/fixed.hpp>
 
 #include "pid_test.hpp"
 
@@ -31,3 +32,25 @@ PidTest::testCreation()
 
 	controller.getValue();
 }
+
+void
+PidTest::testFixedPoint()
+{
+	using q16 = modm::fixed<15, 16>;
+	modm::Pid<float> reference(0.8f, 0.25f, 0.5f, 40, 100);
+	modm::Pid<q16> controller(0.8f, 0.25f, 0.5f, 40, 100);
+
+	float value = 0;
+	for (int i = 0; i < 50; i++)
+	{
+		const float error = 75 - value;
+		reference.update(error);
+		controller.update(q16(error));
+		TEST_ASSERT_EQUALS_DELTA(float(controller.getValue()), reference.getValue(), 1e-3f);
+		TEST_ASSERT_EQUALS_DELTA(float(controller.getErrorSum()), reference.getErrorSum(), 1e-3f);
+		value += reference.getValue() / 4;
+	}
+	// the output is limited
+	controller.update(1000);
+	TEST_ASSERT_EQUALS(controller.getValue().raw(), q16(100).raw());
+}
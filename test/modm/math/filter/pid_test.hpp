@@ -22,4 +22,7 @@ public:
 	// can be created and compiles without errors
 	void
 	testCreation();
+
+	void
+	testFixedPoint();
 };
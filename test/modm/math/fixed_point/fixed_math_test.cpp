@@ -0,0 +1,143 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <numbers>
+
+#include <modm/math/fixed_point/fixed_math.hpp>
+
+#include "fixed_math_test.hpp"
+
+namespace
+{
+	using q16 = modm::fixed<15, 16>;
+	using q30 = modm::fixed<1, 30>;
+	using q15 = modm::fixed<0, 15>;
+	using q12 = modm::fixed<3, 12>;
+
+	constexpr double pi = std::numbers::pi;
+
+	static_assert(sqrt(q16(4)) == q16(2));
+	static_assert(sin(q16(0)) == q16(0) and cos(q16(0)) == q16(1));
+
+	// Largest error in units of the last place over a range of values
+	template<typename Fixed, typename Function, typename Reference>
+	double
+	maxError(double from, double to, int steps, Function function, Reference reference)
+	{
+		double error = 0;
+		for (int i = 0; i <= steps; ++i)
+		{
+			const Fixed value(from + (to - from) * i / steps);
+			const double result = double(function(value));
+			error = std::max(error, std::abs(result - reference(double(value))));
+		}
+		return error / double(Fixed::epsilon());
+	}
+}
+
+void
+FixedMathTest::testSqrt()
+{
+	TEST_ASSERT_EQUALS(sqrt(q16(4)).raw(), q16(2).raw());
+	TEST_ASSERT_EQUALS(sqrt(q16(2)).raw(), 92682);
+	TEST_ASSERT_EQUALS(sqrt(q16(0)).raw(), 0);
+	TEST_ASSERT_EQUALS(sqrt(q16(-1)).raw(), 0);
+	TEST_ASSERT_EQUALS(sqrt(q16::epsilon()).raw(), 256);
+	TEST_ASSERT_EQUALS(sqrt(q15(0.25f)).raw(), 16384);
+	TEST_ASSERT_EQUALS(sqrt(q15(1.f)).raw(), 32767);
+	TEST_ASSERT_EQUALS(sqrt(modm::fixed<0, 7>(0.25f)).raw(), 64);
+
+	auto root = [](auto x) { return sqrt(x); };
+	auto reference = [](double x) { return std::sqrt(x); };
+	TEST_ASSERT_TRUE(maxError<q16>(0, 32767, 10000, root, reference) <= 0.5);
+	TEST_ASSERT_TRUE(maxError<q16>(0, 2, 10000, root, reference) <= 0.5);
+	TEST_ASSERT_TRUE(maxError<q30>(0, 1.999, 10000, root, reference) <= 0.5);
+	TEST_ASSERT_TRUE(maxError<q15>(0, 1, 10000, root, reference) <= 0.5);
+}
+
+void
+FixedMathTest::testHypot()
+{
+	TEST_ASSERT_EQUALS(hypot(q16(3), q16(4)).raw(), q16(5).raw());
+	TEST_ASSERT_EQUALS(hypot(q16(-3), q16(-4)).raw(), q16(5).raw());
+	TEST_ASSERT_EQUALS(hypot(q16(20000), q16(-15000)).raw(), q16(25000).raw());
+	TEST_ASSERT_EQUALS(hypot(q16(30000), q16(30000)).raw(), q16::max().raw());
+	TEST_ASSERT_EQUALS(hypot(q16::min(), q16(0)).raw(), q16::max().raw());
+	TEST_ASSERT_EQUALS(hypot(q15(0.6f), q15(0.8f)).raw(), 32767);
+	TEST_ASSERT_EQUALS(hypot(q15(0.3f), q15(0.4f)).raw(), q15(0.5f).raw());
+}
+
+void
+FixedMathTest::testSinCos()
+{
+	TEST_ASSERT_EQUALS(sin(q16(0)).raw(), 0);
+	TEST_ASSERT_EQUALS(cos(q16(0)).raw(), 65536);
+	TEST_ASSERT_EQUALS(sin(q16(pi / 2)).raw(), 65536);
+	TEST_ASSERT_EQUALS(cos(q16(pi)).raw(), -65536);
+	TEST_ASSERT_EQUALS(cos(q30(0.)).raw(), 1 << 30);
+	TEST_ASSERT_EQUALS(cos(q15(0.f)).raw(), 32767);
+	TEST_ASSERT_EQUALS_DELTA(double(sin(q15(-0.5f))), std::sin(-0.5), 1.0 / 32768);
+
+	// The error of the angle itself is included
+	auto sine = [](auto x) { return sin(x); };
+	auto cosine = [](auto x) { return cos(x); };
+	auto sineReference = [](double x) { return std::sin(x); };
+	auto cosineReference = [](double x) { return std::cos(x); };
+	TEST_ASSERT_TRUE(maxError<q16>(-10, 10, 20000, sine, sineReference) <= 1);
+	TEST_ASSERT_TRUE(maxError<q16>(-10, 10, 20000, cosine, cosineReference) <= 1);
+	TEST_ASSERT_TRUE(maxError<q16>(-30000, 30000, 20000, sine, sineReference) <= 1);
+	TEST_ASSERT_TRUE(maxError<q12>(-8, 8, 20000, sine, sineReference) <= 1);
+	TEST_ASSERT_TRUE(maxError<q15>(-1, 1, 20000, cosine, cosineReference) <= 1);
+	// Limited by the table with 256 values per quarter circle
+	TEST_ASSERT_TRUE(maxError<q30>(-2, 2, 20000, sine, sineReference) * double(q30::epsilon()) < 5e-6);
+	TEST_ASSERT_TRUE(maxError<q30>(-2, 2, 20000, cosine, cosineReference) * double(q30::epsilon()) < 5e-6);
+}
+
+void
+FixedMathTest::testAtan2()
+{
+	TEST_ASSERT_EQUALS(atan2(q16(0), q16(0)).raw(), 0);
+	TEST_ASSERT_EQUALS(atan2(q16(0), q16(1)).raw(), 0);
+	TEST_ASSERT_EQUALS(atan2(q16(1), q16(0)).raw(), q16(pi / 2).raw());
+	TEST_ASSERT_EQUALS(atan2(q16(-1), q16(0)).raw(), q16(-pi / 2).raw());
+	TEST_ASSERT_EQUALS(atan2(q16(0), q16(-1)).raw(), q16(pi).raw());
+	TEST_ASSERT_EQUALS(atan2(q16(1), q16(1)).raw(), q16(pi / 4).raw());
+	TEST_ASSERT_EQUALS(atan2(q16::epsilon(), q16::min()).raw(), q16(pi).raw());
+	TEST_ASSERT_EQUALS(atan2(-q16::epsilon(), q16::min()).raw(), q16(-pi).raw());
+	// Pi does not fit into Q1.30 and Q15
+	TEST_ASSERT_EQUALS(atan2(q30(0.), q30(-1.)).raw(), q30::max().raw());
+	TEST_ASSERT_EQUALS_DELTA(double(atan2(q30(1.), q30(0.))), pi / 2, 1e-8);
+	TEST_ASSERT_EQUALS(atan2(q15(0.f), q15(-0.5f)).raw(), 32767);
+	TEST_ASSERT_EQUALS(atan2(q15(0.5f), q15(0.5f)).raw(), q15(pi / 4).raw());
+
+	// Around the full circle at different radii
+	for (const double radius : {1e-3, 0.25, 1.0, 100.0, 20000.0})
+	{
+		double error = 0;
+		for (int i = -1800; i <= 1800; ++i)
+		{
+			const q16 x(radius * std::cos(i * pi / 1800));
+			const q16 y(radius * std::sin(i * pi / 1800));
+			const double result = double(atan2(y, x));
+			error = std::max(error, std::abs(result - std::atan2(double(y), double(x))));
+		}
+		TEST_ASSERT_TRUE(error <= 1.5 * double(q16::epsilon()));
+	}
+
+	using q29 = modm::fixed<2, 29>;
+	double error = 0;
+	for (int i = -1800; i <= 1800; ++i)
+	{
+		const q29 x(std::cos(i * pi / 1800));
+		const q29 y(std::sin(i * pi / 1800));
+		error = std::max(error, std::abs(double(atan2(y, x)) - std::atan2(double(y), double(x))));
+	}
+	TEST_ASSERT_TRUE(error < 1e-7);
+}
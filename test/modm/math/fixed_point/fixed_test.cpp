@@ -0,0 +1,203 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/fixed_point/fixed.hpp>
+
+#include "fixed_test.hpp"
+
+namespace
+{
+	using q16 = modm::fixed<15, 16>;
+	using q8 = modm::fixed<7, 8>;
+	using q15 = modm::fixed<0, 15>;
+
+	constexpr int32_t Max = 2147483647;
+	constexpr int32_t Min = -2147483647 - 1;
+
+	static_assert(sizeof(q16) == 4 and sizeof(q8) == 2 and sizeof(modm::fixed<3, 4>) == 1);
+	static_assert(q16(1.5f).raw() == 98304);
+	static_assert(q16(0.75) * q16(2) == q16(1.5f));
+	static_assert(modm::is_fixed_point_v<q15> and not modm::is_fixed_point_v<int16_t>);
+}
+
+void
+FixedTest::testConversion()
+{
+	TEST_ASSERT_EQUALS(q16().raw(), 0);
+	TEST_ASSERT_EQUALS(q16(3).raw(), 196608);
+	TEST_ASSERT_EQUALS(q16(-3).raw(), -196608);
+	TEST_ASSERT_EQUALS(q16(1.5f).raw(), 98304);
+	TEST_ASSERT_EQUALS(q16(-0.25).raw(), -16384);
+
+	// rounded to nearest
+	TEST_ASSERT_EQUALS(q16(1.f / 131072).raw(), 1);
+	TEST_ASSERT_EQUALS(q16(-1.f / 131072).raw(), -1);
+	TEST_ASSERT_EQUALS(q16(1.f / 262144).raw(), 0);
+
+	// saturated
+	TEST_ASSERT_EQUALS(q16(40000).raw(), Max);
+	TEST_ASSERT_EQUALS(q16(-40000).raw(), Min);
+	TEST_ASSERT_EQUALS(q16(uint32_t(4000000000)).raw(), Max);
+	TEST_ASSERT_EQUALS(q16(1e10f).raw(), Max);
+	TEST_ASSERT_EQUALS(q16(-1e10f).raw(), Min);
+	TEST_ASSERT_EQUALS(q16(32768.f).raw(), Max);
+	TEST_ASSERT_EQUALS(q16(-32768.f).raw(), Min);
+
+	TEST_ASSERT_EQUALS(float(q16::fromRaw(1)), 1.f / 65536);
+	TEST_ASSERT_EQUALS(float(q16(-2.75f)), -2.75f);
+	TEST_ASSERT_EQUALS(double(q16::max()), 32767.9999847412109375);
+	TEST_ASSERT_EQUALS(double(q16::min()), -32768.);
+	TEST_ASSERT_EQUALS(q16::epsilon().raw(), 1);
+
+	// integer part is truncated towards zero
+	TEST_ASSERT_EQUALS(int(q16(2.75f)), 2);
+	TEST_ASSERT_EQUALS(int(q16(-2.75f)), -2);
+	TEST_ASSERT_EQUALS(int16_t(q16(-32768)), -32768);
+
+	TEST_ASSERT_TRUE(q16(1) < q16(1.5f));
+	TEST_ASSERT_TRUE(q16(-1) < 0);
+	TEST_ASSERT_TRUE(q16(2) == 2);
+	TEST_ASSERT_TRUE(q16(2) != q16(2.5f));
+}
+
+void
+FixedTest::testFormatConversion()
+{
+	// widening is implicit and exact
+	const q16 wide = q8::fromRaw(-384);
+	TEST_ASSERT_EQUALS(wide.raw(), -98304);
+
+	TEST_ASSERT_EQUALS(q8(q16(1.5f)).raw(), 384);
+	TEST_ASSERT_EQUALS(q8(q16(200)).raw(), 32767);
+	TEST_ASSERT_EQUALS(q8(q16(-200)).raw(), -32768);
+
+	// narrowing rounds to nearest
+	TEST_ASSERT_EQUALS(q8(q16::fromRaw(128)).raw(), 1);
+	TEST_ASSERT_EQUALS(q8(q16::fromRaw(127)).raw(), 0);
+	TEST_ASSERT_EQUALS(q8(q16::fromRaw(-129)).raw(), -1);
+
+	TEST_ASSERT_EQUALS(q15(q16(0.5f)).raw(), 16384);
+	TEST_ASSERT_EQUALS(q15(q16(1)).raw(), 32767);
+	TEST_ASSERT_EQUALS(q16(q15(-1.f)).raw(), -65536);
+}
+
+void
+FixedTest::testAddition()
+{
+	TEST_ASSERT_EQUALS((q16(1.25f) + q16(2.5f)).raw(), q16(3.75f).raw());
+	TEST_ASSERT_EQUALS((q16(1.25f) - q16(2.5f)).raw(), q16(-1.25f).raw());
+	TEST_ASSERT_EQUALS((q16(1.25f) + 2).raw(), q16(3.25f).raw());
+
+	TEST_ASSERT_EQUALS((q16::max() + q16::epsilon()).raw(), Max);
+	TEST_ASSERT_EQUALS((q16::min() - q16::epsilon()).raw(), Min);
+	TEST_ASSERT_EQUALS((q16(30000) + q16(30000)).raw(), Max);
+	TEST_ASSERT_EQUALS((q16(-30000) - q16(30000)).raw(), Min);
+	TEST_ASSERT_EQUALS((q16(30000) - q16(-30000)).raw(), Max);
+	TEST_ASSERT_EQUALS((q16(-30000) + q16(-30000)).raw(), Min);
+
+	TEST_ASSERT_EQUALS((-q16(2)).raw(), -131072);
+	TEST_ASSERT_EQUALS((-q16::min()).raw(), Max);
+	TEST_ASSERT_EQUALS(abs(q16(-2)).raw(), 131072);
+	TEST_ASSERT_EQUALS(abs(q16::min()).raw(), Max);
+
+	q16 value = 1;
+	value += q16(0.5f);
+	value -= 3;
+	TEST_ASSERT_EQUALS(value.raw(), q16(-1.5f).raw());
+}
+
+void
+FixedTest::testMultiplication()
+{
+	TEST_ASSERT_EQUALS((q16(1.5f) * q16(-2.25f)).raw(), q16(-3.375f).raw());
+	TEST_ASSERT_EQUALS((q16(-1.5f) * q16(-2.25f)).raw(), q16(3.375f).raw());
+
+	// rounded to nearest
+	TEST_ASSERT_EQUALS((q16::epsilon() * q16(0.5f)).raw(), 1);
+	TEST_ASSERT_EQUALS((q16::epsilon() * q16(0.25f)).raw(), 0);
+	TEST_ASSERT_EQUALS((q16(1.f / 3) * q16(3)).raw(), 65535);
+
+	TEST_ASSERT_EQUALS((q16(300) * q16(300)).raw(), Max);
+	TEST_ASSERT_EQUALS((q16(300) * q16(-300)).raw(), Min);
+	TEST_ASSERT_EQUALS((q16::min() * q16::min()).raw(), Max);
+
+	q16 value = 3;
+	value *= q16(0.5f);
+	TEST_ASSERT_EQUALS(value.raw(), q16(1.5f).raw());
+}
+
+void
+FixedTest::testDivision()
+{
+	TEST_ASSERT_EQUALS((q16(7) / q16(2)).raw(), q16(3.5f).raw());
+	TEST_ASSERT_EQUALS((q16(1) / q16(3)).raw(), 21845);
+	TEST_ASSERT_EQUALS((q16(-1) / q16(3)).raw(), -21845);
+	TEST_ASSERT_EQUALS((q16(2) / q16(3)).raw(), 43691);
+	TEST_ASSERT_EQUALS((q16(2) / q16(-3)).raw(), -43691);
+
+	TEST_ASSERT_EQUALS((q16(1) / q16(0)).raw(), Max);
+	TEST_ASSERT_EQUALS((q16(-1) / q16(0)).raw(), Min);
+	TEST_ASSERT_EQUALS((q16(30000) / q16(0.5f)).raw(), Max);
+	TEST_ASSERT_EQUALS((q16(30000) / q16(-0.5f)).raw(), Min);
+	TEST_ASSERT_EQUALS((q16::min() / q16(-1)).raw(), Max);
+
+	q16 value = 3;
+	value /= q16(4);
+	TEST_ASSERT_EQUALS(value.raw(), q16(0.75f).raw());
+}
+
+void
+FixedTest::testIntegerScaling()
+{
+	TEST_ASSERT_EQUALS((q16(1.5f) * 3).raw(), q16(4.5f).raw());
+	TEST_ASSERT_EQUALS((3 * q16(1.5f)).raw(), q16(4.5f).raw());
+	TEST_ASSERT_EQUALS((q16(1) / 3).raw(), 21845);
+	TEST_ASSERT_EQUALS((q16(-1) / 3u).raw(), -21845);
+
+	TEST_ASSERT_EQUALS((q16(1) * 100000).raw(), Max);
+	TEST_ASSERT_EQUALS((q16(-1) * 100000).raw(), Min);
+	TEST_ASSERT_EQUALS((q16(1) * -100000).raw(), Min);
+	TEST_ASSERT_EQUALS((q16::epsilon() * (int64_t(1) << 40)).raw(), Max);
+	TEST_ASSERT_EQUALS((q16(0) * 100000).raw(), 0);
+	TEST_ASSERT_EQUALS((q16(1) / 0).raw(), Max);
+	TEST_ASSERT_EQUALS((q16::epsilon() / 100000).raw(), 0);
+
+	// The integer is not converted into the format first
+	TEST_ASSERT_EQUALS((q15(0.5f) * 2).raw(), 32767);
+	TEST_ASSERT_EQUALS((q15(0.5f) / 4).raw(), 4096);
+
+	q16 value = 3;
+	value *= 4;
+	value /= 8;
+	TEST_ASSERT_EQUALS(value.raw(), q16(1.5f).raw());
+}
+
+void
+FixedTest::testQ15()
+{
+	TEST_ASSERT_EQUALS(q15(0.5f).raw(), 16384);
+	TEST_ASSERT_EQUALS(q15(1.f).raw(), 32767);
+	TEST_ASSERT_EQUALS(q15(-1.f).raw(), -32768);
+	TEST_ASSERT_EQUALS(q15(1).raw(), 32767);
+	TEST_ASSERT_EQUALS(q15(-1).raw(), -32768);
+
+	TEST_ASSERT_EQUALS((q15(0.5f) * q15(0.5f)).raw(), q15(0.25f).raw());
+	TEST_ASSERT_EQUALS((q15(-0.5f) * q15(0.5f)).raw(), q15(-0.25f).raw());
+	TEST_ASSERT_EQUALS((q15(-1.f) * q15(-1.f)).raw(), 32767);
+	TEST_ASSERT_EQUALS((q15(0.5f) + q15(0.75f)).raw(), 32767);
+	TEST_ASSERT_EQUALS((q15(-0.5f) - q15(0.75f)).raw(), -32768);
+	TEST_ASSERT_EQUALS((q15(0.25f) / q15(0.5f)).raw(), 16384);
+	TEST_ASSERT_EQUALS((q15(0.5f) / q15(0.25f)).raw(), 32767);
+
+	using q7 = modm::fixed<0, 7>;
+	TEST_ASSERT_EQUALS(q7(0.5f).raw(), 64);
+	TEST_ASSERT_EQUALS((q7(0.5f) * q7(-0.5f)).raw(), -32);
+	TEST_ASSERT_EQUALS((q7(-1.f) * q7(-1.f)).raw(), 127);
+	TEST_ASSERT_EQUALS((q7(0.75f) + q7(0.75f)).raw(), 127);
+}
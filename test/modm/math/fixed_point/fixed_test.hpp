@@ -0,0 +1,36 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_math
+class FixedTest : public unittest::TestSuite
+{
+public:
+	void
+	testConversion();
+
+	void
+	testFormatConversion();
+
+	void
+	testAddition();
+
+	void
+	testMultiplication();
+
+	void
+	testDivision();
+
+	void
+	testIntegerScaling();
+
+	void
+	testQ15();
+};
@@ -58,3 +58,27 @@ AngleTest::testPerpendicularCcw()
 	TEST_ASSERT_EQUALS_FLOAT(modm::Angle::perpendicular( 0.7 * M_PI, false), -0.8 * M_PI);
 	TEST_ASSERT_EQUALS_FLOAT(modm::Angle::perpendicular( 0.1 * M_PI, false),  0.6 * M_PI);
 }
+
+void
+AngleTest::testFixedPoint()
+{
+	using q16 = modm::fixed<15, 16>;
+
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::normalize(q16( 0.3 * M_PI))),  0.3 * M_PI, 1e-4);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::normalize(q16( 2.9 * M_PI))),  0.9 * M_PI, 1e-4);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::normalize(q16(-2.9 * M_PI))), -0.9 * M_PI, 1e-4);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::normalize(q16( 1.5 * M_PI))), -0.5 * M_PI, 1e-4);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::normalize(q16(100.5 * M_PI))), 0.5 * M_PI, 1e-3);
+
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::reverse(q16(-0.9 * M_PI))),  0.1 * M_PI, 1e-4);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::reverse(q16( 0.7 * M_PI))), -0.3 * M_PI, 1e-4);
+
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::perpendicular(q16(-0.9 * M_PI), true)),  0.6 * M_PI, 1e-4);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::perpendicular(q16( 0.7 * M_PI), false)), -0.8 * M_PI, 1e-4);
+
+	// 2*Pi does not fit into the format
+	using q2 = modm::fixed<2, 13>;
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::normalize(q2( 3.9))),  3.9 - 2 * M_PI, 1e-3);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::normalize(q2(-3.9))), -3.9 + 2 * M_PI, 1e-3);
+	TEST_ASSERT_EQUALS_DELTA(float(modm::Angle::perpendicular(q2(3), false)), 3 + 0.5 * M_PI - 2 * M_PI, 1e-3);
+}
@@ -29,4 +29,7 @@ public:
 
 	void
 	testPerpendicularCcw();
+
+	void
+	testFixedPoint();
 };
@@ -416,3 +416,30 @@ Vector2Test::testCCW()
 	TEST_ASSERT_EQUALS(modm::Vector2i::ccw(b, c, a), -1);
 }
 
+
+void
+Vector2Test::testFixedPoint()
+{
+	using q16 = modm::fixed<15, 16>;
+	modm::Vector<q16, 2> a(3, -4);
+
+	TEST_ASSERT_EQUALS(a.getLength().raw(), q16(5).raw());
+	TEST_ASSERT_EQUALS(a.getLengthSquared().raw(), q16(25).raw());
+	TEST_ASSERT_EQUALS_DELTA(a.getAngle(), std::atan2(-4.f, 3.f), 1e-5);
+
+	// the length does not overflow with the squares
+	modm::Vector<q16, 2> b(12000, 16000);
+	TEST_ASSERT_EQUALS(b.getLength().raw(), q16(20000).raw());
+	TEST_ASSERT_EQUALS_DELTA(float((a - b).getLength()), std::hypot(11997.f, 16004.f), 1e-4);
+
+	modm::Vector<q16, 2> c(100, 100);
+	c.rotate(modm::Angle::toRadian(20));
+	TEST_ASSERT_EQUALS_DELTA(float(c.getX()), 59.767247746f, 3e-3);
+	TEST_ASSERT_EQUALS_DELTA(float(c.getY()), 128.1712764112f, 3e-3);
+
+	c.normalize();
+	TEST_ASSERT_EQUALS_DELTA(float(c.getLength()), 1.f, 1e-4);
+
+	TEST_ASSERT_EQUALS(b.dot(b).raw(), q16::max().raw());
+	TEST_ASSERT_EQUALS(a.dot(modm::Vector<q16, 2>(2, 1)).raw(), q16(2).raw());
+}
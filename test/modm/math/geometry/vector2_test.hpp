@@ -73,4 +73,7 @@ public:
 
 	void
 	testCCW();
+
+	void
+	testFixedPoint();
 };
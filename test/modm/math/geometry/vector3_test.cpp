@@ -263,6 +263,23 @@ Vector3Test::testLength()
 	TEST_ASSERT_EQUALS_FLOAT(a.z, 0.8017837257);
 }
 
+void
+Vector3Test::testFixedPoint()
+{
+	using q16 = modm::fixed<15, 16>;
+	modm::Vector<q16, 3> a(1, 2, 2);
+
+	TEST_ASSERT_EQUALS(a.getLength().raw(), q16(3).raw());
+	TEST_ASSERT_EQUALS(a.getLengthSquared().raw(), q16(9).raw());
+
+	// the length does not overflow with the squares
+	modm::Vector<q16, 3> b(12000, 16000, 0);
+	TEST_ASSERT_EQUALS(b.getLength().raw(), q16(20000).raw());
+
+	a.normalize();
+	TEST_ASSERT_EQUALS_DELTA(float(a.getLength()), 1.f, 1e-4);
+}
+
 void
 Vector3Test::testMathDefs()
 {
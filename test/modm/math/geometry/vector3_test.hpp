@@ -35,6 +35,9 @@ public:
 	void
 	testLength();
 
+	void
+	testFixedPoint();
+
 	void
 	testMathDefs();
 };
@@ -402,3 +402,20 @@ Vector4Test::testLength()
 	TEST_ASSERT_EQUALS_FLOAT(a.z, 0.5477225575);
 	TEST_ASSERT_EQUALS_FLOAT(a.w, 0.7302967433);
 }
+
+void
+Vector4Test::testFixedPoint()
+{
+	using q16 = modm::fixed<15, 16>;
+	modm::Vector<q16, 4> a(1, 2, 2, 4);
+
+	TEST_ASSERT_EQUALS(a.getLength().raw(), q16(5).raw());
+	TEST_ASSERT_EQUALS(a.getLengthSquared().raw(), q16(25).raw());
+
+	// the length does not overflow with the squares
+	modm::Vector<q16, 4> b(12000, 0, 16000, 0);
+	TEST_ASSERT_EQUALS(b.getLength().raw(), q16(20000).raw());
+
+	a.normalize();
+	TEST_ASSERT_EQUALS_DELTA(float(a.getLength()), 1.f, 1e-4);
+}
@@ -54,4 +54,27 @@ LagrangeInterpolationTest::testInterpolation()
 	TEST_ASSERT_EQUALS_FLOAT(value.interpolate(3.5f), 12.25f);
 }
 
+void
+LagrangeInterpolationTest::testBlock()
+{
+	typedef modm::Pair<float, float> Point;
+
+	Point points[3] =
+	{
+		{ 1, 1 },
+		{ 2, 4 },
+		{ 3, 9 }
+	};
 
+	modm::interpolation::Lagrange<Point> value(points, 3);
+
+	const float input[] = { 1.f, 1.5f, 2.f, 2.5f, 3.f };
+	float output[5] = {};
+	value.interpolate(input, output);
+
+	TEST_ASSERT_EQUALS_FLOAT(output[0], 1.f);
+	TEST_ASSERT_EQUALS_FLOAT(output[1], 2.25f);
+	TEST_ASSERT_EQUALS_FLOAT(output[2], 4.f);
+	TEST_ASSERT_EQUALS_FLOAT(output[3], 6.25f);
+	TEST_ASSERT_EQUALS_FLOAT(output[4], 9.f);
+}
@@ -22,6 +22,9 @@ struct LagrangeInterpolationTest : public unittest::TestSuite
 
 	void
 	testInterpolation();
+
+	void
+	testBlock();
 };
 
 
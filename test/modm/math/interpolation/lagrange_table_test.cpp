@@ -0,0 +1,94 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/interpolation/lagrange.hpp>
+#include <modm/math/interpolation/lagrange_table.hpp>
+
+#include "lagrange_table_test.hpp"
+
+namespace
+{
+	typedef modm::Pair<float, float> Point;
+
+	// x^2 over the range of 1 <= x <= 3
+	constexpr Point squarePoints[3] =
+	{
+		{ 1, 1 },
+		{ 2, 4 },
+		{ 3, 9 }
+	};
+
+	// Calibration curve of a flow sensor
+	constexpr Point flowPoints[7] =
+	{
+		{ 0.f, 0.f },
+		{ 0.5f, 1.8f },
+		{ 1.2f, 4.1f },
+		{ 2.f, 6.f },
+		{ 3.1f, 7.2f },
+		{ 4.f, 7.9f },
+		{ 5.f, 8.1f }
+	};
+}
+
+void
+LagrangeTableTest::testConstexpr()
+{
+	constexpr modm::interpolation::LagrangeTable table(squarePoints);
+
+	static_assert(table.interpolate(1.5f) == 2.25f);
+	static_assert(table.interpolate(3.5f) == 12.25f);
+	TEST_ASSERT_EQUALS_FLOAT(table.interpolate(2.5f), 6.25f);
+}
+
+void
+LagrangeTableTest::testInterpolation()
+{
+	modm::interpolation::LagrangeTable table(flowPoints);
+	modm::interpolation::Lagrange<Point> reference(flowPoints, 7);
+
+	for (const Point& point : flowPoints) {
+		TEST_ASSERT_EQUALS_DELTA(table.interpolate(point.getFirst()), point.getSecond(), 1e-5f);
+	}
+	for (float x = -0.5f; x <= 5.5f; x += 0.125f) {
+		TEST_ASSERT_EQUALS_DELTA(table.interpolate(x), reference.interpolate(x), 1e-4f);
+	}
+
+	// Integer inputs are converted to the output type
+	typedef modm::Pair<uint8_t, float> IntegerPoint;
+	const IntegerPoint integerPoints[3] =
+	{
+		{  10, -50 },
+		{  50,   0 },
+		{ 100,  50 }
+	};
+	modm::interpolation::LagrangeTable integerTable(integerPoints);
+	modm::interpolation::Lagrange<IntegerPoint> integerReference(integerPoints, 3);
+	for (int x = 0; x < 120; ++x) {
+		TEST_ASSERT_EQUALS_DELTA(integerTable.interpolate(x), integerReference.interpolate(x), 1e-4f);
+	}
+}
+
+void
+LagrangeTableTest::testBlock()
+{
+	constexpr modm::interpolation::LagrangeTable table(flowPoints);
+
+	// Covers full vectors and the remaining scalars
+	float input[11];
+	float output[11];
+	for (int i = 0; i < 11; ++i) {
+		input[i] = i * 0.45f;
+	}
+	table.interpolate(input, output);
+
+	for (int i = 0; i < 11; ++i) {
+		TEST_ASSERT_EQUALS_DELTA(output[i], table.interpolate(input[i]), 1e-5f);
+	}
+}
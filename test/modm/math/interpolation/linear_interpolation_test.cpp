@@ -75,3 +75,56 @@ LinearInterpolationTest::testInterpolationFlash()
 	TEST_ASSERT_EQUALS(value.interpolate(230), 20000);
 	TEST_ASSERT_EQUALS(value.interpolate(250), 20000);
 }
+
+void
+LinearInterpolationTest::testBinarySearch()
+{
+	typedef modm::Pair<int16_t, int32_t> Point;
+
+	// y = x * |x| at every fifth supporting point
+	Point points[101];
+	for (int i = 0; i < 101; ++i)
+	{
+		const int16_t x = (i - 50) * 5;
+		points[i] = { x, x * (x < 0 ? -x : x) };
+	}
+
+	modm::interpolation::Linear<Point> value(points, 101);
+
+	TEST_ASSERT_EQUALS(value.interpolate(-1000), -62500);
+	TEST_ASSERT_EQUALS(value.interpolate( -250), -62500);
+	TEST_ASSERT_EQUALS(value.interpolate( -248), -61510);
+	TEST_ASSERT_EQUALS(value.interpolate(   -1),     -5);
+	TEST_ASSERT_EQUALS(value.interpolate(    0),      0);
+	TEST_ASSERT_EQUALS(value.interpolate(    3),     15);
+	TEST_ASSERT_EQUALS(value.interpolate(    5),     25);
+	TEST_ASSERT_EQUALS(value.interpolate(  123),  15135);
+	TEST_ASSERT_EQUALS(value.interpolate(  249),  62005);
+	TEST_ASSERT_EQUALS(value.interpolate(  250),  62500);
+	TEST_ASSERT_EQUALS(value.interpolate( 1000),  62500);
+
+	// Every supporting point maps to its own output
+	for (const Point& point : points) {
+		TEST_ASSERT_EQUALS(value.interpolate(point.getFirst()), point.getSecond());
+	}
+}
+
+void
+LinearInterpolationTest::testBlock()
+{
+	modm::interpolation::Linear<MyPair, modm::accessor::Flash> \
+		value(modm::accessor::asFlash(flashValues), 6);
+
+	const uint8_t input[] = { 0, 32, 100, 201, 219, 250 };
+	int16_t output[6] = {};
+	value.interpolate(input, output);
+
+	const int16_t expected[] = { -200, -180, 383, 3850, 19150, 20000 };
+	TEST_ASSERT_EQUALS_ARRAY(output, expected, 6);
+
+	// Only as many values as fit into the output
+	int16_t shorter[2] = {};
+	value.interpolate(input, std::span<int16_t>(shorter, 1));
+	TEST_ASSERT_EQUALS(shorter[0], -200);
+	TEST_ASSERT_EQUALS(shorter[1], 0);
+}
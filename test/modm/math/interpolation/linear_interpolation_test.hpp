@@ -22,5 +22,11 @@ struct LinearInterpolationTest : public unittest::TestSuite
 
 	void
 	testInterpolationFlash();
+
+	void
+	testBinarySearch();
+
+	void
+	testBlock();
 };
 
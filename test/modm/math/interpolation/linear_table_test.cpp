@@ -0,0 +1,185 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/interpolation/linear.hpp>
+#include <modm/math/interpolation/linear_table.hpp>
+
+#include "linear_table_test.hpp"
+
+namespace
+{
+	typedef modm::Pair<uint8_t, int16_t> IntegerPoint;
+
+	constexpr IntegerPoint integerPoints[6] =
+	{
+		{ 30, -200 },
+		{ 50, 0 },
+		{ 90, 50 },
+		{ 150, 2050 },
+		{ 200, 3000 },
+		{ 220, 20000 }
+	};
+
+	typedef modm::Pair<uint16_t, float> FloatPoint;
+
+	// Thermistor curve in steps of 4096
+	constexpr FloatPoint uniformPoints[9] =
+	{
+		{ 0, 150.f },
+		{ 4096, 110.f },
+		{ 8192, 82.5f },
+		{ 12288, 61.f },
+		{ 16384, 43.f },
+		{ 20480, 27.25f },
+		{ 24576, 12.f },
+		{ 28672, -5.5f },
+		{ 32768, -40.f }
+	};
+}
+
+void
+LinearTableTest::testConstexpr()
+{
+	constexpr modm::interpolation::LinearTable table(integerPoints);
+
+	static_assert(not table.isUniform());
+	static_assert(table.interpolate(10) == -200);
+	static_assert(table.interpolate(40) == -100);
+	static_assert(table.interpolate(220) == 20000);
+
+	constexpr modm::interpolation::LinearTable uniform(uniformPoints);
+	static_assert(uniform.isUniform());
+	static_assert(uniform.interpolate(6144) == 96.25f);
+
+	TEST_ASSERT_EQUALS(table.interpolate(150), 2050);
+	TEST_ASSERT_EQUALS_FLOAT(uniform.interpolate(30720), -22.75f);
+}
+
+void
+LinearTableTest::testInterpolationFloat()
+{
+	typedef modm::Pair<float, float> Point;
+
+	const Point points[5] =
+	{
+		{ -10.f, 50.f },
+		{ -2.5f, 12.f },
+		{ 50.f, 10.f },
+		{ 51.f, -3.f },
+		{ 100.f, 0.f }
+	};
+
+	modm::interpolation::LinearTable table(points);
+	modm::interpolation::Linear<Point> reference(points, 5);
+
+	TEST_ASSERT_FALSE(table.isUniform());
+	for (float x = -20.f; x <= 110.f; x += 0.25f) {
+		TEST_ASSERT_EQUALS_DELTA(table.interpolate(x), reference.interpolate(x), 1e-4f);
+	}
+	for (const Point& point : points) {
+		TEST_ASSERT_EQUALS(table.interpolate(point.getFirst()), point.getSecond());
+	}
+}
+
+void
+LinearTableTest::testInterpolationInteger()
+{
+	modm::interpolation::LinearTable table(integerPoints);
+	modm::interpolation::Linear<IntegerPoint> reference(integerPoints, 6);
+
+	// Rounded instead of truncated
+	TEST_ASSERT_EQUALS(table.interpolate(  0),  -200);
+	TEST_ASSERT_EQUALS(table.interpolate( 32),  -180);
+	TEST_ASSERT_EQUALS(table.interpolate( 90),    50);
+	TEST_ASSERT_EQUALS(table.interpolate(100),   383);
+	TEST_ASSERT_EQUALS(table.interpolate(110),   717);
+	TEST_ASSERT_EQUALS(table.interpolate(140),  1717);
+	TEST_ASSERT_EQUALS(table.interpolate(201),  3850);
+	TEST_ASSERT_EQUALS(table.interpolate(219), 19150);
+	TEST_ASSERT_EQUALS(table.interpolate(250), 20000);
+
+	for (int x = 0; x < 256; ++x)
+	{
+		const int16_t difference = table.interpolate(x) - reference.interpolate(x);
+		TEST_ASSERT_TRUE(difference >= -1 and difference <= 1);
+	}
+}
+
+void
+LinearTableTest::testUniform()
+{
+	modm::interpolation::LinearTable table(uniformPoints);
+	modm::interpolation::Linear<FloatPoint> reference(uniformPoints, 9);
+
+	TEST_ASSERT_TRUE(table.isUniform());
+	for (uint32_t x = 0; x <= 0xffff; x += 7) {
+		TEST_ASSERT_EQUALS_DELTA(table.interpolate(x), reference.interpolate(x), 1e-3f);
+	}
+	for (const FloatPoint& point : uniformPoints)
+	{
+		TEST_ASSERT_EQUALS(table.interpolate(point.getFirst()), point.getSecond());
+		TEST_ASSERT_EQUALS_DELTA(table.interpolate(point.getFirst() - 1),
+								 reference.interpolate(point.getFirst() - 1), 1e-3f);
+	}
+}
+
+void
+LinearTableTest::testBlock()
+{
+	constexpr modm::interpolation::LinearTable table(integerPoints);
+
+	const uint8_t input[] = { 0, 32, 100, 201, 219, 250 };
+	int16_t output[6] = {};
+	table.interpolate(input, output);
+
+	const int16_t expected[] = { -200, -180, 383, 3850, 19150, 20000 };
+	TEST_ASSERT_EQUALS_ARRAY(output, expected, 6);
+}
+
+void
+LinearTableTest::testStep()
+{
+	typedef modm::Pair<int16_t, int16_t> Point;
+
+	Point points[4] =
+	{
+		{ 0, 0 },
+		{ 5, 0 },
+		{ 5, 10 },
+		{ 10, 20 }
+	};
+	// Built at runtime
+	points[3] = { 10, 30 };
+
+	modm::interpolation::LinearTable table(points);
+	modm::interpolation::Linear<Point> reference(points, 4);
+
+	TEST_ASSERT_FALSE(table.isUniform());
+	TEST_ASSERT_EQUALS(table.interpolate(4), 0);
+	TEST_ASSERT_EQUALS(table.interpolate(5), 10);
+	TEST_ASSERT_EQUALS(table.interpolate(6), 14);
+	for (int16_t x = -5; x < 15; ++x)
+	{
+		if (x == 5) continue;
+		TEST_ASSERT_EQUALS(table.interpolate(x), reference.interpolate(x));
+	}
+
+	// A table of only a step
+	constexpr Point step[2] = { { 5, 0 }, { 5, 10 } };
+	constexpr modm::interpolation::LinearTable stepTable(step);
+	static_assert(stepTable.interpolate(4) == 0);
+	static_assert(stepTable.interpolate(5) == 10);
+	TEST_ASSERT_EQUALS(stepTable.interpolate(6), 10);
+
+	typedef modm::Pair<float, float> FloatPoint;
+	constexpr FloatPoint floatStep[3] = { { 0.f, 0.f }, { 1.f, 1.f }, { 1.f, 2.f } };
+	constexpr modm::interpolation::LinearTable floatTable(floatStep);
+	static_assert(floatTable.interpolate(0.5f) == 0.5f);
+	TEST_ASSERT_EQUALS(floatTable.interpolate(1.f), 2.f);
+}
@@ -371,6 +371,108 @@ MatrixTest::testMatrixMultiplication()
 	TEST_ASSERT_EQUALS(aa[1][2], 390);
 }
 
+namespace
+{
+
+template<typename T, uint8_t ROWS, uint8_t COLUMNS>
+modm::Matrix<T, ROWS, COLUMNS>
+createMatrix(int offset)
+{
+	modm::Matrix<T, ROWS, COLUMNS> m;
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			m[i][j] = T(((i * 7 + j * 3 + offset) % 11) - 5);
+		}
+	}
+	return m;
+}
+
+template<typename T, uint8_t ROWS, uint8_t INNER, uint8_t COLUMNS>
+bool
+checkProduct(const modm::Matrix<T, ROWS, INNER> &a, const modm::Matrix<T, INNER, COLUMNS> &b,
+		const modm::Matrix<T, ROWS, COLUMNS> &c)
+{
+	for (uint_fast8_t i = 0; i < ROWS; ++i) {
+		for (uint_fast8_t j = 0; j < COLUMNS; ++j) {
+			T sum = 0;
+			for (uint_fast8_t x = 0; x < INNER; ++x) {
+				sum += a[i][x] * b[x][j];
+			}
+			if (sum != c[i][j]) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+}
+
+void
+MatrixTest::testMatrixMultiplicationLarge()
+{
+	// sizes with and without a remainder of the vectorized columns
+	const auto a = createMatrix<float, 5, 7>(0);
+	const auto b = createMatrix<float, 7, 11>(1);
+	TEST_ASSERT_TRUE(checkProduct(a, b, a * b));
+
+	const auto c = createMatrix<double, 3, 3>(2);
+	TEST_ASSERT_TRUE(checkProduct(c, c, c * c));
+
+	const auto d = createMatrix<float, 16, 16>(3);
+	const auto e = createMatrix<float, 16, 16>(4);
+	TEST_ASSERT_TRUE(checkProduct(d, e, d * e));
+
+	const auto f = createMatrix<double, 12, 12>(5);
+	TEST_ASSERT_TRUE(checkProduct(f, f, f * f));
+
+	const auto g = createMatrix<int16_t, 4, 6>(6);
+	const auto h = createMatrix<int16_t, 6, 9>(7);
+	TEST_ASSERT_TRUE(checkProduct(g, h, g * h));
+
+	// 256 elements
+	TEST_ASSERT_TRUE(d != e);
+	TEST_ASSERT_TRUE((d - d) == (modm::Matrix<float, 16, 16>::zeroMatrix()));
+	TEST_ASSERT_EQUALS((modm::Matrix<float, 16, 16>::identityMatrix()[15][15]), 1.f);
+}
+
+void
+MatrixTest::testMultiplyAdd()
+{
+	const auto a = createMatrix<float, 6, 5>(0);
+	const auto b = createMatrix<float, 5, 9>(1);
+	const auto c = createMatrix<float, 6, 9>(2);
+	TEST_ASSERT_TRUE(a.multiplyAdd(b, c) == (a * b + c));
+
+	const auto d = createMatrix<double, 12, 12>(3);
+	const auto e = createMatrix<double, 12, 12>(4);
+	TEST_ASSERT_TRUE(d.multiplyAdd(d, e) == (d * d + e));
+
+	const auto f = createMatrix<int16_t, 3, 2>(5);
+	const auto g = createMatrix<int16_t, 2, 3>(6);
+	const auto h = createMatrix<int16_t, 3, 3>(7);
+	TEST_ASSERT_TRUE(f.multiplyAdd(g, h) == (f * g + h));
+}
+
+void
+MatrixTest::testMultiplyTransposed()
+{
+	const auto a = createMatrix<float, 6, 5>(0);
+	const auto b = createMatrix<float, 9, 5>(1);
+	const auto c = createMatrix<float, 6, 9>(2);
+	TEST_ASSERT_TRUE(a.multiplyTransposed(b) == (a * b.asTransposed()));
+	TEST_ASSERT_TRUE(a.multiplyTransposedAdd(b, c) == (a * b.asTransposed() + c));
+
+	// covariance prediction
+	const auto f = createMatrix<double, 12, 12>(3);
+	const auto p = createMatrix<double, 12, 12>(4);
+	const auto q = createMatrix<double, 12, 12>(5);
+	TEST_ASSERT_TRUE((f * p).multiplyTransposedAdd(f, q) == (f * p * f.asTransposed() + q));
+
+	const auto g = createMatrix<int16_t, 3, 2>(6);
+	TEST_ASSERT_TRUE(g.multiplyTransposed(g) == (g * g.asTransposed()));
+}
+
 void
 MatrixTest::testTranspose()
 {
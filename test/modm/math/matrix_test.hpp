@@ -47,6 +47,15 @@ public:
 	void
 	testMatrixMultiplication();
 
+	void
+	testMatrixMultiplicationLarge();
+
+	void
+	testMultiplyAdd();
+
+	void
+	testMultiplyTransposed();
+
 	void
 	testTranspose();
 
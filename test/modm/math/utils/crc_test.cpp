@@ -0,0 +1,92 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/utils/crc.hpp>
+
+#include "crc_test.hpp"
+
+using namespace modm::math;
+
+namespace
+{
+const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+uint8_t buffer[300];
+
+void
+fillBuffer()
+{
+	uint32_t state{0x12345678};
+	for (auto& value : buffer)
+	{
+		state = state * 1664525ul + 1013904223ul;
+		value = state >> 24;
+	}
+}
+}
+
+void
+CrcTest::testCheckValues()
+{
+	TEST_ASSERT_EQUALS(crc16_ccitt(check, sizeof(check)), 0x6F91u);
+	TEST_ASSERT_EQUALS(crc32(check, sizeof(check)), 0xCBF43926ul);
+
+	TEST_ASSERT_EQUALS(crc16_ccitt<CrcPolicy::Table>(check, sizeof(check)), 0x6F91u);
+	TEST_ASSERT_EQUALS(crc32<CrcPolicy::Table>(check, sizeof(check)), 0xCBF43926ul);
+
+	TEST_ASSERT_EQUALS(crc16_ccitt<CrcPolicy::Slice8>(check, sizeof(check)), 0x6F91u);
+	TEST_ASSERT_EQUALS(crc32<CrcPolicy::Slice8>(check, sizeof(check)), 0xCBF43926ul);
+
+	TEST_ASSERT_EQUALS(crc32<CrcPolicy::Hardware>(check, sizeof(check)), 0xCBF43926ul);
+}
+
+void
+CrcTest::testPolicies()
+{
+	fillBuffer();
+	// all offsets and lengths around the 8 byte slices and 64 byte blocks
+	for (size_t offset = 0; offset < 8; offset++)
+	{
+		for (size_t length = 0; length <= sizeof(buffer) - 8; length += 7)
+		{
+			const uint8_t *data = buffer + offset;
+
+			const uint8_t crc8 = crc8_ccitt(data, length);
+			TEST_ASSERT_EQUALS(crc8_ccitt<CrcPolicy::Table>(data, length), crc8);
+			TEST_ASSERT_EQUALS(crc8_ccitt<CrcPolicy::Slice8>(data, length), crc8);
+			TEST_ASSERT_EQUALS(crc8_ccitt<CrcPolicy::Hardware>(data, length), crc8);
+
+			const uint16_t crc16 = crc16_ccitt(data, length);
+			TEST_ASSERT_EQUALS(crc16_ccitt<CrcPolicy::Table>(data, length), crc16);
+			TEST_ASSERT_EQUALS(crc16_ccitt<CrcPolicy::Slice8>(data, length), crc16);
+			TEST_ASSERT_EQUALS(crc16_ccitt<CrcPolicy::Hardware>(data, length), crc16);
+
+			const uint32_t crc32 = modm::math::crc32(data, length);
+			TEST_ASSERT_EQUALS(modm::math::crc32<CrcPolicy::Table>(data, length), crc32);
+			TEST_ASSERT_EQUALS(modm::math::crc32<CrcPolicy::Slice8>(data, length), crc32);
+			TEST_ASSERT_EQUALS(modm::math::crc32<CrcPolicy::Hardware>(data, length), crc32);
+		}
+	}
+}
+
+void
+CrcTest::testIncrementalUpdate()
+{
+	fillBuffer();
+	uint32_t crc{crc32_init};
+	crc = crc32_update<CrcPolicy::Hardware>(crc, buffer, 100);
+	crc = crc32_update<CrcPolicy::Slice8>(crc, buffer + 100, 37);
+	crc = crc32_update(crc, buffer + 137, sizeof(buffer) - 137);
+	TEST_ASSERT_EQUALS(~crc, crc32(buffer, sizeof(buffer)));
+
+	uint16_t crc16{crc16_ccitt_init};
+	crc16 = crc16_ccitt_update<CrcPolicy::Table>(crc16, buffer, 3);
+	crc16 = crc16_ccitt_update(crc16, buffer + 3, sizeof(buffer) - 3);
+	TEST_ASSERT_EQUALS(crc16, crc16_ccitt(buffer, sizeof(buffer)));
+}
@@ -26,7 +26,7 @@ class IODevice : public modm::IODevice
 {
 public:
 	inline IODevice() :
-		bytesWritten(0) {}
+		bytesWritten(0), writeCalls(0) {}
 
 	/// Write a single char to the buffer.
 	inline virtual void
@@ -34,6 +34,16 @@ public:
 	{
 		this->buffer[this->bytesWritten] = c;
 		this->bytesWritten++;
+		this->writeCalls++;
+	}
+
+	/// Write a block of bytes to the buffer.
+	inline virtual void
+	write(std::span<const uint8_t> data)
+	{
+		memcpy(this->buffer + this->bytesWritten, data.data(), data.size());
+		this->bytesWritten += data.size();
+		this->writeCalls++;
 	}
 
 	using modm::IODevice::write;
@@ -57,11 +67,13 @@ public:
 	{
 		memset(this->buffer, 0, this->buffer_length);
 		this->bytesWritten = 0;
+		this->writeCalls = 0;
 	}
 
 	static constexpr std::size_t buffer_length = 100;
 	char buffer[buffer_length];
 	size_t bytesWritten;
+	size_t writeCalls;
 };
 
 } // modm_test::platform namespace
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "fiber_reactor_test.hpp"
+#include "shared.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+
+static int fds[2];
+
+void
+ReactorTest::setUp()
+{
+	state = 0;
+	TEST_ASSERT_EQUALS(pipe2(fds, O_NONBLOCK), 0);
+}
+
+void
+ReactorTest::tearDown()
+{
+	modm::fiber::Reactor::remove(fds[0]);
+	modm::fiber::Reactor::remove(fds[1]);
+	close(fds[0]);
+	close(fds[1]);
+}
+
+// ============================== WAIT READABLE ===============================
+static void
+f1()
+{
+	char c;
+	TEST_ASSERT_EQUALS(state++, 0u);
+	TEST_ASSERT_EQUALS(read(fds[0], &c, 1), -1);
+	modm::this_fiber::wait_readable(fds[0]); // goto 1
+	TEST_ASSERT_EQUALS(state++, 3u);
+	TEST_ASSERT_EQUALS(read(fds[0], &c, 1), 1);
+	TEST_ASSERT_EQUALS(c, 'a');
+}
+
+static void
+f2()
+{
+	TEST_ASSERT_EQUALS(state++, 1u);
+	// f1 is parked until the pipe is readable
+	for (uint8_t ii = 0; ii < 10; ii++) modm::this_fiber::yield();
+	TEST_ASSERT_EQUALS(state++, 2u);
+	TEST_ASSERT_EQUALS(write(fds[1], "a", 1), 1);
+	// the reactor is polled when no fiber is runnable, goto 3
+}
+
+void
+ReactorTest::testWaitReadable()
+{
+	modm::fiber::Task fiber1(stack1, f1), fiber2(stack2, f2);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 4u);
+}
+
+// ========================== READINESS BEFORE WAIT ===========================
+static void
+f3()
+{
+	char c;
+	TEST_ASSERT_EQUALS(state++, 0u);
+	TEST_ASSERT_EQUALS(write(fds[1], "a", 1), 1);
+	modm::this_fiber::wait_readable(fds[0]); // goto 1
+	TEST_ASSERT_EQUALS(state++, 2u);
+	TEST_ASSERT_EQUALS(read(fds[0], &c, 1), 1);
+	TEST_ASSERT_EQUALS(read(fds[0], &c, 1), -1);
+
+	// the pipe becomes readable while no fiber is waiting
+	TEST_ASSERT_EQUALS(write(fds[1], "b", 1), 1);
+	TEST_ASSERT_TRUE(modm::fiber::Reactor::poll(std::chrono::milliseconds(10)) >= 1);
+	// the readiness was remembered, so this must not suspend
+	modm::this_fiber::wait_readable(fds[0]);
+	TEST_ASSERT_EQUALS(state++, 3u);
+	TEST_ASSERT_EQUALS(read(fds[0], &c, 1), 1);
+	TEST_ASSERT_EQUALS(c, 'b');
+}
+
+static void
+f4()
+{
+	TEST_ASSERT_EQUALS(state++, 1u);
+	// the reactor is polled when no fiber is runnable, goto 2
+}
+
+void
+ReactorTest::testReadinessBeforeWait()
+{
+	modm::fiber::Task fiber1(stack1, f3), fiber2(stack2, f4);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 4u);
+}
+
+// ================================== REMOVE ==================================
+static void
+f5()
+{
+	TEST_ASSERT_EQUALS(state++, 0u);
+	modm::this_fiber::wait_readable(fds[0]); // goto 1
+	TEST_ASSERT_EQUALS(state++, 2u);
+}
+
+static void
+f6()
+{
+	TEST_ASSERT_EQUALS(state++, 1u);
+	// removing the file descriptor wakes up all waiting fibers
+	modm::fiber::Reactor::remove(fds[0]);
+	modm::this_fiber::yield(); // goto 2
+	TEST_ASSERT_EQUALS(state++, 3u);
+}
+
+void
+ReactorTest::testRemove()
+{
+	modm::fiber::Task fiber1(stack1, f5), fiber2(stack2, f6);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 4u);
+}
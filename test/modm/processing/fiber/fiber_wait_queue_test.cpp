@@ -0,0 +1,127 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "fiber_wait_queue_test.hpp"
+#include "shared.hpp"
+#include <modm/processing/fiber/wait_queue.hpp>
+
+static modm::fiber::WaitQueue queue;
+static uint8_t evaluations;
+static bool condition_value;
+
+static bool
+condition()
+{
+	evaluations++;
+	return condition_value;
+}
+
+void
+WaitQueueTest::setUp()
+{
+	state = 0;
+	evaluations = 0;
+	condition_value = false;
+}
+
+// ============================== WAIT NOTIFY ONE =============================
+static void
+f1()
+{
+	TEST_ASSERT_EQUALS(state++, 0u);
+	queue.wait(condition); // goto 1
+	TEST_ASSERT_EQUALS(evaluations, 1u);
+	TEST_ASSERT_EQUALS(state++, 2u);
+}
+
+static void
+f2()
+{
+	TEST_ASSERT_EQUALS(state++, 1u);
+	TEST_ASSERT_FALSE(queue.empty());
+	// f1 is not scheduled anymore and does not poll the condition
+	for (uint8_t ii = 0; ii < 10; ii++) modm::this_fiber::yield();
+	TEST_ASSERT_EQUALS(evaluations, 1u);
+	TEST_ASSERT_EQUALS(state, 2u);
+
+	TEST_ASSERT_TRUE(queue.notify_one());
+	TEST_ASSERT_FALSE(queue.notify_one());
+	TEST_ASSERT_TRUE(queue.empty());
+	modm::this_fiber::yield(); // goto 2
+
+	TEST_ASSERT_EQUALS(state++, 3u);
+}
+
+void
+WaitQueueTest::testWaitNotifyOne()
+{
+	TEST_ASSERT_TRUE(queue.empty());
+	TEST_ASSERT_FALSE(queue.notify_one());
+
+	modm::fiber::Task fiber1(stack1, f1), fiber2(stack2, f2);
+	modm::fiber::Scheduler::run();
+}
+
+// =============================== WAIT CONDITION =============================
+static void
+f3()
+{
+	TEST_ASSERT_EQUALS(state++, 0u);
+	condition_value = true;
+	queue.wait(condition); // does not wait
+	TEST_ASSERT_EQUALS(evaluations, 1u);
+	TEST_ASSERT_TRUE(queue.empty());
+	TEST_ASSERT_EQUALS(state++, 1u);
+}
+
+void
+WaitQueueTest::testWaitCondition()
+{
+	// polls the condition outside of a fiber
+	condition_value = true;
+	queue.wait(condition);
+	TEST_ASSERT_EQUALS(evaluations, 1u);
+	evaluations = 0;
+	condition_value = false;
+
+	modm::fiber::Task fiber1(stack1, f3);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 2u);
+}
+
+// ================================ NOTIFY ALL ================================
+static void
+f4()
+{
+	TEST_ASSERT_EQUALS(state++, 0u);
+	queue.wait(condition); // goto 1
+	TEST_ASSERT_EQUALS(state++, 2u);
+	queue.notify_all();
+	modm::this_fiber::yield(); // goto 3
+	TEST_ASSERT_EQUALS(state++, 4u);
+}
+
+static void
+f5()
+{
+	TEST_ASSERT_EQUALS(state++, 1u);
+	queue.notify_all();
+	// f4 is appended behind f5
+	queue.wait(condition); // goto 2
+	TEST_ASSERT_EQUALS(state++, 3u);
+	TEST_ASSERT_EQUALS(evaluations, 2u);
+}
+
+void
+WaitQueueTest::testNotifyAll()
+{
+	modm::fiber::Task fiber1(stack1, f4), fiber2(stack2, f5);
+	modm::fiber::Scheduler::run();
+	TEST_ASSERT_EQUALS(state, 5u);
+}
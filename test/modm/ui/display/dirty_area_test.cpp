@@ -0,0 +1,240 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "dirty_area_test.hpp"
+
+#include <modm/ui/display/monochrome_graphic_display_horizontal.hpp>
+#include <modm/ui/display/monochrome_graphic_display_vertical.hpp>
+
+#include <array>
+
+namespace
+{
+
+// Gives access to the dirty area as seen by the driver
+template<class Base>
+class DirtyDisplay : public Base
+{
+public:
+	using Base::setPixel;
+	using Base::clearPixel;
+	using Base::getPixel;
+	using Base::drawImageRow;
+	using Base::takeDirtyArea;
+
+	void update() override {}
+};
+
+// Buffer of 64 columns and 4 pages
+using VerticalDisplay = DirtyDisplay<modm::MonochromeGraphicDisplayVertical<64, 32>>;
+// Buffer of 8 byte columns and 32 rows
+using HorizontalDisplay = DirtyDisplay<modm::MonochromeGraphicDisplayHorizontal<64, 32>>;
+
+using Rect = std::array<uint16_t, 4>;
+
+template<class Area>
+Rect
+rect(const Area& area)
+{
+	return {area.x0, area.y0, area.x1, area.y1};
+}
+
+// 8x16 pixels, column-major with 8 vertical pixels per byte
+constexpr uint8_t image[] = {
+	0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81,
+	0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00};
+
+// 16 pixels, row-major with 8 horizontal pixels per byte
+constexpr uint8_t row[] = {0xa5, 0x3c};
+
+}
+
+void
+DirtyAreaTest::testVerticalPixels()
+{
+	VerticalDisplay display;
+	// The first update transfers the whole buffer
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 0, 64, 4}), 4);
+	TEST_ASSERT_TRUE(display.getDirtyArea().isEmpty());
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+
+	display.setPixel(10, 9);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.getDirtyArea()), (Rect{10, 1, 11, 2}), 4);
+	display.clearPixel(3, 30);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.getDirtyArea()), (Rect{3, 1, 11, 4}), 4);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{3, 1, 11, 4}), 4);
+	TEST_ASSERT_TRUE(display.getDirtyArea().isEmpty());
+
+	// Pixels outside of the buffer do not change it
+	display.setPixel(-1, 0);
+	display.setPixel(0, -1);
+	display.setPixel(64, 0);
+	display.clearPixel(0, 32);
+	display.clearPixel(-8, -8);
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+
+	display.setPixel(63, 31);
+	TEST_ASSERT_TRUE(display.getPixel(63, 31));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{63, 3, 64, 4}), 4);
+}
+
+void
+DirtyAreaTest::testVerticalLines()
+{
+	VerticalDisplay display;
+	display.takeDirtyArea();
+
+	display.drawLine(5, 17, 20, 17);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{5, 2, 21, 3}), 4);
+	display.drawLine(7, 12, 7, 3);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{7, 0, 8, 2}), 4);
+	display.drawLine(7, 8, 7, 15);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{7, 1, 8, 2}), 4);
+	display.drawLine(0, 0, 20, 10);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 0, 21, 2}), 4);
+	display.drawRectangle(4, 4, 10, 10);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{4, 0, 14, 2}), 4);
+
+	// Clipped at the borders
+	display.drawLine(-5, 8, 100, 8);
+	TEST_ASSERT_TRUE(display.getPixel(0, 8) and display.getPixel(63, 8));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 1, 64, 2}), 4);
+	display.drawLine(2, -10, 2, 40);
+	TEST_ASSERT_TRUE(display.getPixel(2, 0) and display.getPixel(2, 31));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{2, 0, 3, 4}), 4);
+	display.drawLine(-3, 20, 1, 24);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 2, 2, 4}), 4);
+
+	// Completely outside of the buffer
+	display.drawLine(70, 0, 80, 0);
+	display.drawLine(-20, 0, -10, 0);
+	display.drawLine(10, -20, 10, -2);
+	display.drawLine(10, 40, 10, 50);
+	display.drawLine(0, 35, 10, 35);
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+}
+
+void
+DirtyAreaTest::testVerticalImage()
+{
+	VerticalDisplay display;
+	display.takeDirtyArea();
+
+	// Page aligned
+	display.drawImageRaw({16, 8}, 8, 16, modm::accessor::asFlash(image));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{16, 1, 24, 3}), 4);
+	// Not page aligned
+	display.drawImageRaw({16, 3}, 8, 8, modm::accessor::asFlash(image));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{16, 0, 24, 2}), 4);
+
+	// Clipped at the borders
+	display.drawImageRaw({-4, 24}, 8, 16, modm::accessor::asFlash(image));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 3, 4, 4}), 4);
+	display.drawImageRaw({60, -8}, 8, 16, modm::accessor::asFlash(image));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{60, 0, 64, 1}), 4);
+	display.drawImageRaw({62, -3}, 8, 8, modm::accessor::asFlash(image));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{62, 0, 64, 1}), 4);
+	display.drawImageRaw({64, 0}, 8, 16, modm::accessor::asFlash(image));
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+}
+
+void
+DirtyAreaTest::testHorizontalPixels()
+{
+	HorizontalDisplay display;
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 0, 8, 32}), 4);
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+
+	display.setPixel(10, 9);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.getDirtyArea()), (Rect{1, 9, 2, 10}), 4);
+	display.clearPixel(63, 31);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{1, 9, 8, 32}), 4);
+
+	display.setPixel(-1, 5);
+	display.setPixel(5, -1);
+	display.setPixel(64, 5);
+	display.clearPixel(5, 32);
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+}
+
+void
+DirtyAreaTest::testHorizontalLines()
+{
+	HorizontalDisplay display;
+	display.takeDirtyArea();
+
+	display.drawLine(3, 5, 20, 5);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 5, 3, 6}), 4);
+	display.drawLine(17, 30, 17, 2);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{2, 2, 3, 31}), 4);
+	display.drawLine(8, 0, 15, 3);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{1, 0, 2, 4}), 4);
+
+	// Clipped at the borders
+	display.drawLine(-5, 0, 100, 0);
+	TEST_ASSERT_TRUE(display.getPixel(0, 0) and display.getPixel(63, 0));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 0, 8, 1}), 4);
+	display.drawLine(60, -3, 60, 40);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{7, 0, 8, 32}), 4);
+
+	display.drawLine(70, 0, 80, 0);
+	display.drawLine(0, -10, 0, -1);
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+}
+
+void
+DirtyAreaTest::testHorizontalImage()
+{
+	HorizontalDisplay display;
+	display.takeDirtyArea();
+
+	display.drawImageRaw({12, 4}, 8, 3, modm::accessor::asFlash(image));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{1, 4, 3, 7}), 4);
+
+	// Rows are merged into the buffer bytes
+	display.drawImageRow({12, 4}, 10, row);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{1, 4, 3, 5}), 4);
+	display.drawImageRow({16, 6}, 16, row);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{2, 6, 4, 7}), 4);
+
+	// Clipped at the borders
+	display.drawImageRow({-4, 30}, 16, row);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 30, 2, 31}), 4);
+	display.drawImageRow({60, 0}, 16, row);
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{7, 0, 8, 1}), 4);
+	display.drawImageRaw({-4, 28}, 8, 16, modm::accessor::asFlash(image));
+	TEST_ASSERT_EQUALS_ARRAY(rect(display.takeDirtyArea()), (Rect{0, 28, 1, 32}), 4);
+
+	display.drawImageRow({0, 32}, 16, row);
+	display.drawImageRow({0, -1}, 16, row);
+	display.drawImageRow({64, 0}, 16, row);
+	TEST_ASSERT_TRUE(display.takeDirtyArea().isEmpty());
+}
+
+void
+DirtyAreaTest::testClear()
+{
+	VerticalDisplay vertical;
+	vertical.takeDirtyArea();
+	vertical.setPixel(1, 1);
+	vertical.clear();
+	TEST_ASSERT_FALSE(vertical.getPixel(1, 1));
+	TEST_ASSERT_EQUALS_ARRAY(rect(vertical.takeDirtyArea()), (Rect{0, 0, 64, 4}), 4);
+	vertical.invalidate();
+	TEST_ASSERT_EQUALS_ARRAY(rect(vertical.takeDirtyArea()), (Rect{0, 0, 64, 4}), 4);
+	TEST_ASSERT_TRUE(vertical.takeDirtyArea().isEmpty());
+
+	HorizontalDisplay horizontal;
+	horizontal.takeDirtyArea();
+	horizontal.clear();
+	TEST_ASSERT_EQUALS_ARRAY(rect(horizontal.takeDirtyArea()), (Rect{0, 0, 8, 32}), 4);
+	horizontal.invalidate();
+	TEST_ASSERT_EQUALS_ARRAY(rect(horizontal.takeDirtyArea()), (Rect{0, 0, 8, 32}), 4);
+	TEST_ASSERT_TRUE(horizontal.takeDirtyArea().isEmpty());
+}
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "font_atlas_test.hpp"
+
+#include <modm/ui/display/font.hpp>
+#include <modm/ui/display/monochrome_graphic_display_horizontal.hpp>
+#include <modm/ui/display/monochrome_graphic_display_vertical.hpp>
+
+namespace
+{
+
+constexpr int16_t Width = 128;
+constexpr int16_t Height = 64;
+
+// Only uses setPixel() and clearPixel(), so it exercises the default hooks
+class PixelDisplay : public modm::GraphicDisplay
+{
+public:
+	uint16_t getWidth() const override { return Width; }
+	uint16_t getHeight() const override { return Height; }
+	std::size_t getBufferWidth() const override { return Width; }
+	std::size_t getBufferHeight() const override { return Height; }
+
+	void
+	setPixel(int16_t x, int16_t y) override
+	{
+		if (x >= 0 and x < Width and y >= 0 and y < Height) { pixels[y][x] = true; }
+	}
+
+	void
+	clearPixel(int16_t x, int16_t y) override
+	{
+		if (x >= 0 and x < Width and y >= 0 and y < Height) { pixels[y][x] = false; }
+	}
+
+	bool
+	getPixel(int16_t x, int16_t y) const
+	{ return pixels[y][x]; }
+
+	void clear() override {}
+	void update() override {}
+
+	bool pixels[Height][Width]{};
+};
+
+template< class Base >
+class BufferedDisplay : public Base
+{
+public:
+	using Base::getPixel;
+	void update() override {}
+};
+
+using HorizontalDisplay = BufferedDisplay<modm::MonochromeGraphicDisplayHorizontal<Width, Height>>;
+using VerticalDisplay = BufferedDisplay<modm::MonochromeGraphicDisplayVertical<Width, Height>>;
+
+// Draws the text with both fonts on a filled display and compares all pixels
+template< class Display >
+bool
+drawsEqual(const uint8_t *legacy, const uint8_t *atlas, modm::glcd::Point position, const char *text)
+{
+	Display reference, display;
+	for (Display* d : {&reference, &display}) {
+		d->fillRectangle(0, 0, Width, Height);
+	}
+	reference.setFont(legacy);
+	display.setFont(atlas);
+	reference.setCursor(position);
+	display.setCursor(position);
+	reference << text;
+	display << text;
+
+	if (reference.getCursor() != display.getCursor()) { return false; }
+	for (int16_t y = 0; y < Height; y++)
+	{
+		for (int16_t x = 0; x < Width; x++)
+		{
+			if (reference.getPixel(x, y) != display.getPixel(x, y)) { return false; }
+		}
+	}
+	return true;
+}
+
+constexpr const char* text = "Hello, World!\n0123 {|}~";
+
+}
+
+void
+FontAtlasTest::testStringWidth()
+{
+	const auto legacy = modm::accessor::asFlash(modm::font::FixedWidth5x8);
+	const auto atlas = modm::accessor::asFlash(modm::font::FixedWidth5x8Atlas);
+	TEST_ASSERT_EQUALS(modm::GraphicDisplay::getStringWidth("Hello 42", &atlas),
+					   modm::GraphicDisplay::getStringWidth("Hello 42", &legacy));
+	TEST_ASSERT_EQUALS(modm::GraphicDisplay::getFontHeight(&atlas), 8u);
+
+	const auto numbers = modm::accessor::asFlash(modm::font::Numbers46x64Atlas);
+	TEST_ASSERT_EQUALS(modm::GraphicDisplay::getStringWidth("12", &numbers), 2u * (46 + 4));
+	TEST_ASSERT_EQUALS(modm::GraphicDisplay::getFontHeight(&numbers), 64u);
+}
+
+void
+FontAtlasTest::testGenericDisplay()
+{
+	TEST_ASSERT_TRUE(drawsEqual<PixelDisplay>(modm::font::FixedWidth5x8,
+			modm::font::FixedWidth5x8Atlas, {0, 0}, text));
+	TEST_ASSERT_TRUE(drawsEqual<PixelDisplay>(modm::font::FixedWidth5x8,
+			modm::font::FixedWidth5x8Atlas, {-3, 58}, text));
+}
+
+void
+FontAtlasTest::testHorizontalDisplay()
+{
+	// byte aligned, unaligned and clipped at the borders
+	for (int16_t x : {0, 8, 3, 13, -2, 100})
+	{
+		TEST_ASSERT_TRUE(drawsEqual<HorizontalDisplay>(modm::font::FixedWidth5x8,
+				modm::font::FixedWidth5x8Atlas, {x, 5}, text));
+	}
+}
+
+void
+FontAtlasTest::testVerticalDisplay()
+{
+	for (int16_t y : {0, 3, 60})
+	{
+		TEST_ASSERT_TRUE(drawsEqual<VerticalDisplay>(modm::font::FixedWidth5x8,
+				modm::font::FixedWidth5x8Atlas, {1, y}, text));
+	}
+}
+
+void
+FontAtlasTest::testRunLength()
+{
+	TEST_ASSERT_TRUE(drawsEqual<HorizontalDisplay>(modm::font::Numbers46x64,
+			modm::font::Numbers46x64Atlas, {5, 0}, "09"));
+	TEST_ASSERT_TRUE(drawsEqual<PixelDisplay>(modm::font::Numbers46x64,
+			modm::font::Numbers46x64Atlas, {30, 0}, "5678"));
+}
@@ -0,0 +1,251 @@
+/*
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "graphic_display_test.hpp"
+
+#include <modm/ui/display/graphic_display.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+
+namespace
+{
+
+constexpr int16_t Size = 64;
+
+// Records the pixels and counts the calls of the span hooks
+class RecordingDisplay : public modm::GraphicDisplay
+{
+public:
+	uint16_t getWidth() const override { return Size; }
+	uint16_t getHeight() const override { return Size; }
+	std::size_t getBufferWidth() const override { return Size; }
+	std::size_t getBufferHeight() const override { return Size; }
+
+	void
+	setPixel(int16_t x, int16_t y) override
+	{
+		if (x >= 0 and x < Size and y >= 0 and y < Size) { pixels[y][x] = true; }
+	}
+
+	void
+	clearPixel(int16_t x, int16_t y) override
+	{
+		if (x >= 0 and x < Size and y >= 0 and y < Size) { pixels[y][x] = false; }
+	}
+
+	void clear() override {}
+	void update() override {}
+
+	uint16_t
+	count() const
+	{
+		uint16_t count{0};
+		for (const auto& row : pixels)
+			for (bool pixel : row) count += pixel;
+		return count;
+	}
+
+	bool pixels[Size][Size]{};
+	uint16_t horizontalRuns{0};
+	uint16_t verticalRuns{0};
+
+protected:
+	void
+	drawHorizontalLine(modm::glcd::Point start, uint16_t length) override
+	{
+		horizontalRuns++;
+		GraphicDisplay::drawHorizontalLine(start, length);
+	}
+
+	void
+	drawVerticalLine(modm::glcd::Point start, uint16_t length) override
+	{
+		verticalRuns++;
+		GraphicDisplay::drawVerticalLine(start, length);
+	}
+};
+
+// Writes the runs into an address window like a TFT controller, whose
+// coordinates are unsigned and must be within the display
+class WindowDisplay : public RecordingDisplay
+{
+public:
+	uint16_t outsideRuns{0};
+
+protected:
+	void
+	drawHorizontalLine(modm::glcd::Point start, uint16_t length) override
+	{
+		fill(start.x, start.y, length, 1);
+	}
+
+	void
+	drawVerticalLine(modm::glcd::Point start, uint16_t length) override
+	{
+		fill(start.x, start.y, 1, length);
+	}
+
+	void
+	fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+	{
+		if (width == 0 or height == 0 or x + width > Size or y + height > Size)
+		{
+			outsideRuns++;
+			return;
+		}
+		for (uint16_t row = y; row < y + height; row++)
+			for (uint16_t column = x; column < x + width; column++) pixels[row][column] = true;
+	}
+};
+
+// Draws the shape through the span hooks and pixel by pixel
+template<typename Draw>
+bool
+drawsClipped(Draw&& draw)
+{
+	RecordingDisplay reference;
+	WindowDisplay window;
+	draw(static_cast<modm::GraphicDisplay&>(reference));
+	draw(static_cast<modm::GraphicDisplay&>(window));
+	return window.outsideRuns == 0 and reference.count() > 0 and
+		   std::memcmp(reference.pixels, window.pixels, sizeof(window.pixels)) == 0;
+}
+
+}
+
+void
+GraphicDisplayTest::testLineRuns()
+{
+	RecordingDisplay display;
+	display.drawLine(0, 0, 9, 2);
+
+	// Three rows of pixels with one run each
+	TEST_ASSERT_EQUALS(display.horizontalRuns, 3);
+	TEST_ASSERT_EQUALS(display.verticalRuns, 0);
+	TEST_ASSERT_EQUALS(display.count(), 10);
+	TEST_ASSERT_TRUE(display.pixels[0][0]);
+	TEST_ASSERT_TRUE(display.pixels[1][5]);
+	TEST_ASSERT_TRUE(display.pixels[2][9]);
+
+	// Every column contains exactly one pixel
+	for (int16_t x = 0; x < 10; x++)
+	{
+		uint8_t column{0};
+		for (int16_t y = 0; y < 3; y++) column += display.pixels[y][x];
+		TEST_ASSERT_EQUALS(column, 1);
+	}
+
+	// The line is the same in both directions
+	RecordingDisplay reverse;
+	reverse.drawLine(9, 2, 0, 0);
+	TEST_ASSERT_EQUALS(reverse.count(), 10);
+	TEST_ASSERT_EQUALS(reverse.horizontalRuns, 3);
+}
+
+void
+GraphicDisplayTest::testSteepLineRuns()
+{
+	RecordingDisplay display;
+	display.drawLine(10, 40, 13, 0);
+
+	TEST_ASSERT_EQUALS(display.horizontalRuns, 0);
+	TEST_ASSERT_EQUALS(display.verticalRuns, 4);
+	TEST_ASSERT_EQUALS(display.count(), 41);
+	TEST_ASSERT_TRUE(display.pixels[40][10]);
+	TEST_ASSERT_TRUE(display.pixels[0][13]);
+}
+
+void
+GraphicDisplayTest::testCircle()
+{
+	for (uint16_t radius = 1; radius < 30; radius++)
+	{
+		RecordingDisplay display;
+		display.drawCircle(modm::glcd::Point(32, 32), radius);
+
+		for (int16_t y = 0; y < Size; y++)
+		{
+			for (int16_t x = 0; x < Size; x++)
+			{
+				if (not display.pixels[y][x]) continue;
+				// All pixels are on the circle and it is symmetric
+				const float distance = std::hypot(x - 32, y - 32);
+				TEST_ASSERT_TRUE(std::abs(distance - radius) < 1.f);
+				TEST_ASSERT_TRUE(display.pixels[64 - y][x]);
+				TEST_ASSERT_TRUE(display.pixels[y][64 - x]);
+				TEST_ASSERT_TRUE(display.pixels[x][y]);
+			}
+		}
+		TEST_ASSERT_TRUE(display.pixels[32][32 - radius]);
+		TEST_ASSERT_TRUE(display.pixels[32 + radius][32]);
+		// Large circles consist of runs instead of single pixels
+		if (radius >= 10)
+			TEST_ASSERT_TRUE(2 * (display.horizontalRuns + display.verticalRuns) < display.count());
+	}
+}
+
+void
+GraphicDisplayTest::testRoundedRectangle()
+{
+	RecordingDisplay display;
+	display.drawRoundedRectangle(modm::glcd::Point(4, 8), 40, 20, 5);
+
+	// Straight edges
+	TEST_ASSERT_TRUE(display.pixels[8][24]);
+	TEST_ASSERT_TRUE(display.pixels[28][24]);
+	TEST_ASSERT_TRUE(display.pixels[18][4]);
+	TEST_ASSERT_TRUE(display.pixels[18][44]);
+	// Rounded corners
+	TEST_ASSERT_FALSE(display.pixels[8][4]);
+	TEST_ASSERT_FALSE(display.pixels[28][44]);
+	TEST_ASSERT_TRUE(display.pixels[8][9]);
+	TEST_ASSERT_TRUE(display.pixels[13][4]);
+	TEST_ASSERT_TRUE(display.pixels[28][39]);
+	TEST_ASSERT_TRUE(display.pixels[23][44]);
+}
+
+void
+GraphicDisplayTest::testFillRectangleClipping()
+{
+	RecordingDisplay display;
+	display.fillRectangle(modm::glcd::Point(-5, 60), 10, 10);
+
+	TEST_ASSERT_EQUALS(display.count(), 5 * 4);
+	TEST_ASSERT_EQUALS(display.horizontalRuns, 4);
+	TEST_ASSERT_TRUE(display.pixels[60][0]);
+	TEST_ASSERT_TRUE(display.pixels[63][4]);
+}
+
+void
+GraphicDisplayTest::testClippedRuns()
+{
+	// Shapes crossing the left and top edges
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawCircle({3, 5}, 10); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawCircle({-4, -6}, 12); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawLine(-10, 20, 30, -7); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawLine(-3, -40, 5, 30); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawLine(-20, 3, 10, 3); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawLine(7, -20, 7, 10); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawRectangle({-5, -5}, 20, 20); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawRoundedRectangle({-6, -4}, 30, 20, 6); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.fillCircle({2, 2}, 8); }));
+	// and the right and bottom edges
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawCircle({60, 62}, 10); }));
+	TEST_ASSERT_TRUE(drawsClipped([](auto& display) { display.drawLine(40, 50, 100, 70); }));
+
+	// Runs completely outside are dropped
+	WindowDisplay display;
+	display.drawCircle({-20, -20}, 10);
+	display.drawLine(-10, -1, 100, -1);
+	display.drawLine(64, 0, 64, 63);
+	TEST_ASSERT_EQUALS(display.outsideRuns, 0);
+	TEST_ASSERT_EQUALS(display.count(), 0);
+}
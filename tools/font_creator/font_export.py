@@ -98,6 +98,40 @@ namespace modm
 
 """
 
+# -----------------------------------------------------------------------------
+template_atlas_source = """\
+${copyright}
+// created with font_export.py --atlas
+
+#include <modm/architecture/interface/accessor.hpp>
+
+namespace modm
+{
+	namespace font
+	{
+		FLASH_STORAGE(uint8_t ${array_name}[]) =
+		{
+			0x00, 0x00, // atlas format
+			${flags},	// flags
+			${height},	// height
+			${hspace},	// hspace
+			${vspace}, 	// vspace
+			${first},	// first char
+			${count},	// char count
+
+			// glyphs
+			// for each character the data offset (low, high), width and advance
+			${glyphs}
+
+			// glyph data
+			// ${data_description}
+			${font_data}
+		};
+	}
+}
+
+"""
+
 # -----------------------------------------------------------------------------
 class ParseException(Exception):
 	def __init__(self, msg, line):
@@ -119,9 +153,39 @@ class Char:
 		self.width = None
 		self.height = height
 		self.data = []
+		self.pixels = []
 
 		self.rows = int(math.ceil(height / 8.0))
 
+	def row_major_data(self):
+		"""Packs each row into whole bytes, least significant bit first."""
+		data = []
+		for row in self.pixels:
+			for x in range(0, self.width, 8):
+				data.append(sum(1 << i for i, pixel in enumerate(row[x:x + 8]) if pixel))
+		return data
+
+	def run_length_data(self):
+		"""
+		Encodes the rows as one stream of alternating background and
+		foreground runs, starting with the background. Runs longer than 255
+		pixels are continued after a run of length zero.
+		"""
+		data = []
+		color = False
+		length = 0
+		for pixel in (pixel for row in self.pixels for pixel in row):
+			if pixel != color:
+				data.append(length)
+				color = pixel
+				length = 0
+			elif length == 255:
+				data.extend([255, 0])
+				length = 0
+			length += 1
+		data.append(length)
+		return data
+
 # -----------------------------------------------------------------------------
 def read_font_file(filename):
 	char_mode = False
@@ -147,6 +211,7 @@ def read_font_file(filename):
 					raise ParseException("Illegal width for char %i" % char.number, line_number)
 			char.width = width
 
+			char.pixels.append([c == "#" for c in result.group(1)])
 			index = 0
 			for c in result.group(1):
 				if c == " ":
@@ -214,16 +279,72 @@ def read_font_file(filename):
 
 	return font
 
+# -----------------------------------------------------------------------------
+def export_atlas(font, outfile, run_length):
+	"""
+	Writes the font in the atlas format, which stores the data offset, width
+	and advance of every character in a table and the rows of each character
+	either packed into bytes or run-length encoded.
+	"""
+	glyphs = []
+	font_data = []
+	offset = 0
+	for char in font.chars:
+		data = char.run_length_data() if run_length else char.row_major_data()
+		if offset > 0xffff:
+			raise ValueError("Font data exceeds the 16-bit offsets of the atlas!")
+		advance = char.width + (font.vspace if char.index < 128 else 0)
+		glyphs.append("0x%02X, 0x%02X, %2i, %2i, // %i" %
+				(offset & 0xff, offset >> 8, char.width, advance, char.index))
+		font_data.append("".join("0x%02X, " % c for c in data) + "// %i" % char.index)
+		offset += len(data)
+
+	# 8 byte header, 4 byte glyph table
+	size = 8 + 4 * len(font.chars) + offset
+	substitutions = {
+		'copyright': template_copyright,
+		'font_name': font.name + " (Atlas)",
+		'array_name': ''.join([s[0].upper() + s[1:] for s in font.name.split(' ')]) + "Atlas",
+		'size': size,
+		'flags': "0x01" if run_length else "0x00",
+		'width': max(char.width for char in font.chars),
+		'width_string': "maximum width  ",
+		'height': font.height,
+		'hspace': font.hspace,
+		'vspace': font.vspace,
+		'first': font.first_char,
+		'last': font.first_char + len(font.chars),
+		'count': len(font.chars),
+		'glyphs': "\n\t\t\t".join(glyphs),
+		'data_description': "runs of alternating background and foreground pixels" if run_length else
+							"rows of all characters, least significant bit first",
+		'font_data': "\n\t\t\t".join(font_data),
+		'include_guard': "MODM_FONT__" + os.path.basename(outfile).upper().replace(" ", "_") + "_HPP"
+	}
+
+	output = string.Template(template_atlas_source).safe_substitute(substitutions)
+	open(outfile + ".cpp", 'w').write(output)
+
+	output = string.Template(template_header).safe_substitute(substitutions)
+	open(outfile + ".hpp", 'w').write(output)
+
 # -----------------------------------------------------------------------------
 if __name__ == '__main__':
-	try:
-		filename = os.sys.argv[1]
-		if not filename.endswith('.font'):
-			raise
-		outfile = os.sys.argv[2]
-	except:
-		print("usage: %s *.font outfile" % os.sys.argv[0])
-		exit(1)
+	import argparse
+
+	parser = argparse.ArgumentParser(description="Export a font to C++ source code.")
+	parser.add_argument(dest="filename", metavar="FONT", help="The *.font file.")
+	parser.add_argument(dest="outfile", metavar="OUTFILE", help="Output path without extension.")
+	parser.add_argument("--atlas", action="store_true",
+			help="Export in the atlas format with a glyph table and row-major data.")
+	parser.add_argument("--rle", action="store_true",
+			help="Run-length encode the glyphs of the atlas, useful for large fonts.")
+	args = parser.parse_args()
+
+	filename = args.filename
+	outfile = args.outfile
+	if not filename.endswith('.font'):
+		parser.error("FONT must be a *.font file")
 
 	try:
 		font = read_font_file(filename)
@@ -231,6 +352,10 @@ if __name__ == '__main__':
 		print("Error in line %i: " % e.line, e)
 		exit(1)
 
+	if args.atlas or args.rle:
+		export_atlas(font, outfile, args.rle)
+		exit(0)
+
 	width_histogram = {}
 	char_width = []
 	char_width_line = ""
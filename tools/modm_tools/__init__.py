@@ -1,5 +1,6 @@
 # modm Python tools
 from . import avrdude
+from . import binary_log
 from . import bitmap
 from . import bmp
 from . import bossac
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# This file is part of the modm project.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# -----------------------------------------------------------------------------
+
+r"""
+### Binary Log Decoder
+
+The records of the `modm:debug:binary` logger only contain an ID of the format
+string and the raw arguments. The format strings are stored in the ELF file,
+which is used to reconstruct the text:
+
+```sh
+python3 -m modm_tools.binary_log path/to/project.elf binary.log
+[     0.001234] Info:    motor 1: current=-4999 mA, speed=0.500000 rpm
+```
+
+If no log file is given, the records are read from stdin, so that you can pipe
+the output of a serial port into the decoder:
+
+```sh
+cat /dev/ttyACM0 | python3 -m modm_tools.binary_log path/to/project.elf
+```
+"""
+
+import re
+import struct
+import sys
+from elftools.elf.elffile import ELFFile
+
+LEVELS = ["Debug:   ", "Info:    ", "Warning: ", "Error:   "]
+HEADER_SIZE = 10
+# printf length modifiers are not supported by Python
+FORMAT_PATTERN = re.compile(r"%([-+ #0]*[\d*]*(?:\.[\d*]+)?)(hh|h|ll|l|j|z|t|L)?([diuoxXfFeEgGcspa%])")
+
+
+# -----------------------------------------------------------------------------
+def fnv1a(data):
+    value = 0x811c9dc5
+    for byte in data:
+        value = ((value ^ byte) * 0x01000193) & 0xffffffff
+    return value
+
+
+class Entry:
+    def __init__(self, level, types, fmt):
+        self.level = level
+        self.types = types
+        self.format = fmt
+
+    def __str__(self):
+        return LEVELS[self.level] + self.format
+
+
+def parse_entries(data):
+    """Parses the entries of the format string section, which may be padded."""
+    entries = {}
+    pos = 0
+    while pos < len(data):
+        if not (data[pos] & 0x80):
+            pos += 1
+            continue
+        start = pos
+        types_end = data.index(0, pos + 1)
+        format_end = data.index(0, types_end + 1)
+        entry = Entry(data[pos] & 0x7f, data[pos + 1:types_end].decode(),
+                      data[types_end + 1:format_end].decode(errors="replace"))
+        entries[fnv1a(data[start:format_end + 1])] = entry
+        pos = format_end + 1
+    return entries
+
+
+def read_entries(elf):
+    """Returns all format string entries of an ELF file indexed by their ID."""
+    with open(elf, "rb") as file:
+        elffile = ELFFile(file)
+        endian = "<" if elffile.little_endian else ">"
+        pointer = "I" if elffile.elfclass == 32 else "Q"
+        entries = {}
+        for section in elffile.iter_sections():
+            if section.name.startswith("modm_log_strings"):
+                entries.update(parse_entries(section.data()))
+    return entries, endian, pointer
+
+
+def unpack_arguments(types, data, endian, pointer):
+    values = []
+    pos = 0
+    for code in types:
+        if code == "s":
+            length = data[pos]
+            values.append(data[pos + 1:pos + 1 + length].decode(errors="replace"))
+            pos += 1 + length
+            continue
+        fmt = endian + (pointer if code == "P" else code)
+        value, = struct.unpack_from(fmt, data, pos)
+        if code == "c": value = value.decode(errors="replace")
+        values.append(value)
+        pos += struct.calcsize(fmt)
+    return values
+
+
+def format_message(entry, values):
+    values = iter(values)
+    def replace(match):
+        flags, conversion = match.group(1), match.group(3)
+        if conversion == "%": return "%"
+        value = next(values, None)
+        if value is None: return match.group(0)
+        if conversion == "p": return "0x{:x}".format(value)
+        if conversion in "diu": conversion = "d"
+        if conversion == "a": conversion = "e"
+        if conversion == "c" and isinstance(value, int): value = chr(value)
+        try:
+            return ("%" + flags + conversion) % value
+        except (TypeError, ValueError):
+            return str(value)
+    return FORMAT_PATTERN.sub(replace, entry.format)
+
+
+def decode(stream, entries, endian="<", pointer="I"):
+    """
+    Decodes the records from a binary stream.
+
+    :return: generator of (timestamp in µs, Entry or None, message) tuples.
+    """
+    header = endian + "IIH"
+    while True:
+        data = stream.read(HEADER_SIZE)
+        if len(data) < HEADER_SIZE: return
+        ident, timestamp, length = struct.unpack(header, data)
+        arguments = stream.read(length)
+        if len(arguments) < length: return
+        entry = entries.get(ident)
+        if entry is None:
+            yield timestamp, None, "Unknown format string 0x{:08x}: {}".format(ident, arguments.hex())
+        else:
+            values = unpack_arguments(entry.types, arguments, endian, pointer)
+            yield timestamp, entry, format_message(entry, values)
+
+
+def log(elf, stream, output=sys.stdout):
+    entries, endian, pointer = read_entries(elf)
+    # The 32-bit microsecond timestamp wraps around after 71 minutes
+    offset, last = 0, 0
+    for timestamp, entry, message in decode(stream, entries, endian, pointer):
+        if timestamp < last: offset += 1 << 32
+        last = timestamp
+        level = LEVELS[entry.level] if entry is not None else ""
+        print("[{:13.6f}] {}{}".format((offset + timestamp) / 1e6, level, message), file=output)
+
+
+# -----------------------------------------------------------------------------
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser(description="Decode binary log records.")
+    parser.add_argument(
+            dest="elf",
+            metavar="ELF",
+            help="The image containing the format strings.")
+    parser.add_argument(
+            dest="log",
+            metavar="LOG",
+            nargs="?",
+            default=None,
+            help="The binary log records, read from stdin by default.")
+
+    args = parser.parse_args()
+    if args.log is None:
+        log(args.elf, sys.stdin.buffer)
+    else:
+        with open(args.log, "rb") as stream:
+            log(args.elf, stream)
@@ -22,6 +22,47 @@ import filter.cpp as filter
 def filter_lower(value):
 	return value.lower().replace(" ", "_")
 
+# -----------------------------------------------------------------------------
+def hash16(value, multiplier, bits):
+	""" Multiplicative hash using the upper `bits` of a 16-bit product.
+	Must match the `hash()` function in postman.cpp.tpl! """
+	return ((value * multiplier) & 0xffff) >> (16 - bits)
+
+def place_bucket(bucket, slots, slotBits):
+	""" Searches for a displacement that places all keys into free slots """
+	for displacement in range(1 << 16):
+		positions = [hash16(key ^ displacement, 0x6a09, slotBits) for key in bucket]
+		if len(set(positions)) == len(positions) and not any(slots[p] for p in positions):
+			for key, position in zip(bucket, positions):
+				slots[position] = key
+			return displacement
+	return None
+
+def perfect_hash(keys):
+	""" Computes a perfect hash for non-zero 16-bit keys using hash and
+	displace: a key is mapped to a bucket, and all keys of a bucket are placed
+	into free slots by XOR-ing them with a displacement found by search.
+
+	Returns (bucketBits, slotBits, displacements, slots) with `slots[i]` being
+	the key at slot i or 0 if the slot is empty. """
+	keys = sorted(keys)
+	# keep the load factor below 80% so that the search is quick
+	slotBits = max(1, (len(keys) * 5 // 4).bit_length())
+	while True:
+		bucketBits = max(1, slotBits - 2)
+		buckets = [[] for _ in range(1 << bucketBits)]
+		for key in keys:
+			buckets[hash16(key, 0x9e37, bucketBits)].append(key)
+		slots = [0] * (1 << slotBits)
+		displacements = [0] * len(buckets)
+		# place the largest buckets first while there are many free slots
+		for index in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+			if buckets[index]:
+				displacements[index] = place_bucket(buckets[index], slots, slotBits)
+		if None not in displacements:
+			return (bucketBits, slotBits, displacements, slots)
+		slotBits += 1
+
 # -----------------------------------------------------------------------------
 class PostmanBuilder(builder_base.Builder):
 
@@ -74,7 +115,38 @@ class PostmanBuilder(builder_base.Builder):
 					if action.parameterType is not None:
 						resumableActionsWithPayload += 1
 
+		# Dense dispatch table for all actions keyed on (destination << 8 | action).
+		# The slot of an action is used as case label, so that the compiler can
+		# generate a jump table.
+		actions = {}
+		actionNumber = 0
+		payloadNumber = 0
+		for component in components:
+			for action in component.actions:
+				key = (component.id << 8) | action.id
+				actions[key] = {'component': component, 'action': action,
+								'actionNumber': actionNumber, 'payloadNumber': payloadNumber}
+				if action.call == "resumable":
+					actionNumber += 1
+					if action.parameterType is not None:
+						payloadNumber += 1
+
+		bucketBits, slotBits, displacements, slots = perfect_hash(actions.keys())
+		actionTable = []
+		for slot, key in enumerate(slots):
+			if key: actionTable.append(dict(actions[key], slot=slot))
+
+		componentMask = [0] * 32
+		for component in components:
+			componentMask[component.id >> 3] |= 1 << (component.id & 7)
+
 		substitutions = {
+			'actionTable': actionTable,
+			'actionBucketBits': bucketBits,
+			'actionSlotBits': slotBits,
+			'actionDisplacements': displacements,
+			'actionSlots': slots,
+			'componentMask': componentMask,
 			'resumables': resumableActions,
 			'resumablePayloads': resumableActionsWithPayload,
 			'components': components,
@@ -19,6 +19,8 @@
 #include "component_{{ component.name | camelcase }}/{{ component.name | camelcase }}.hpp"
 {%- endfor %}
 
+#include <modm/architecture/interface/accessor_flash.hpp>
+
 #include "identifier.hpp"
 #include "postman.hpp"
 
@@ -29,6 +31,50 @@ namespace component
 	{%- endfor %}
 }
 
+namespace
+{
+	// Bitset of all components in this container
+	FLASH_STORAGE(uint8_t componentMask[32]) =
+	{
+	{%- for row in componentMask | batch(8) %}
+		{% for mask in row %}{{ "0x%02x" % mask }},{{ " " if not loop.last }}{% endfor %}
+	{%- endfor %}
+	};
+{%- if actionTable %}
+
+	// Perfect hash of (destination << 8 | packetIdentifier) for all actions.
+	// The displacement of a key's bucket moves it to a unique slot.
+	{%- set displacementType = "uint8_t" if actionDisplacements | max < 256 else "uint16_t" %}
+	FLASH_STORAGE({{ displacementType }} actionDisplacements[{{ actionDisplacements | length }}]) =
+	{
+	{%- for row in actionDisplacements | batch(16) %}
+		{{ row | join(", ") }},
+	{%- endfor %}
+	};
+
+	// Key of the action in each slot, 0 if empty
+	FLASH_STORAGE(uint16_t actionKeys[{{ actionSlots | length }}]) =
+	{
+	{%- for row in actionSlots | batch(8) %}
+		{% for key in row %}{{ "0x%04x" % key }},{{ " " if not loop.last }}{% endfor %}
+	{%- endfor %}
+	};
+
+	constexpr uint16_t
+	hash(uint16_t value, uint16_t multiplier, uint8_t bits)
+	{
+		return uint16_t(value * unsigned(multiplier)) >> (16 - bits);
+	}
+
+	uint16_t
+	actionSlot(uint16_t key)
+	{
+		const uint16_t bucket = hash(key, 0x9e37, {{ actionBucketBits }});
+		return hash(key ^ modm::accessor::asFlash(actionDisplacements)[bucket], 0x6a09, {{ actionSlotBits }});
+	}
+{%- endif %}
+}
+
 // ----------------------------------------------------------------------------
 xpcc::Postman::DeliverInfo
 Postman::deliverPacket(const xpcc::Header& header, const modm::SmartPointer& payload)
@@ -39,108 +85,91 @@ Postman::deliverPacket(const xpcc::Header& header, const modm::SmartPointer& pay
 	(void) payload;
 	(void) response;
 
-	switch (header.destination)
+	if (header.destination == 0)
 	{
-{%- set actionNumber = [] %}
-{%- set payloadNumber = [] %}
+		// Events
+		switch (header.packetIdentifier)
+		{
+{%- for event in container.events.subscribe %}
+			case {{ namespace }}::event::{{ event.name | CAMELCASE }}:
+	{%- for component in eventSubscriptions[event.name] %}
+		{%- if events[event.name].type != None %}
+				// void event{{ event.name | CamelCase }}(const xpcc::Header& header, const {{ namespace }}::packet::{{ events[event.name].type.name | CamelCase }} *payload);
+				component::{{ component.name | camelCase }}.event{{ event.name | CamelCase }}(header, &payload.get<{{ namespace }}::packet::{{ events[event.name].type.name | CamelCase }}>());
+		{%- else %}
+				// void event{{ event.name | CamelCase }}(const xpcc::Header& header);
+				component::{{ component.name | camelCase }}.event{{ event.name | CamelCase }}(header);
+		{%- endif %}
+	{%- endfor %}
+				break;
+{% endfor %}
+			default:
+				break;
+		}
+		return OK;
+	}
+{%- if actionTable %}
 
-{%- for component in components %}
-		case {{ namespace }}::component::{{ component.name | CAMELCASE }}:
+	const uint16_t key = (header.destination << 8) | header.packetIdentifier;
+	const uint16_t slot = actionSlot(key);
+	if (modm::accessor::asFlash(actionKeys)[slot] == key)
+	{
+		// The slots are dense, so this compiles to a jump table
+		switch (slot)
 		{
-			switch (header.packetIdentifier)
-			{
-	{%- for action in component.actions %}
+	{%- for entry in actionTable %}
+		{%- set component = entry.component %}
+		{%- set action = entry.action %}
 		{%- if action.parameterType != None %}
 			{%- set typePrefix = "" if action.parameterType.isBuiltIn else namespace ~ "::packet::" %}
 			{%- set payload = ", payload.get<" ~ typePrefix ~ (action.parameterType.name | CamelCase) ~ ">()" %}
 			{%- set arguments = "const " ~ typePrefix ~ (action.parameterType.name | CamelCase) ~ "& payload" %}
-			{%- set pointer = ", payload" %}
 		{%- else %}
 			{%- set payload = "" %}
 			{%- set arguments = "" %}
-			{%- set pointer = "" %}
 		{%- endif %}
 		{%- if action.returnType != None %}
 			{%- set returns = ("" if action.returnType.isBuiltIn else namespace ~ "::packet::") ~ action.returnType.name | CamelCase %}
 		{%- else %}
 			{%- set returns = "void" %}
 		{%- endif %}
-				case {{ namespace }}::action::{{ action.name | CAMELCASE }}:
+			case {{ entry.slot }}:	// {{ namespace }}::component::{{ component.name | CAMELCASE }}, {{ namespace }}::action::{{ action.name | CAMELCASE }}
 		{%- if action.call == "resumable" %}
-					// xpcc::ActionResponse<{{ returns }}> action{{ action.name | CamelCase }}({{ arguments }});
-					if (actionBuffer[{{ actionNumber.__len__() }}].destination != 0) {
-						component::{{component.name | camelCase}}.getCommunicator()->sendNegativeResponse(response);
-					}
-					else if (component_{{ component.name | camelCase }}_action{{ action.name | CamelCase }}(response{{ payload }}) == modm::rf::Running) {
-						actionBuffer[{{ actionNumber.__len__() }}] = ActionBuffer(header);
-			{%- if actionNumber.append(1)%}{%- endif %}
+				// xpcc::ActionResponse<{{ returns }}> action{{ action.name | CamelCase }}({{ arguments }});
+				if (actionBuffer[{{ entry.actionNumber }}].destination != 0) {
+					component::{{component.name | camelCase}}.getCommunicator()->sendNegativeResponse(response);
+				}
+				else if (component_{{ component.name | camelCase }}_action{{ action.name | CamelCase }}(response{{ payload }}) == modm::rf::Running) {
+					actionBuffer[{{ entry.actionNumber }}] = ActionBuffer(header);
 			{%- if action.parameterType != None %}
-						payloadBuffer[{{ payloadNumber.__len__() }}] = PayloadBuffer(payload);
-				{%- if payloadNumber.append(1)%}{%- endif %}
+					payloadBuffer[{{ entry.payloadNumber }}] = PayloadBuffer(payload);
 			{%- endif %}
-					}
+				}
 		{%- else %}
 			{%- if action.parameterType != None %}
 				{%- set payload = ", &payload.get<" ~ typePrefix ~ (action.parameterType.name | CamelCase) ~ ">()" %}
 				{%- set arguments = ", const " ~ typePrefix ~ (action.parameterType.name | CamelCase) ~ " *payload" %}
 			{%- endif %}
-					// void action{{ action.name | CamelCase }}(const xpcc::ResponseHandle& responseHandle{{ arguments }});
-					component::{{ component.name | camelCase }}.action{{ action.name | CamelCase }}(response{{ payload }});
+				// void action{{ action.name | CamelCase }}(const xpcc::ResponseHandle& responseHandle{{ arguments }});
+				component::{{ component.name | camelCase }}.action{{ action.name | CamelCase }}(response{{ payload }});
 		{%- endif %}
-					return OK;
+				return OK;
 	{%- endfor %}
 
-				default:
-					return NO_ACTION;
-			}
-			break;
+			default:
+				break;
 		}
-{% endfor %}
-
-		// Events
-		case 0:
-			switch (header.packetIdentifier)
-			{
-{%- for event in container.events.subscribe %}
-				case {{ namespace }}::event::{{ event.name | CAMELCASE }}:
-	{%- for component in eventSubscriptions[event.name] %}
-		{%- if events[event.name].type != None %}
-					// void event{{ event.name | CamelCase }}(const xpcc::Header& header, const {{ namespace }}::packet::{{ events[event.name].type.name | CamelCase }} *payload);
-					component::{{ component.name | camelCase }}.event{{ event.name | CamelCase }}(header, &payload.get<{{ namespace }}::packet::{{ events[event.name].type.name | CamelCase }}>());
-		{%- else %}
-					// void event{{ event.name | CamelCase }}(const xpcc::Header& header);
-					component::{{ component.name | camelCase }}.event{{ event.name | CamelCase }}(header);
-		{%- endif %}
-	{%- endfor %}
-					break;
-{% endfor %}
-				default:
-					break;
-			}
-			return OK;
-
-		default:
-			return NO_COMPONENT;
 	}
+{%- endif %}
 
-	return NOT_IMPLEMENTED_YET_ERROR;
+	return isComponentAvailable(header.destination) ? NO_ACTION : NO_COMPONENT;
 }
 
 // ----------------------------------------------------------------------------
 bool
 Postman::isComponentAvailable(uint8_t component) const
 {
-	switch (component)
-	{
-{%- for component in components %}
-		case {{ namespace }}::component::{{ component.name | CAMELCASE }}:
-{%- endfor %}
-			return true;
-			break;
-
-		default:
-			return false;
-	}
+	return modm::accessor::asFlash(componentMask)[component >> 3] & (1 << (component & 7));
 }
 
 void